@@ -11,6 +11,10 @@ if((NOT TARGET h5cpp_shared))
     find_package(h5cpp REQUIRED)
 endif()
 
+if(NOT TARGET Threads::Threads)
+    find_package(Threads REQUIRED)
+endif()
+
 set(BOOST_COMPONENTS)
 
 if(NOT TARGET Boost::filesystem)
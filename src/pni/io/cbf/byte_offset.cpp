@@ -0,0 +1,329 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <cstring>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/byte_offset.hpp>
+#include <pni/io/simd.hpp>
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    using namespace pni::core;
+
+    namespace{
+
+        //---------------------------------------------------------------------
+        // read little endian integers from the byte stream
+        //---------------------------------------------------------------------
+        inline uint32 read_uint16_le(const unsigned char *p)
+        {
+            return static_cast<uint32>(p[0]) | static_cast<uint32>(p[1])<<8;
+        }
+
+        inline uint32 read_uint32_le(const unsigned char *p)
+        {
+            return static_cast<uint32>(p[0])     | static_cast<uint32>(p[1])<<8 |
+                   static_cast<uint32>(p[2])<<16 | static_cast<uint32>(p[3])<<24;
+        }
+
+        //---------------------------------------------------------------------
+        void throw_truncated()
+        {
+            throw file_error(EXCEPTION_RECORD,
+                    "CBF binary section ends before all pixels have been "
+                    "decoded!");
+        }
+
+        //---------------------------------------------------------------------
+        //
+        // Decode a single multi byte difference. ptr points to the escape
+        // byte and is advanced past the difference. Accumulation is done
+        // with unsigned arithmetic which gives 32Bit two's complement
+        // wrap around without undefined behavior. For the 64Bit level only
+        // the lower 32Bit contribute to the result.
+        //
+        inline uint32 decode_escape(const unsigned char *&ptr,
+                                    const unsigned char *end)
+        {
+            if(end-ptr<3) throw_truncated();
+            uint32 d = read_uint16_le(ptr+1);
+            ptr += 3;
+            if(d != 0x8000) return static_cast<uint32>(static_cast<int16>(d));
+
+            if(end-ptr<4) throw_truncated();
+            d = read_uint32_le(ptr);
+            ptr += 4;
+            if(d != 0x80000000u) return d;
+
+            if(end-ptr<8) throw_truncated();
+            d = read_uint32_le(ptr);
+            ptr += 8;
+            return d;
+        }
+
+        //---------------------------------------------------------------------
+        //
+        // Scalar decoder. Processes the stream from ptr until n pixels have
+        // been written. This is the reference implementation and also used
+        // to decode the tails and escapes for the SIMD kernels.
+        //
+        inline void decode_scalar(const unsigned char *&ptr,
+                                  const unsigned char *end,
+                                  int32 *&data,size_t &n,uint32 &value)
+        {
+            while(n)
+            {
+                size_t nrun = std::min(n,static_cast<size_t>(end-ptr));
+                const unsigned char *stop = static_cast<const unsigned char*>(
+                        std::memchr(ptr,byte_offset_escape,nrun));
+                if(!stop) stop = ptr+nrun;
+
+                n -= stop-ptr;
+                for(;ptr!=stop;++ptr)
+                {
+                    value += static_cast<uint32>(static_cast<int8>(*ptr));
+                    *data++ = static_cast<int32>(value);
+                }
+
+                if(!n) break;
+
+                value += decode_escape(ptr,end);
+                *data++ = static_cast<int32>(value);
+                --n;
+            }
+        }
+
+#ifdef PNIIO_SIMD_X86
+        //---------------------------------------------------------------------
+        //
+        // SSE2 kernel. Blocks of 16 bytes without escape are sign extended
+        // to 16Bit, summed up with a logarithmic prefix sum (at most
+        // 16*128 which fits into 16Bit) and then widened to 32Bit and added
+        // to the running value. Blocks containing an escape byte are
+        // decoded with scalar code up to and including the escape.
+        //
+        PNIIO_TARGET_SSE2
+        void decode_sse2(const unsigned char *&ptr,const unsigned char *end,
+                         int32 *&data,size_t &n,uint32 &value)
+        {
+            const __m128i escape = _mm_set1_epi8(static_cast<char>(0x80));
+            const __m128i zero   = _mm_setzero_si128();
+            __m128i carry = _mm_set1_epi32(static_cast<int32>(value));
+
+            while(n>=16 && end-ptr>=16)
+            {
+                __m128i bytes = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(ptr));
+                int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes,escape));
+
+                if(mask)
+                {
+                    //decode everything up to and including the escape
+                    value = static_cast<uint32>(_mm_cvtsi128_si32(carry));
+                    size_t k = 0;
+                    while(!(mask & (1<<k))) ++k;
+                    for(size_t i=0;i<k;++i,++ptr)
+                    {
+                        value += static_cast<uint32>(static_cast<int8>(*ptr));
+                        *data++ = static_cast<int32>(value);
+                    }
+                    value += decode_escape(ptr,end);
+                    *data++ = static_cast<int32>(value);
+                    n -= k+1;
+                    carry = _mm_set1_epi32(static_cast<int32>(value));
+                    continue;
+                }
+
+                //sign extension to 16Bit
+                __m128i sign = _mm_cmpgt_epi8(zero,bytes);
+                __m128i lo   = _mm_unpacklo_epi8(bytes,sign);
+                __m128i hi   = _mm_unpackhi_epi8(bytes,sign);
+
+                //prefix sum over 8 16Bit lanes each
+                lo = _mm_add_epi16(lo,_mm_slli_si128(lo,2));
+                lo = _mm_add_epi16(lo,_mm_slli_si128(lo,4));
+                lo = _mm_add_epi16(lo,_mm_slli_si128(lo,8));
+                hi = _mm_add_epi16(hi,_mm_slli_si128(hi,2));
+                hi = _mm_add_epi16(hi,_mm_slli_si128(hi,4));
+                hi = _mm_add_epi16(hi,_mm_slli_si128(hi,8));
+                __m128i t = _mm_shufflehi_epi16(lo,_MM_SHUFFLE(3,3,3,3));
+                hi = _mm_add_epi16(hi,_mm_unpackhi_epi64(t,t));
+
+                //widen to 32Bit and add the running value
+                __m128i s;
+                s = _mm_cmpgt_epi16(zero,lo);
+                __m128i r0 = _mm_add_epi32(carry,_mm_unpacklo_epi16(lo,s));
+                __m128i r1 = _mm_add_epi32(carry,_mm_unpackhi_epi16(lo,s));
+                s = _mm_cmpgt_epi16(zero,hi);
+                __m128i r2 = _mm_add_epi32(carry,_mm_unpacklo_epi16(hi,s));
+                __m128i r3 = _mm_add_epi32(carry,_mm_unpackhi_epi16(hi,s));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(data),r0);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(data+4),r1);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(data+8),r2);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(data+12),r3);
+
+                carry = _mm_shuffle_epi32(r3,_MM_SHUFFLE(3,3,3,3));
+                ptr  += 16;
+                data += 16;
+                n    -= 16;
+            }
+
+            value = static_cast<uint32>(_mm_cvtsi128_si32(carry));
+            decode_scalar(ptr,end,data,n,value);
+        }
+
+        //---------------------------------------------------------------------
+        //
+        // AVX2 kernel. Works like the SSE2 kernel on 32 byte blocks. Groups
+        // of 8 bytes are sign extended directly to 32Bit. The prefix sum
+        // is computed within the two 128Bit lanes and the sum of the lower
+        // lane is then propagated to the upper one.
+        //
+        PNIIO_TARGET_AVX2
+        inline __m256i prefix_sum_avx2(__m256i x,__m256i carry)
+        {
+            x = _mm256_add_epi32(x,_mm256_slli_si256(x,4));
+            x = _mm256_add_epi32(x,_mm256_slli_si256(x,8));
+            __m256i t = _mm256_shuffle_epi32(x,_MM_SHUFFLE(3,3,3,3));
+            x = _mm256_add_epi32(x,_mm256_permute2x128_si256(t,t,0x08));
+            return _mm256_add_epi32(x,carry);
+        }
+
+        PNIIO_TARGET_AVX2
+        void decode_avx2(const unsigned char *&ptr,const unsigned char *end,
+                         int32 *&data,size_t &n,uint32 &value)
+        {
+            const __m256i escape = _mm256_set1_epi8(static_cast<char>(0x80));
+            const __m256i last   = _mm256_set1_epi32(7);
+            __m256i carry = _mm256_set1_epi32(static_cast<int32>(value));
+
+            while(n>=32 && end-ptr>=32)
+            {
+                __m256i bytes = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(ptr));
+                uint32 mask = static_cast<uint32>(_mm256_movemask_epi8(
+                            _mm256_cmpeq_epi8(bytes,escape)));
+
+                if(mask)
+                {
+                    //decode everything up to and including the escape
+                    value = static_cast<uint32>(_mm256_cvtsi256_si32(carry));
+                    size_t k = 0;
+                    while(!(mask & (1u<<k))) ++k;
+                    for(size_t i=0;i<k;++i,++ptr)
+                    {
+                        value += static_cast<uint32>(static_cast<int8>(*ptr));
+                        *data++ = static_cast<int32>(value);
+                    }
+                    value += decode_escape(ptr,end);
+                    *data++ = static_cast<int32>(value);
+                    n -= k+1;
+                    carry = _mm256_set1_epi32(static_cast<int32>(value));
+                    continue;
+                }
+
+                for(size_t i=0;i<4;++i)
+                {
+                    __m128i group = _mm_loadl_epi64(
+                            reinterpret_cast<const __m128i*>(ptr+8*i));
+                    __m256i r = prefix_sum_avx2(_mm256_cvtepi8_epi32(group),carry);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data+8*i),r);
+                    carry = _mm256_permutevar8x32_epi32(r,last);
+                }
+
+                ptr  += 32;
+                data += 32;
+                n    -= 32;
+            }
+
+            value = static_cast<uint32>(_mm256_cvtsi256_si32(carry));
+            decode_scalar(ptr,end,data,n,value);
+        }
+#endif
+
+        //---------------------------------------------------------------------
+        typedef void (*kernel_type)(const unsigned char *&,
+                                    const unsigned char *,
+                                    int32 *&,size_t &,uint32 &);
+
+        //---------------------------------------------------------------------
+        const simd_dispatch<kernel_type> &dispatch()
+        {
+            static const simd_dispatch<kernel_type> kernels(decode_scalar,{
+#ifdef PNIIO_SIMD_X86
+                    {simd_extension::AVX2,decode_avx2},
+                    {simd_extension::SSE2,decode_sse2}
+#endif
+                    });
+            return kernels;
+        }
+
+        //---------------------------------------------------------------------
+        size_t run_kernel(kernel_type kernel,const char *buffer,size_t size,
+                          int32 *data,size_t n,int32 value)
+        {
+            const unsigned char *begin =
+                reinterpret_cast<const unsigned char*>(buffer);
+            const unsigned char *ptr = begin;
+            uint32 v = static_cast<uint32>(value);
+
+            kernel(ptr,begin+size,data,n,v);
+            return static_cast<size_t>(ptr-begin);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    simd_extension byte_offset_simd_extension()
+    {
+        return dispatch().best();
+    }
+
+    //-------------------------------------------------------------------------
+    bool byte_offset_simd_supported(simd_extension ext)
+    {
+        return dispatch().supported(ext);
+    }
+
+    //-------------------------------------------------------------------------
+    size_t decode_byte_offset(const char *buffer,size_t size,int32 *data,
+                              size_t n,int32 value)
+    {
+        static const kernel_type kernel = dispatch().kernel();
+
+        return run_kernel(kernel,buffer,size,data,n,value);
+    }
+
+    //-------------------------------------------------------------------------
+    size_t decode_byte_offset(simd_extension ext,const char *buffer,
+                              size_t size,int32 *data,size_t n,int32 value)
+    {
+        return run_kernel(dispatch().kernel(ext),buffer,size,data,n,value);
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,193 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/simd_extension.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief byte offset escape byte
+    //!
+    //! A byte with this value in the compressed stream indicates that the
+    //! next delta is stored with more than one byte.
+    //!
+    const unsigned char byte_offset_escape = 0x80;
+
+    //-------------------------------------------------------------------------
+    //! SIMD extensions - the byte offset decoder supports SSE2 and AVX2
+    using pni::io::simd_extension;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief get the SIMD extension used by the byte offset decoder
+    //!
+    //! The decoder implementation is selected once at runtime according to 
+    //! the capabilities of the CPU. 
+    //!
+    //! \return best SIMD extension supported by the CPU and the build
+    //!
+    PNIIO_EXPORT simd_extension byte_offset_simd_extension();
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief check if a SIMD extension can be used
+    //!
+    //! \param ext the extension to check
+    //! \return true if the decoder can use ext on this machine
+    //!
+    PNIIO_EXPORT bool byte_offset_simd_supported(simd_extension ext);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief decode byte offset compressed data from memory
+    //!
+    //! Decodes a byte offset compressed binary section which has already
+    //! been loaded into memory. Every pixel is stored as the difference to
+    //! its predecessor. Differences in the range [-127,127] occupy a single
+    //! byte. Larger differences are introduced by the escape byte 0x80 and
+    //! are stored as little endian 16Bit, 32Bit or 64Bit integers, where
+    //! each level uses its minimum value as the escape to the next one.
+    //! Values are accumulated with 32Bit two's complement arithmetic. 
+    //!
+    //! Runs of single byte differences are sign extended and summed up 
+    //! in SIMD registers. The implementation is chosen at runtime and 
+    //! falls back to scalar code on CPUs without SSE2 or AVX2.
+    //!
+    //! \throws file_error if the buffer ends before data is filled
+    //! 
+    //! \param buffer pointer to the first byte of compressed data
+    //! \param size number of bytes in the buffer
+    //! \param data pointer to the output buffer 
+    //! \param n number of pixels to decode
+    //! \param value value of the pixel preceding data[0]
+    //! \return number of bytes consumed from the buffer
+    //!
+    PNIIO_EXPORT size_t decode_byte_offset(const char *buffer,size_t size,
+                                           pni::core::int32 *data,size_t n,
+                                           pni::core::int32 value=0);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief decode with a particular implementation
+    //!
+    //! Like the above function but with an explicitly selected 
+    //! implementation. This is mainly used to check the SIMD 
+    //! implementations against the scalar one.
+    //!
+    //! \throws file_error if the buffer ends before data is filled
+    //! \throws not_implemented_error if ext is not supported
+    //!
+    //! \param ext SIMD extension to use
+    //! \param buffer pointer to the first byte of compressed data
+    //! \param size number of bytes in the buffer
+    //! \param data pointer to the output buffer 
+    //! \param n number of pixels to decode
+    //! \param value value of the pixel preceding data[0]
+    //! \return number of bytes consumed from the buffer
+    //!
+    PNIIO_EXPORT size_t decode_byte_offset(simd_extension ext,
+                                           const char *buffer,size_t size,
+                                           pni::core::int32 *data,size_t n,
+                                           pni::core::int32 value=0);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief decode byte offset compressed data into a container
+    //!
+    //! Data is decoded in blocks into a small buffer from where it is 
+    //! converted to the value type of the container. 
+    //!
+    //! \throws file_error if the buffer ends before data is filled
+    //!
+    //! \tparam CTYPE container type where to store the data
+    //! \param buffer pointer to the first byte of the binary section
+    //! \param size number of bytes in the buffer
+    //! \param data container where to store the decoded pixels
+    //! \return number of bytes consumed from the buffer
+    //!
+    template<typename CTYPE>
+    size_t decode_byte_offset(const char *buffer,size_t size,CTYPE &data)
+    {
+        using namespace pni::core;
+        typedef typename CTYPE::value_type value_type;
+        static const size_t block_size = 4096;
+
+        int32 block[block_size];
+        size_t offset = 0;
+        int32 value = 0;
+        size_t remaining = data.size();
+        auto iter = data.begin();
+
+        while(remaining)
+        {
+            size_t n = std::min(remaining,block_size);
+            offset += decode_byte_offset(buffer+offset,size-offset,block,n,value);
+            value = block[n-1];
+
+            for(size_t i=0;i<n;++i,++iter)
+                *iter = static_cast<value_type>(block[i]);
+
+            remaining -= n;
+        }
+
+        return offset;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief decode byte offset compressed data into a 32Bit vector
+    //!
+    //! Overload for the native output type of the decoder. Data is decoded 
+    //! directly into the vector without intermediate buffer.
+    //!
+    //! \throws file_error if the buffer ends before data is filled
+    //!
+    //! \param buffer pointer to the first byte of the binary section
+    //! \param size number of bytes in the buffer
+    //! \param data vector where to store the decoded pixels
+    //! \return number of bytes consumed from the buffer
+    //!
+    inline size_t decode_byte_offset(const char *buffer,size_t size,
+                                     std::vector<pni::core::int32> &data)
+    {
+        return decode_byte_offset(buffer,size,data.data(),data.size());
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,159 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/cbf_batch_reader.hpp>
+
+namespace fs = boost::filesystem;
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    using namespace pni::core;
+
+    namespace{
+
+        //---------------------------------------------------------------------
+        // match a string against a pattern with the wildcards * and ?
+        bool wildcard_match(const char *pattern,const char *str)
+        {
+            const char *star = nullptr;
+            const char *backtrack = nullptr;
+
+            while(*str)
+            {
+                if(*pattern == '*')
+                {
+                    star = pattern++;
+                    backtrack = str;
+                }
+                else if(*pattern == '?' || *pattern == *str)
+                {
+                    ++pattern;
+                    ++str;
+                }
+                else if(star)
+                {
+                    pattern = star+1;
+                    str = ++backtrack;
+                }
+                else
+                    return false;
+            }
+
+            while(*pattern == '*') ++pattern;
+            return !*pattern;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<string> file_sequence(const string &pattern,size_t first,
+                                      size_t last,size_t step)
+    {
+        if(!step)
+            throw value_error(EXCEPTION_RECORD,"Step must not be 0!");
+
+        //locate the integer field in the pattern
+        size_t start = pattern.find('%');
+        if(start == string::npos || pattern.find('%',start+1)!=string::npos)
+            throw value_error(EXCEPTION_RECORD,
+                    "Pattern ["+pattern+"] must contain a single %d field!");
+
+        size_t pos = start+1;
+        bool zero_pad = false;
+        if(pos<pattern.size() && pattern[pos]=='0')
+        {
+            zero_pad = true;
+            ++pos;
+        }
+
+        size_t width = 0;
+        while(pos<pattern.size() &&
+              std::isdigit(static_cast<unsigned char>(pattern[pos])))
+            width = 10*width+(pattern[pos++]-'0');
+
+        if(pos>=pattern.size() || pattern[pos]!='d')
+            throw value_error(EXCEPTION_RECORD,
+                    "Pattern ["+pattern+"] must contain a single %d field!");
+
+        string prefix = pattern.substr(0,start);
+        string suffix = pattern.substr(pos+1);
+
+        std::vector<string> files;
+        if(first>last) return files;
+
+        //the number of files is computed up front as first+n*step could
+        //overflow for a last number close to the maximum of size_t
+        size_t nfiles = (last-first)/step+1;
+        files.reserve(nfiles);
+        for(size_t n=0;n<nfiles;++n)
+        {
+            std::stringstream ss;
+            ss<<prefix<<std::setfill(zero_pad ? '0' : ' ')<<std::setw(width)
+              <<first+n*step<<suffix;
+            files.push_back(ss.str());
+        }
+        return files;
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<string> glob(const string &pattern)
+    {
+        fs::path p(pattern);
+        fs::path directory = p.parent_path();
+        string name = p.filename().string();
+        if(directory.empty()) directory = ".";
+
+        if(!fs::is_directory(directory))
+            throw file_error(EXCEPTION_RECORD,
+                    "Directory ["+directory.string()+"] does not exist!");
+
+        std::vector<string> files;
+        for(fs::directory_iterator iter(directory),end;iter!=end;++iter)
+        {
+            if(!fs::is_regular_file(iter->status())) continue;
+
+            string fname = iter->path().filename().string();
+            if(wildcard_match(name.c_str(),fname.c_str()))
+            {
+                if(p.parent_path().empty())
+                    files.push_back(fname);
+                else
+                    files.push_back(iter->path().string());
+            }
+        }
+
+        std::sort(files.begin(),files.end());
+        return files;
+    }
+
+//end of namespace
+}
+}
+}
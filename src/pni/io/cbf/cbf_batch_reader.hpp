@@ -0,0 +1,339 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/cbf_reader.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief create a list of file names from a sequence pattern
+    //!
+    //! The pattern must contain exactly one integer field of the form %d or
+    //! %0Nd (for instance scan_%05d.cbf) which is replaced by the numbers
+    //! first, first+step, ... up to and including last.
+    //!
+    //! \throws value_error if the pattern does not contain a single
+    //! integer field or step is 0
+    //!
+    //! \param pattern the file name pattern
+    //! \param first the first number of the sequence
+    //! \param last the last number of the sequence
+    //! \param step the increment between two numbers
+    //! \return list of file names
+    //!
+    PNIIO_EXPORT std::vector<pni::core::string>
+    file_sequence(const pni::core::string &pattern,size_t first,size_t last,
+                  size_t step=1);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief find all files matching a wildcard pattern
+    //!
+    //! The wildcards * and ? are allowed in the file name part of the
+    //! pattern only (for instance /data/scan_*.cbf). The returned file
+    //! names are sorted lexicographically which, for zero padded frame
+    //! numbers, is the order of the frames.
+    //!
+    //! \throws file_error if the directory does not exist
+    //!
+    //! \param pattern wildcard pattern
+    //! \return sorted list of matching file names
+    //!
+    PNIIO_EXPORT std::vector<pni::core::string>
+    glob(const pni::core::string &pattern);
+}
+
+//!
+//! \ingroup image_io_cbf
+//! \brief read a sequence of single frame CBF files in parallel
+//!
+//! Detectors like the Pilatus write one CBF file per frame. This class
+//! reads the first image of each file of a list with a pool of worker
+//! threads. The frames are returned by next() in the order of the file
+//! list.
+//!
+//! At most prefetch frames are decoded ahead of the consumer. The memory
+//! used by the reader is thus bounded by prefetch frames. Containers
+//! passed to next() are recycled by the workers for the following frames.
+//!
+//! \code
+//! cbf_batch_reader<std::vector<int32>> reader(cbf::glob("scan_*.cbf"),8);
+//! std::vector<int32> frame;
+//! while(reader.next(frame))
+//!     process(frame);
+//! \endcode
+//!
+//! \tparam CTYPE container type for the frames
+//!
+template<typename CTYPE>
+class cbf_batch_reader
+{
+  private:
+    //! a slot in the prefetch ring buffer
+    struct slot_type
+    {
+      //! frame data
+      CTYPE data;
+      //! true if data is ready for the consumer
+      bool ready;
+      //! exception thrown by the worker
+      std::exception_ptr error;
+    };
+
+    //! list of files to read
+    std::vector<pni::core::string> _files;
+    //! ring buffer with the frames decoded ahead
+    std::vector<slot_type> _slots;
+    //! index of the next frame to be handed to the consumer
+    size_t _next_frame;
+    //! index of the next frame to be decoded by a worker
+    size_t _next_job;
+    //! flag signaling the workers to terminate
+    bool _stop;
+    //! mutex protecting the state of the reader
+    std::mutex _mutex;
+    //! signaled when a frame becomes ready
+    std::condition_variable _frame_ready;
+    //! signaled when a slot becomes free
+    std::condition_variable _slot_free;
+    //! the worker threads
+    std::vector<std::thread> _workers;
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief worker thread main loop
+    //!
+    void _work();
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief stop and join all workers
+    //!
+    void _shutdown();
+
+  public:
+    //-----------------------------------------------------------------
+    //!
+    //! \brief constructor
+    //!
+    //! Starts the worker threads which immediately begin to decode
+    //! frames.
+    //!
+    //! \param files list of CBF files
+    //! \param nthreads number of worker threads (0 = number of cores)
+    //! \param prefetch max. number of frames decoded ahead of the
+    //! consumer (0 = twice the number of threads)
+    //!
+    explicit cbf_batch_reader(const std::vector<pni::core::string> &files,
+                              size_t nthreads=0,size_t prefetch=0);
+
+    //-----------------------------------------------------------------
+    //! destructor - stops all workers
+    ~cbf_batch_reader();
+
+    //-----------------------------------------------------------------
+    //! copy constructor is deleted
+    cbf_batch_reader(const cbf_batch_reader &) = delete;
+
+    //! copy assignment is deleted
+    cbf_batch_reader &operator=(const cbf_batch_reader &) = delete;
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief number of frames
+    //!
+    size_t size() const { return _files.size(); }
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief number of worker threads
+    //!
+    size_t nthreads() const { return _workers.size(); }
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief prefetch depth
+    //!
+    size_t prefetch() const { return _slots.size(); }
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief get the next frame
+    //!
+    //! Blocks until the next frame is decoded and swaps it into frame.
+    //! The previous content of frame is used by the workers as a buffer
+    //! for one of the following frames.
+    //!
+    //! \throws file_error if a file cannot be read
+    //! \throws size_mismatch_error if a frame differs in size from the
+    //! container
+    //!
+    //! \param frame container receiving the frame data
+    //! \return false if all frames have been read, true otherwise
+    //!
+    bool next(CTYPE &frame);
+};
+
+//-------------------------------------------------------------------------
+template<typename CTYPE>
+cbf_batch_reader<CTYPE>::cbf_batch_reader(
+        const std::vector<pni::core::string> &files,size_t nthreads,
+        size_t prefetch):
+  _files(files),
+  _slots(),
+  _next_frame(0),
+  _next_job(0),
+  _stop(false),
+  _mutex(),
+  _frame_ready(),
+  _slot_free(),
+  _workers()
+{
+  if(!nthreads)
+    nthreads = std::max(std::thread::hardware_concurrency(),1u);
+  if(!prefetch)
+    prefetch = 2*nthreads;
+
+  //there is no point in having more workers than slots or files
+  nthreads = std::min(std::min(nthreads,prefetch),
+                      std::max(_files.size(),size_t(1)));
+
+  _slots.resize(prefetch);
+  for(auto &slot: _slots) slot.ready = false;
+
+  try
+  {
+    for(size_t i=0;i<nthreads;++i)
+      _workers.push_back(std::thread(&cbf_batch_reader<CTYPE>::_work,this));
+  }
+  catch(...)
+  {
+    _shutdown();
+    throw;
+  }
+}
+
+//-------------------------------------------------------------------------
+template<typename CTYPE>
+cbf_batch_reader<CTYPE>::~cbf_batch_reader()
+{
+  _shutdown();
+}
+
+//-------------------------------------------------------------------------
+template<typename CTYPE>
+void cbf_batch_reader<CTYPE>::_shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _slot_free.notify_all();
+
+  for(auto &worker: _workers)
+    if(worker.joinable()) worker.join();
+}
+
+//-------------------------------------------------------------------------
+template<typename CTYPE>
+void cbf_batch_reader<CTYPE>::_work()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  while(true)
+  {
+    //wait for a free slot within the prefetch window
+    _slot_free.wait(lock,[this]()
+    {
+      return _stop || _next_job>=_files.size() ||
+             _next_job<_next_frame+_slots.size();
+    });
+
+    if(_stop || _next_job>=_files.size()) return;
+
+    size_t job = _next_job++;
+    slot_type &slot = _slots[job%_slots.size()];
+    lock.unlock();
+
+    //the slot is owned by this worker until it is marked ready
+    std::exception_ptr error;
+    try
+    {
+      cbf_reader reader(_files[job]);
+      size_t npixels = reader.info(0).npixels();
+      if(slot.data.size()!=npixels)
+        slot.data = CTYPE(npixels);
+      reader.image(slot.data,0);
+    }
+    catch(...)
+    {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    slot.error = error;
+    slot.ready = true;
+    _frame_ready.notify_all();
+  }
+}
+
+//-------------------------------------------------------------------------
+template<typename CTYPE>
+bool cbf_batch_reader<CTYPE>::next(CTYPE &frame)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  if(_next_frame>=_files.size()) return false;
+
+  slot_type &slot = _slots[_next_frame%_slots.size()];
+  _frame_ready.wait(lock,[&slot]() { return slot.ready; });
+
+  std::exception_ptr error = slot.error;
+  std::swap(frame,slot.data);
+  slot.ready = false;
+  slot.error = nullptr;
+  ++_next_frame;
+  lock.unlock();
+  _slot_free.notify_all();
+
+  if(error) std::rethrow_exception(error);
+  return true;
+}
+
+//end of namespace
+}
+}
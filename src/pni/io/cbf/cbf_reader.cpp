@@ -27,9 +27,7 @@
 #include <pni/io/strutils.hpp>
 #include <pni/core/error.hpp>
 #include <pni/core/types.hpp>
-
-//need to use regular expressions from boost
-#include<boost/regex.hpp>
+#include <pni/io/cbf/header_parser.hpp>
 
 
 namespace pni{
@@ -37,7 +35,13 @@ namespace io{
 
 //================implementation of constructors and destructor========
 //implementation of the default constructor
-cbf_reader::cbf_reader():image_reader()
+cbf_reader::cbf_reader():
+  image_reader(),
+  _detector_vendor(cbf::vendor_id::DECTRIS),
+  _image_info(),
+  _data_offset(0),
+  _data_size(0),
+  _compression_type(cbf::compression_id::CBF_BYTE_OFFSET)
 {
   _set_binary();
 }
@@ -45,7 +49,12 @@ cbf_reader::cbf_reader():image_reader()
 //---------------------------------------------------------------------
 //implementation of the standard constructor
 cbf_reader::cbf_reader(const pni::core::string &fname):
-            image_reader(fname,true)
+            image_reader(fname,true),
+            _detector_vendor(cbf::vendor_id::DECTRIS),
+            _image_info(),
+            _data_offset(0),
+            _data_size(0),
+            _compression_type(cbf::compression_id::CBF_BYTE_OFFSET)
 {
   //here the file is immediately opened  - we have to parse the
   //header to obtain information about the data
@@ -53,6 +62,16 @@ cbf_reader::cbf_reader(const pni::core::string &fname):
 
 }
 
+//---------------------------------------------------------------------
+cbf_reader::cbf_reader(const cbf::frame_record &record):
+            image_reader(record.file,true),
+            _detector_vendor(cbf::vendor_id::DECTRIS),
+            _image_info{record.info()},
+            _data_offset(static_cast<std::streamoff>(record.data_offset)),
+            _data_size(record.data_size),
+            _compression_type(record.compression)
+{ }
+
 //----------------------------------------------------------------
 void cbf_reader::close()
 {
@@ -60,6 +79,7 @@ void cbf_reader::close()
   data_reader::close();
   //reset data offset
   _data_offset = 0;
+  _data_size = 0;
   //clear the _image_info vector
   _image_info.clear();
 }
@@ -93,41 +113,53 @@ cbf_reader::~cbf_reader()
 void cbf_reader::_parse_file()
 {
   using namespace pni::core;
-  char linebuffer[1024];
-  std::ifstream &_istream = _get_stream();
+  string buffer;
+  const char *begin = nullptr;
+  size_t offset = string::npos;
 
-  boost::regex header_convention("^_array_data.header_convention.*");
-  boost::regex regex_sls("SLS");
-  boost::regex regex_dectris("DECTRIS");
-  boost::regex regex_pilatus("PILATUS");
-  boost::regex quoted_text("\".*\"");
-  boost::cmatch match;
+  if(const file_map *map = _get_map())
+  {
+    //header and binary section are read from the beginning to the end
+    map->advise(file_map::access::SEQUENTIAL);
 
-  while(!_istream.eof())
+    //the header is parsed in place
+    begin  = map->data();
+    offset = cbf::find_header_end(begin,map->size());
+  }
+  else
   {
-    _istream.getline(linebuffer,1024);
-    if(boost::regex_match(linebuffer,match,header_convention)){
-      //extract the convention string from the header
-      //convention
-      boost::regex_search(linebuffer,match,quoted_text);
-      if(boost::regex_search(match.str(0),regex_sls)||
-          boost::regex_search(match.str(0),regex_dectris) ||
-          boost::regex_search(match.str(0),regex_pilatus))
-      {
-        _data_offset = cbf::dectris_reader::read_header(_istream,
-                                                        _image_info,_compression_type);
-        _detector_vendor = cbf::vendor_id::DECTRIS;
-        return;
-      }else{
-        //should raise an exception here
-        throw file_error(EXCEPTION_RECORD,"Unknown CBF style!");
-      }
-    }
+    //read the entire header with a few large reads 
+    std::ifstream &_istream = _get_stream();
+    _istream.clear();
+    _istream.seekg(0);
+    offset = cbf::read_header_block(_istream,buffer);
+    begin  = buffer.data();
   }
 
-  if(_istream.eof())
+  if(offset == string::npos)
     throw file_error(EXCEPTION_RECORD,
                      "File is most probably not a CBF file");
+
+  const char *end = begin+offset;
+
+  string convention = cbf::header_convention(begin,end);
+  if(convention.empty())
+    throw file_error(EXCEPTION_RECORD,
+                     "File is most probably not a CBF file");
+
+  if(convention.find("SLS")!=string::npos ||
+     convention.find("DECTRIS")!=string::npos ||
+     convention.find("PILATUS")!=string::npos)
+  {
+    cbf::binary_header header = cbf::dectris_reader::read_header(begin,end,
+                                                                 _image_info);
+    _data_offset      = static_cast<std::streamoff>(offset);
+    _data_size        = header.binary_size;
+    _compression_type = header.compression;
+    _detector_vendor  = cbf::vendor_id::DECTRIS;
+  }
+  else
+    throw file_error(EXCEPTION_RECORD,"Unknown CBF style!");
 }
 
 
@@ -30,12 +30,11 @@
 #include<cstdlib>
 #include<vector>
 
-#include<boost/regex.hpp>
-
 #include <pni/core/types.hpp>
 
 #include <pni/io/image_reader.hpp>
 #include <pni/io/cbf/dectris_reader.hpp>
+#include <pni/io/cbf/scan_index.hpp>
 #include <pni/io/cbf/types.hpp>
 #include <pni/io/windows.hpp>
 
@@ -77,6 +76,8 @@ class PNIIO_EXPORT cbf_reader: public image_reader
     std::vector<image_info> _image_info;
     //! store data offset
     std::streampos _data_offset;
+    //! size of the binary section in bytes
+    size_t _data_size;
     //! compression type
     cbf::compression_id _compression_type;
 #ifdef _MSC_VER
@@ -110,6 +111,20 @@ class PNIIO_EXPORT cbf_reader: public image_reader
     //!
     cbf_reader(const pni::core::string &fname);
 
+    //-----------------------------------------------------------------
+    //!
+    //! @brief construct reader from a scan index record
+    //!
+    //! Opens the file but does not parse its header. All information
+    //! required to read the image is taken from the record, typically
+    //! obtained from a cbf::scan_index. A later call to open() parses
+    //! the header again.
+    //!
+    //! @throw file_error if the file cannot be opened
+    //! @param record metadata of the file
+    //!
+    explicit cbf_reader(const cbf::frame_record &record);
+
     //-----------------------------------------------------------------
     //! destructor
     virtual ~cbf_reader();
@@ -226,21 +241,46 @@ void cbf_reader::image(CTYPE &data,size_t i,size_t c)
 
   if(_detector_vendor == cbf::vendor_id::DECTRIS)
   {
-    if(channel.type_id() == type_id_t::INT16)
-      //read 16Bit signed data
-      cbf::dectris_reader::read_data_byte_offset<int16>(
-          _get_stream(),inf,data);
-    if(channel.type_id() == type_id_t::INT32)
-      //read 32Bit signed data
-      cbf::dectris_reader::read_data_byte_offset<int32>(
-          _get_stream(),inf,data);
-    else
+    if(channel.type_id() != type_id_t::INT16 && 
+       channel.type_id() != type_id_t::INT32)
     {
       file_error error(EXCEPTION_RECORD,
                        "No data reader for this data type!");
       throw error;
     }
 
+    if(const file_map *map = _get_map())
+    {
+      //decode straight from the mapped file
+      size_t offset = static_cast<size_t>(_data_offset);
+      if(offset>map->size() || (_data_size && _data_size>map->size()-offset))
+        throw file_error(EXCEPTION_RECORD,
+                         "Binary section exceeds the size of the file!");
+
+      size_t nbytes = _data_size ? _data_size : map->size()-offset;
+      if(channel.type_id() == type_id_t::INT16)
+        cbf::dectris_reader::read_data_byte_offset<int16>(
+            map->data()+offset,nbytes,inf,data);
+      else
+        cbf::dectris_reader::read_data_byte_offset<int32>(
+            map->data()+offset,nbytes,inf,data);
+      return;
+    }
+
+    //the binary section is always read from its beginning
+    std::ifstream &stream = _get_stream();
+    stream.clear();
+    stream.seekg(_data_offset);
+
+    if(channel.type_id() == type_id_t::INT16)
+      //read 16Bit signed data
+      cbf::dectris_reader::read_data_byte_offset<int16>(
+          stream,inf,data,_data_size);
+    else
+      //read 32Bit signed data
+      cbf::dectris_reader::read_data_byte_offset<int32>(
+          stream,inf,data,_data_size);
+
   }
   else
     throw file_error(EXCEPTION_RECORD,"Unknown detector vendor!");
@@ -22,7 +22,6 @@
 //
 //
 
-#include <boost/regex.hpp>
 #include <pni/core/error.hpp>
 #include <pni/io/cbf/dectris_reader.hpp>
 
@@ -36,113 +35,49 @@ namespace cbf{
     std::streampos dectris_reader::read_header(std::ifstream &is,
             std::vector<pni::io::image_info> &info,compression_id &ct)
     {
-        using namespace pni::core;
-        uint8 byte;
-        string linebuffer;
-        size_t nx=0,ny=0,bits_per_pixel;
-        type_id_t tid;
-        
-        //define some useful regular expressions
-        boost::regex quoted_text("\".*\"");
-        boost::regex int_numbers("[[:digit:]]+");
-        boost::regex conversion_regex(".*conversions=.*"); //
-        boost::regex type_regex("^X-Binary-Element-Type:.*"); // "signed 32-bit integer"
-        boost::regex ny_regex("^X-Binary-Size-Fastest-Dimension:.*");// 487
-        boost::regex nx_regex("^X-Binary-Size-Second-Dimension:.*"); // 195
-        boost::smatch match;
-
-
-        //we really need to parse such a file byte by byte as the marker
-        //indicating the start of the data section is encoded in a single
-        //byte. Thus if we would read header data line wise we would most
-        //probably miss it.
-        while(!is.eof()){
-            byte = is.get();
-
-            //the first thing we have to check here is if we have reached
-            //the binary section of the data
-            if(((unsigned char)byte) == 0xd5)
-            {
-                //ok - if we came here we are done with all the rubish
-                image_info iinfo(nx,ny);
-                iinfo.append_channel(image_channel_info(tid,bits_per_pixel));
-                info.push_back(iinfo);
-
-                //this means that we have to store the offset and can 
-                //break the loop here
-                return is.tellg();
-                break;
-            }
-
-            
-            if(byte == '\n'){
-                //now we need to check the line for usefull information
-          
-                //--------------get compression algorithm------------------
-                if(boost::regex_match(linebuffer,conversion_regex))
-                {
-                    if(!boost::regex_search(linebuffer,match,quoted_text))
-                        throw file_error(EXCEPTION_RECORD,
-                                "Cannot find conversion string!");
-                    
-                    if(match.str(0) == "\"x-CBF_BYTE_OFFSET\"")
-                        ct = compression_id::CBF_BYTE_OFFSET;
-                    else
-                        throw file_error(EXCEPTION_RECORD,
-                                "Unknown compression algorithm!");
-
-                }
-
-                //---------------get data type----------------------------
-                if(boost::regex_match(linebuffer,type_regex))
-                {
-                    if(!boost::regex_search(linebuffer,match,quoted_text))
-                        throw file_error(EXCEPTION_RECORD,
-                        "Cannot find data type string!");
-
-                    //set the data type id
-                    if(match.str(0) == "\"signed 32-bit integer\"")
-                    {
-                        tid=type_id_t::INT32;
-                        bits_per_pixel = 32;
-                    }
-                    else
-                        throw file_error(EXCEPTION_RECORD,"Unkown data type!");
-                }
-
-                //---------get number of pixels in y-direction-------------
-                if(boost::regex_match(linebuffer,ny_regex))
-                {
-                    if(!boost::regex_search(linebuffer,match,int_numbers))
-                        throw file_error(EXCEPTION_RECORD,
-                        "Cannot read number of pixels in y-direction!");
-
-                    ny = std::atoi(match.str(0).c_str());
-                }
-
-                //---------get number of pixels in x-direction-------------
-                if(boost::regex_match(linebuffer,nx_regex))
-                {
-                    if(!boost::regex_search(linebuffer,match,int_numbers))
-                        throw file_error(EXCEPTION_RECORD,
-                        "Cannot read number of pixels in x-direction!");
-
-                    nx = std::atoi(match.str(0).c_str());
-                }
+        size_t nbytes = 0;
+        return read_header(is,info,ct,nbytes);
+    }
 
-                linebuffer.clear();
-                continue;
+    //-------------------------------------------------------------------------
+    std::streampos dectris_reader::read_header(std::ifstream &is,
+            std::vector<pni::io::image_info> &info,compression_id &ct,
+            size_t &nbytes)
+    {
+        using namespace pni::core;
 
-            }else{
-                //if there are no other things to do we add the
-                //byte to the linebuffer
-                linebuffer += byte;
-            }
+        //the header is read in large blocks up to the binary section 
+        //marker and parsed from memory
+        std::streampos start = is.tellg();
+        string buffer;
+        size_t offset = read_header_block(is,buffer);
+        if(offset == string::npos)
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot find binary section in the CBF stream!");
+
+        binary_header header = read_header(buffer.data(),
+                                           buffer.data()+offset,info);
+        ct     = header.compression;
+        nbytes = header.binary_size;
+
+        //we most probably have read beyond the marker
+        is.clear();
+        is.seekg(start+static_cast<std::streamoff>(offset));
+        return is.tellg();
+    }
 
-        }
+    //-------------------------------------------------------------------------
+    binary_header dectris_reader::read_header(const char *begin,
+            const char *end,std::vector<pni::io::image_info> &info)
+    {
+        binary_header header = parse_binary_header(begin,end);
 
-        return 0; //just to make the compiler happy
+        image_info iinfo(header.nx,header.ny);
+        iinfo.append_channel(image_channel_info(header.element_type,
+                                                header.element_bits));
+        info.push_back(iinfo);
 
+        return header;
     }
 
 //end of namespace
@@ -28,8 +28,12 @@
 #include<fstream>
 #include<vector>
 
+#include <pni/core/error.hpp>
+
 #include <pni/io/image_info.hpp>
 #include <pni/io/cbf/types.hpp>
+#include <pni/io/cbf/byte_offset.hpp>
+#include <pni/io/cbf/header_parser.hpp>
 #include <pni/io/windows.hpp>
 
 
@@ -63,24 +67,93 @@ namespace cbf{
             static std::streampos read_header(std::ifstream &is,
                     std::vector<pni::io::image_info> &info,compression_id &ct);
 
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief read header information and binary size
+            //!
+            //! In addition to the information provided by the three argument
+            //! version this method returns the size of the binary section 
+            //! in bytes as it is stored in the X-Binary-Size header field. 
+            //! If the header does not provide this field nbytes is set to 0.
+            //!
+            //! \param is input stream from which to read
+            //! \param info ImageInfo vector where to store image data
+            //! \param ct compression id 
+            //! \param nbytes number of bytes in the binary section
+            //! \return position of data section
+            //!
+            static std::streampos read_header(std::ifstream &is,
+                    std::vector<pni::io::image_info> &info,compression_id &ct,
+                    size_t &nbytes);
+
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief read header information from memory
+            //!
+            //! Parses a header which has already been loaded into memory. 
+            //! The image information is appended to info. 
+            //!
+            //! \throws file_error if the header cannot be parsed
+            //!
+            //! \param begin start of the header 
+            //! \param end end of the header 
+            //! \param info ImageInfo vector where to store image data
+            //! \return binary section header
+            //!
+            static binary_header read_header(const char *begin,const char *end,
+                    std::vector<pni::io::image_info> &info);
+
             //-----------------------------------------------------------------
             //!
             //! \brief read data 
             //!
             //! Static method to read byte offset compressed data from 
-            //! DECTRIS CBF files. 
+            //! DECTRIS CBF files. The entire binary section is read from the
+            //! stream with a single call and decoded from memory. The 
+            //! stream must be positioned at the beginning of the binary 
+            //! section. If nbytes is 0 all data up to the end of the stream 
+            //! is read.
+            //!
+            //! \throws file_error if reading from the stream fails
             //!
             //! \tparam CBFT type used for data in the file
             //! \tparam CTYPE container type where to store the data
             //! \param is input stream
             //! \param info instance of ImageInfo for the image to read
             //! \param data container instance where to store the data
+            //! \param nbytes size of the binary section in bytes
             //!
             template<
                      typename CBFT,
                      typename CTYPE
                     >
             static void read_data_byte_offset(std::ifstream &is,
+                                              const pni::io::image_info &info,
+                                              CTYPE &data,
+                                              size_t nbytes=0);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read data from memory
+            //!
+            //! Decodes byte offset compressed data directly from a memory 
+            //! buffer, typically a memory map of the file. 
+            //!
+            //! \throws file_error if the buffer ends before all pixels are
+            //! decoded
+            //!
+            //! \tparam CBFT type used for data in the file
+            //! \tparam CTYPE container type where to store the data
+            //! \param buffer pointer to the first byte of the binary section
+            //! \param nbytes number of bytes available in the buffer
+            //! \param info instance of ImageInfo for the image to read
+            //! \param data container instance where to store the data
+            //!
+            template<
+                     typename CBFT,
+                     typename CTYPE
+                    >
+            static void read_data_byte_offset(const char *buffer,size_t nbytes,
                                               const pni::io::image_info &info,
                                               CTYPE &data);
 
@@ -93,74 +166,39 @@ namespace cbf{
              typename CTYPE
             >
     void dectris_reader::read_data_byte_offset(std::ifstream &is,
-                                 const pni::io::image_info &, CTYPE &data)
+                                 const pni::io::image_info &, CTYPE &data,
+                                 size_t nbytes)
     {
         using namespace pni::core;
-        //unsigned long i;
-        //size_t ecnt = 0; // element counter
-        //?? CBFT buffer = 0; // single element buffer
-        unsigned int  buffer = 0; // single element buffer
-
-        //initializing the container with 0
-        std::fill(data.begin(),data.end(),0);
-        // typename CTYPE::iterator iter = data.begin();
-        typename CTYPE::value_type v_old = 0;
 
-        for(typename CTYPE::value_type &v: data)
+        //if the size of the binary section is unknown we read everything
+        //up to the end of the stream
+        if(!nbytes)
         {
-            v = v_old; //set the new value to the previous
-
-            buffer = 0; //reset the read buffer
-            //read one byte from the stream an throw an exception in case of an
-            //error
-            try { is.read((char *)(&buffer),1); }
-            catch(...)
-            {
-                throw file_error(EXCEPTION_RECORD,
-                        "Error reading 1Byte from the CBF stream!");
-            }
-
-            if (((unsigned char) buffer) != 0x80)
-            {
-                v += (char) buffer;
-                v_old = v;
-                continue;
-            }
-          
-            //read two byte from the stream and throw an exception in case of an
-            //error
-            try { is.read((char *) (&buffer), 2); }
-            catch(...)
-            {
-                throw file_error(EXCEPTION_RECORD,
-                        "Error reading 2Byte from the CBF stream!");
-            }
-
-            if (((unsigned short) buffer) != 0x8000) 
-            {
-                v += (short) buffer;
-                v_old = v;
-                continue;
-            }
-
-            //read 4 byte from the stream and throw an exception in the case of
-            //an error
-            try { is.read((char*) (&buffer), 4); }
-            catch(...)
-            {
-                throw file_error(EXCEPTION_RECORD,
-                        "Error reading 4byte from the CBF stream!");
-            }
-
-            if (((uint32_t) buffer) != 0x80000000)
-            {
-                v += (int32_t) buffer;
-                v_old = v;
-                continue;
-            }
-
+            std::streampos start = is.tellg();
+            is.seekg(0,std::ios::end);
+            nbytes = static_cast<size_t>(is.tellg()-start);
+            is.seekg(start);
         }
 
+        std::vector<char> buffer(nbytes);
+        if(!is.read(buffer.data(),static_cast<std::streamsize>(nbytes)))
+            throw file_error(EXCEPTION_RECORD,
+                    "Error reading binary section from the CBF stream!");
+
+        decode_byte_offset(buffer.data(),buffer.size(),data);
+    }
+
+    //-------------------------------------------------------------------------
+    template<
+             typename CBFT,
+             typename CTYPE
+            >
+    void dectris_reader::read_data_byte_offset(const char *buffer,
+                                 size_t nbytes,const pni::io::image_info &,
+                                 CTYPE &data)
+    {
+        decode_byte_offset(buffer,nbytes,data);
     }
 
 //end of namespace
@@ -0,0 +1,342 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/header_parser.hpp>
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    using namespace pni::core;
+
+    namespace{
+
+        //! the byte terminating the header
+        const char binary_marker = static_cast<char>(0xd5);
+
+        //! block size used to read the header
+        const size_t block_size = 4096;
+
+        //---------------------------------------------------------------------
+        // a line of the header without the line terminator
+        struct line_type
+        {
+            const char *begin;
+            const char *end;
+
+            //check if the line starts with a key
+            bool starts_with(const char *key,size_t n) const
+            {
+                return static_cast<size_t>(end-begin)>=n &&
+                       std::memcmp(begin,key,n)==0;
+            }
+
+            //find a string within the line
+            const char *find(const char *s,size_t n) const
+            {
+                for(const char *p=begin;end-p>=static_cast<std::ptrdiff_t>(n);++p)
+                    if(std::memcmp(p,s,n)==0) return p;
+                return nullptr;
+            }
+        };
+
+        //---------------------------------------------------------------------
+        // get the next line from [ptr,end) and advance ptr to the first
+        // character after the line terminator
+        line_type next_line(const char *&ptr,const char *end)
+        {
+            line_type line;
+            line.begin = ptr;
+            const char *nl = static_cast<const char*>(
+                    std::memchr(ptr,'\n',end-ptr));
+            line.end = nl ? nl : end;
+            ptr = nl ? nl+1 : end;
+
+            if(line.end!=line.begin && *(line.end-1)=='\r') --line.end;
+            return line;
+        }
+
+        //---------------------------------------------------------------------
+        // extract the first quoted string (including the quotes) from
+        // [begin,end)
+        bool quoted_text(const char *begin,const char *end,string &text)
+        {
+            const char *first = static_cast<const char*>(
+                    std::memchr(begin,'"',end-begin));
+            if(!first) return false;
+
+            //the match is greedy as the original regular expression
+            const char *last = end;
+            while(last!=first+1 && *(last-1)!='"') --last;
+            if(last==first+1) return false;
+
+            text.assign(first,last);
+            return true;
+        }
+
+        //---------------------------------------------------------------------
+        // parse the first unsigned integer in [begin,end)
+        bool unsigned_value(const char *begin,const char *end,size_t &value)
+        {
+            while(begin!=end && (*begin<'0' || *begin>'9')) ++begin;
+            if(begin==end) return false;
+
+            value = 0;
+            for(;begin!=end && *begin>='0' && *begin<='9';++begin)
+                value = 10*value+(*begin-'0');
+            return true;
+        }
+
+        //---------------------------------------------------------------------
+        // trimmed value after the key
+        string string_value(const char *begin,const char *end)
+        {
+            while(begin!=end && (*begin==' ' || *begin=='\t')) ++begin;
+            while(end!=begin && (*(end-1)==' ' || *(end-1)=='\t')) --end;
+            return string(begin,end);
+        }
+
+        //---------------------------------------------------------------------
+        // parse the floating point number following the key, the unit is 
+        // ignored
+        void float_value(const char *begin,const char *end,float64 &value)
+        {
+            string text(begin,end);
+            char *stop = nullptr;
+            float64 v = std::strtod(text.c_str(),&stop);
+            if(stop!=text.c_str()) value = v;
+        }
+    }
+
+#define KEY(s) s,sizeof(s)-1
+
+    //-------------------------------------------------------------------------
+    binary_header::binary_header():
+        compression(compression_id::CBF_BYTE_OFFSET),
+        element_type(type_id_t::NONE),
+        element_bits(0),
+        nx(0),
+        ny(0),
+        binary_size(0),
+        nelements(0),
+        md5()
+    {}
+
+    //-------------------------------------------------------------------------
+    minicbf_header::minicbf_header():
+        detector(),
+        timestamp(),
+        exposure_time(std::numeric_limits<float64>::quiet_NaN()),
+        exposure_period(std::numeric_limits<float64>::quiet_NaN()),
+        start_angle(std::numeric_limits<float64>::quiet_NaN()),
+        angle_increment(std::numeric_limits<float64>::quiet_NaN()),
+        detector_2theta(std::numeric_limits<float64>::quiet_NaN())
+    {}
+
+    //-------------------------------------------------------------------------
+    size_t read_header_block(std::istream &is,string &buffer)
+    {
+        size_t searched = buffer.size();
+
+        while(is)
+        {
+            size_t size = buffer.size();
+            buffer.resize(size+block_size);
+            is.read(&buffer[size],block_size);
+            buffer.resize(size+static_cast<size_t>(is.gcount()));
+
+            size_t pos = buffer.find(binary_marker,searched);
+            if(pos!=string::npos) return pos+1;
+            searched = buffer.size();
+        }
+
+        return string::npos;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t find_header_end(const char *data,size_t size)
+    {
+        const char *marker = static_cast<const char*>(
+                std::memchr(data,binary_marker,size));
+        return marker ? static_cast<size_t>(marker-data)+1 : string::npos;
+    }
+
+    //-------------------------------------------------------------------------
+    string header_convention(const char *begin,const char *end)
+    {
+        const char *ptr = begin;
+        while(ptr!=end)
+        {
+            line_type line = next_line(ptr,end);
+            if(line.starts_with(KEY("_array_data.header_convention")))
+            {
+                string text;
+                quoted_text(line.begin,line.end,text);
+                return text;
+            }
+        }
+
+        return string();
+    }
+
+    //-------------------------------------------------------------------------
+    binary_header parse_binary_header(const char *begin,const char *end)
+    {
+        binary_header header;
+        bool has_compression = false;
+        const char *ptr = begin;
+
+        while(ptr!=end)
+        {
+            line_type line = next_line(ptr,end);
+            string text;
+
+            //--------------get compression algorithm------------------
+            if(const char *p = line.find(KEY("conversions=")))
+            {
+                if(!quoted_text(p,line.end,text))
+                    throw file_error(EXCEPTION_RECORD,
+                            "Cannot find conversion string!");
+
+                if(text == "\"x-CBF_BYTE_OFFSET\"")
+                    header.compression = compression_id::CBF_BYTE_OFFSET;
+                else
+                    throw file_error(EXCEPTION_RECORD,
+                            "Unknown compression algorithm!");
+
+                has_compression = true;
+            }
+            //---------------get data type----------------------------
+            else if(line.starts_with(KEY("X-Binary-Element-Type:")))
+            {
+                if(!quoted_text(line.begin,line.end,text))
+                    throw file_error(EXCEPTION_RECORD,
+                            "Cannot find data type string!");
+
+                if(text == "\"signed 32-bit integer\"")
+                {
+                    header.element_type = type_id_t::INT32;
+                    header.element_bits = 32;
+                }
+                else if(text == "\"signed 16-bit integer\"")
+                {
+                    header.element_type = type_id_t::INT16;
+                    header.element_bits = 16;
+                }
+                else
+                    throw file_error(EXCEPTION_RECORD,"Unkown data type!");
+            }
+            //---------get number of pixels in y-direction-------------
+            else if(line.starts_with(KEY("X-Binary-Size-Fastest-Dimension:")))
+            {
+                if(!unsigned_value(line.begin,line.end,header.ny))
+                    throw file_error(EXCEPTION_RECORD,
+                            "Cannot read number of pixels in y-direction!");
+            }
+            //---------get number of pixels in x-direction-------------
+            else if(line.starts_with(KEY("X-Binary-Size-Second-Dimension:")))
+            {
+                if(!unsigned_value(line.begin,line.end,header.nx))
+                    throw file_error(EXCEPTION_RECORD,
+                            "Cannot read number of pixels in x-direction!");
+            }
+            //---------get the size of the binary section--------------
+            else if(line.starts_with(KEY("X-Binary-Size:")))
+            {
+                if(!unsigned_value(line.begin,line.end,header.binary_size))
+                    throw file_error(EXCEPTION_RECORD,
+                            "Cannot read size of the binary section!");
+            }
+            //---------get the number of elements----------------------
+            else if(line.starts_with(KEY("X-Binary-Number-of-Elements:")))
+            {
+                if(!unsigned_value(line.begin,line.end,header.nelements))
+                    throw file_error(EXCEPTION_RECORD,
+                            "Cannot read number of elements!");
+            }
+            //---------get the MD5 checksum----------------------------
+            else if(line.starts_with(KEY("Content-MD5:")))
+            {
+                header.md5 = string_value(line.begin+sizeof("Content-MD5:")-1,
+                                          line.end);
+            }
+        }
+
+        if(!has_compression || header.element_type == type_id_t::NONE ||
+           !header.nx || !header.ny)
+            throw file_error(EXCEPTION_RECORD,
+                    "Incomplete binary section header!");
+
+        return header;
+    }
+
+    //-------------------------------------------------------------------------
+    minicbf_header parse_minicbf_header(const char *begin,const char *end)
+    {
+        minicbf_header header;
+        const char *ptr = begin;
+
+        while(ptr!=end)
+        {
+            line_type line = next_line(ptr,end);
+            if(!line.starts_with(KEY("# "))) continue;
+            const char *value = line.begin+2;
+
+#define FLOAT_KEY(s,field)\
+            if(line.starts_with(KEY("# " s " ")))\
+            {\
+                float_value(value+sizeof(s),line.end,header.field);\
+                continue;\
+            }
+
+            FLOAT_KEY("Exposure_time",exposure_time)
+            FLOAT_KEY("Exposure_period",exposure_period)
+            FLOAT_KEY("Start_angle",start_angle)
+            FLOAT_KEY("Angle_increment",angle_increment)
+            FLOAT_KEY("Detector_2theta",detector_2theta)
+#undef FLOAT_KEY
+
+            if(line.starts_with(KEY("# Detector:")))
+                header.detector = string_value(value+sizeof("Detector:")-1,
+                                               line.end);
+            //the timestamp is the only line starting with a year
+            else if(header.timestamp.empty() && line.end-value>=5 &&
+                    value[4]=='-' && 
+                    std::strspn(value,"0123456789")==4)
+                header.timestamp = string_value(value,line.end);
+        }
+
+        return header;
+    }
+
+#undef KEY
+
+//end of namespace
+}
+}
+}
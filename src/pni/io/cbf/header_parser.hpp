@@ -0,0 +1,177 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <iostream>
+#include <pni/core/types.hpp>
+#include <pni/io/cbf/types.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief binary section header
+    //!
+    //! Holds the MIME header fields describing the binary section of a CBF
+    //! file. Numeric fields which are not present in the header are 0,
+    //! string fields are empty.
+    //!
+    struct PNIIO_EXPORT binary_header
+    {
+        //! compression algorithm (conversions)
+        compression_id compression;
+        //! element type (X-Binary-Element-Type)
+        pni::core::type_id_t element_type;
+        //! number of bits per element
+        size_t element_bits;
+        //! number of pixels along the slow dimension
+        size_t nx;
+        //! number of pixels along the fast dimension
+        size_t ny;
+        //! size of the binary section in bytes (X-Binary-Size)
+        size_t binary_size;
+        //! number of elements (X-Binary-Number-of-Elements)
+        size_t nelements;
+        //! MD5 checksum of the binary section (Content-MD5)
+        pni::core::string md5;
+
+        //! default constructor
+        binary_header();
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief miniCBF header contents
+    //!
+    //! Values stored in the _array_data.header_contents section written by
+    //! Pilatus detectors. Numeric values which are not present in the header
+    //! are NaN, string values are empty.
+    //!
+    struct PNIIO_EXPORT minicbf_header
+    {
+        //! detector name and serial number (Detector:)
+        pni::core::string detector;
+        //! acquisition timestamp as written by the detector
+        pni::core::string timestamp;
+        //! exposure time in seconds (Exposure_time)
+        pni::core::float64 exposure_time;
+        //! exposure period in seconds (Exposure_period)
+        pni::core::float64 exposure_period;
+        //! start angle in degrees (Start_angle)
+        pni::core::float64 start_angle;
+        //! angle increment in degrees (Angle_increment)
+        pni::core::float64 angle_increment;
+        //! detector 2theta angle in degrees (Detector_2theta)
+        pni::core::float64 detector_2theta;
+
+        //! default constructor
+        minicbf_header();
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief read the header of a CBF file into a buffer
+    //!
+    //! Reads the stream from its current position in large blocks into
+    //! buffer until the binary section marker (0xD5) has been read. The
+    //! buffer may contain data beyond the marker.
+    //!
+    //! \param is input stream
+    //! \param buffer string receiving the header data
+    //! \return offset of the first byte after the marker in the buffer or
+    //! string::npos if the stream ended before the marker was found
+    //!
+    PNIIO_EXPORT size_t read_header_block(std::istream &is,
+                                          pni::core::string &buffer);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief find the end of the header in memory
+    //!
+    //! \param data pointer to the first byte of the file
+    //! \param size number of bytes available
+    //! \return offset of the first byte after the binary section marker 
+    //! (0xD5) or string::npos if the marker was not found
+    //!
+    PNIIO_EXPORT size_t find_header_end(const char *data,size_t size);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief get the header convention
+    //!
+    //! Searches the buffer for the _array_data.header_convention key and
+    //! returns its quoted value (including the quotes).
+    //!
+    //! \param begin start of the header
+    //! \param end end of the header
+    //! \return header convention or an empty string if not found
+    //!
+    PNIIO_EXPORT pni::core::string header_convention(const char *begin,
+                                                     const char *end);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief parse a binary section header
+    //!
+    //! Tokenizes the header in [begin,end) line by line and recognizes the
+    //! MIME keys of the binary section with plain string comparison. 
+    //! Lines with unknown keys are ignored.
+    //!
+    //! \throws file_error if a known key cannot be parsed, the compression
+    //! algorithm or element type is not supported, or mandatory keys are
+    //! missing
+    //!
+    //! \param begin start of the header
+    //! \param end end of the header
+    //! \return header information
+    //!
+    PNIIO_EXPORT binary_header parse_binary_header(const char *begin,
+                                                   const char *end);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief parse the miniCBF header contents
+    //!
+    //! Parses the "# key value" lines of a Dectris header. Unknown keys and
+    //! values which cannot be converted are ignored.
+    //!
+    //! \param begin start of the header
+    //! \param end end of the header
+    //! \return miniCBF header values
+    //!
+    PNIIO_EXPORT minicbf_header parse_minicbf_header(const char *begin,
+                                                     const char *end);
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,518 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/scan_index.hpp>
+#include <pni/io/cbf/cbf_batch_reader.hpp>
+
+#ifdef _WIN32
+#include <ctime>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace fs = boost::filesystem;
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    using namespace pni::core;
+
+    namespace{
+
+        //---------------------------------------------------------------------
+        // Layout of the index file (all values in host byte order)
+        //
+        // magic[8] | uint32 byte order mark | uint32 version |
+        // string pattern | uint64 nrecords | records ...
+        //
+        // where each string is stored as uint32 length followed by the
+        // characters.
+        //---------------------------------------------------------------------
+        const char   index_magic[8] = {'P','N','I','C','B','F','I','X'};
+        const uint32 index_bom      = 0x01020304;
+        const uint32 index_version  = 2;
+
+        //---------------------------------------------------------------------
+        // serialization of the index into a memory buffer
+        class index_writer
+        {
+            private:
+                string &_buffer;
+            public:
+                explicit index_writer(string &buffer):_buffer(buffer) {}
+
+                template<typename T> void put(const T &value)
+                {
+                    _buffer.append(reinterpret_cast<const char*>(&value),
+                                   sizeof(T));
+                }
+
+                void put(const string &s)
+                {
+                    put(static_cast<uint32>(s.size()));
+                    _buffer.append(s);
+                }
+        };
+
+        //---------------------------------------------------------------------
+        // deserialization from a memory buffer with bounds checking
+        class index_parser
+        {
+            private:
+                const char *_ptr;
+                const char *_end;
+
+                void check(size_t n) const
+                {
+                    if(static_cast<size_t>(_end-_ptr)<n)
+                        throw file_error(EXCEPTION_RECORD,
+                                "Index file is truncated!");
+                }
+            public:
+                index_parser(const char *begin,const char *end):
+                    _ptr(begin),
+                    _end(end)
+                {}
+
+                template<typename T> void get(T &value)
+                {
+                    check(sizeof(T));
+                    std::memcpy(&value,_ptr,sizeof(T));
+                    _ptr += sizeof(T);
+                }
+
+                void get(string &s)
+                {
+                    uint32 n;
+                    get(n);
+                    check(n);
+                    s.assign(_ptr,n);
+                    _ptr += n;
+                }
+
+                void get(const char *data,size_t n)
+                {
+                    check(n);
+                    if(std::memcmp(_ptr,data,n)!=0)
+                        throw file_error(EXCEPTION_RECORD,
+                                "File is not a CBF scan index!");
+                    _ptr += n;
+                }
+        };
+
+        //---------------------------------------------------------------------
+        template<typename T> void put_size(index_writer &w,T value)
+        {
+            w.put(static_cast<uint64>(value));
+        }
+
+        template<typename T> void get_size(index_parser &p,T &value)
+        {
+            uint64 v;
+            p.get(v);
+            value = static_cast<T>(v);
+        }
+
+        //---------------------------------------------------------------------
+        // path of a file as stored in the index file - relative to the
+        // directory of the index if the file is located below it, otherwise
+        // absolute. Thus, the index does not depend on the working directory.
+        string index_path(const fs::path &file,const fs::path &directory)
+        {
+            fs::path f = fs::absolute(file);
+            fs::path d = fs::absolute(directory);
+
+            auto fiter = f.begin();
+            for(auto diter = d.begin();diter!=d.end();++diter,++fiter)
+                if(fiter == f.end() || *fiter != *diter) return f.string();
+
+            fs::path result;
+            for(;fiter!=f.end();++fiter) result /= *fiter;
+            return result.string();
+        }
+
+        //---------------------------------------------------------------------
+        // size and modification time (in ns) of a file - false if the file
+        // does not exist
+        bool get_file_stat(const string &fname,size_t &size,int64 &time)
+        {
+#ifdef _WIN32
+            boost::system::error_code error;
+            uintmax_t s = fs::file_size(fname,error);
+            if(error) return false;
+
+            std::time_t t = fs::last_write_time(fname,error);
+            if(error) return false;
+
+            size = static_cast<size_t>(s);
+            time = static_cast<int64>(t)*1000000000;
+#else
+            struct stat st;
+            if(::stat(fname.c_str(),&st)!=0) return false;
+
+            size = static_cast<size_t>(st.st_size);
+#ifdef __APPLE__
+            const struct timespec &t = st.st_mtimespec;
+#else
+            const struct timespec &t = st.st_mtim;
+#endif
+            time = static_cast<int64>(t.tv_sec)*1000000000+t.tv_nsec;
+#endif
+            return true;
+        }
+
+        //---------------------------------------------------------------------
+        // the element types and compressions parse_binary_header accepts
+        bool is_valid_element_type(uint8 type_id)
+        {
+            return type_id == static_cast<uint8>(type_id_t::INT16) ||
+                   type_id == static_cast<uint8>(type_id_t::INT32);
+        }
+
+        bool is_valid_compression(uint8 compression)
+        {
+            return compression ==
+                   static_cast<uint8>(compression_id::CBF_BYTE_OFFSET);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    frame_record::frame_record():
+        file(),
+        nx(0),
+        ny(0),
+        element_type(type_id_t::NONE),
+        element_bits(0),
+        compression(compression_id::CBF_BYTE_OFFSET),
+        data_offset(0),
+        data_size(0),
+        file_size(0),
+        file_time(0),
+        header()
+    {}
+
+    //-------------------------------------------------------------------------
+    image_info frame_record::info() const
+    {
+        image_info i(nx,ny);
+        i.append_channel(image_channel_info(element_type,element_bits));
+        return i;
+    }
+
+    //-------------------------------------------------------------------------
+    bool frame_record::is_stale() const
+    {
+        size_t size;
+        int64 time;
+        if(!get_file_stat(file,size,time)) return true;
+
+        return size != file_size || time != file_time;
+    }
+
+    //-------------------------------------------------------------------------
+    frame_record read_frame_record(const string &fname)
+    {
+        //the file is stat-ed before reading so that a modification while
+        //the header is read makes the record stale
+        size_t file_size = 0;
+        int64 file_time = 0;
+        get_file_stat(fname,file_size,file_time);
+
+        std::ifstream stream(fname.c_str(),std::ios::binary);
+        if(!stream.is_open())
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot open file ["+fname+"]!");
+
+        string buffer;
+        size_t offset = read_header_block(stream,buffer);
+        if(offset == string::npos)
+            throw file_error(EXCEPTION_RECORD,
+                    "File ["+fname+"] is most probably not a CBF file!");
+
+        const char *begin = buffer.data();
+        const char *end   = begin+offset;
+
+        frame_record record;
+        binary_header binary = parse_binary_header(begin,end);
+        record.file         = fname;
+        record.nx           = binary.nx;
+        record.ny           = binary.ny;
+        record.element_type = binary.element_type;
+        record.element_bits = binary.element_bits;
+        record.compression  = binary.compression;
+        record.data_offset  = offset;
+        record.data_size    = binary.binary_size;
+        record.file_size    = file_size;
+        record.file_time    = file_time;
+        record.header       = parse_minicbf_header(begin,end);
+
+        return record;
+    }
+
+    //=========================================================================
+    const string scan_index::index_name = ".pniio_cbf_index";
+
+    //-------------------------------------------------------------------------
+    scan_index::scan_index():
+        _pattern(),
+        _records()
+    {}
+
+    //-------------------------------------------------------------------------
+    scan_index scan_index::build(const string &directory,const string &pattern)
+    {
+        scan_index index;
+        index._pattern = pattern;
+
+        auto files = glob((fs::path(directory)/pattern).string());
+        index._records.reserve(files.size());
+        for(const auto &file: files)
+            index._records.push_back(read_frame_record(file));
+
+        return index;
+    }
+
+    //-------------------------------------------------------------------------
+    scan_index scan_index::open(const string &directory,const string &pattern,
+                                bool rebuild)
+    {
+        string fname = (fs::path(directory)/index_name).string();
+
+        scan_index index;
+        if(!rebuild && fs::exists(fname))
+        {
+            try
+            {
+                scan_index cached = load(fname);
+                if(cached.pattern() == pattern)
+                    index = std::move(cached);
+            }
+            catch(file_error &)
+            {
+                //a broken index file is simply replaced
+            }
+        }
+
+        if(index.size())
+        {
+            //reuse the records of all files which have not been modified
+            std::map<string,const frame_record*> cached;
+            for(const auto &r: index._records)
+                cached[fs::path(r.file).filename().string()] = &r;
+
+            auto files = glob((fs::path(directory)/pattern).string());
+            bool modified = files.size() != index.size();
+
+            scan_index current;
+            current._pattern = pattern;
+            current._records.reserve(files.size());
+            for(const auto &file: files)
+            {
+                auto iter = cached.find(fs::path(file).filename().string());
+                if(iter != cached.end() && !iter->second->is_stale())
+                {
+                    current._records.push_back(*iter->second);
+                    current._records.back().file = file;
+                }
+                else
+                {
+                    current._records.push_back(read_frame_record(file));
+                    modified = true;
+                }
+            }
+
+            if(!modified) return current;
+            index = std::move(current);
+        }
+        else
+            index = build(directory,pattern);
+
+        try
+        {
+            index.save(fname);
+        }
+        catch(file_error &)
+        {
+            //the scan directory may be read only
+        }
+        return index;
+    }
+
+    //-------------------------------------------------------------------------
+    scan_index scan_index::load(const string &fname)
+    {
+        std::ifstream stream(fname.c_str(),std::ios::binary|std::ios::ate);
+        if(!stream.is_open())
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot open index file ["+fname+"]!");
+
+        //read the entire file at once
+        string buffer(static_cast<size_t>(stream.tellg()),'\0');
+        stream.seekg(0);
+        stream.read(&buffer[0],buffer.size());
+        if(!stream)
+            throw file_error(EXCEPTION_RECORD,
+                    "Error reading index file ["+fname+"]!");
+
+        index_parser p(buffer.data(),buffer.data()+buffer.size());
+        p.get(index_magic,sizeof(index_magic));
+
+        uint32 bom,version;
+        p.get(bom);
+        p.get(version);
+        if(bom != index_bom || version != index_version)
+            throw file_error(EXCEPTION_RECORD,
+                    "Index file ["+fname+"] has an incompatible format!");
+
+        scan_index index;
+        p.get(index._pattern);
+
+        size_t nrecords;
+        get_size(p,nrecords);
+        //each record occupies far more than a single byte
+        if(nrecords>buffer.size())
+            throw file_error(EXCEPTION_RECORD,"Index file is corrupted!");
+
+        fs::path directory = fs::path(fname).parent_path();
+        index._records.resize(nrecords);
+        for(auto &r: index._records)
+        {
+            string file;
+            p.get(file);
+            fs::path path(file);
+            r.file = path.is_absolute() ? file : (directory/path).string();
+
+            get_size(p,r.nx);
+            get_size(p,r.ny);
+            uint8 type_id,compression;
+            p.get(type_id);
+            p.get(compression);
+            if(!is_valid_element_type(type_id) ||
+               !is_valid_compression(compression))
+                throw file_error(EXCEPTION_RECORD,"Index file is corrupted!");
+
+            r.element_type = static_cast<type_id_t>(type_id);
+            r.compression  = static_cast<compression_id>(compression);
+            get_size(p,r.element_bits);
+            get_size(p,r.data_offset);
+            get_size(p,r.data_size);
+            get_size(p,r.file_size);
+            p.get(r.file_time);
+
+            p.get(r.header.detector);
+            p.get(r.header.timestamp);
+            p.get(r.header.exposure_time);
+            p.get(r.header.exposure_period);
+            p.get(r.header.start_angle);
+            p.get(r.header.angle_increment);
+            p.get(r.header.detector_2theta);
+        }
+
+        return index;
+    }
+
+    //-------------------------------------------------------------------------
+    void scan_index::save(const string &fname) const
+    {
+        string buffer;
+        index_writer w(buffer);
+
+        buffer.append(index_magic,sizeof(index_magic));
+        w.put(index_bom);
+        w.put(index_version);
+        w.put(_pattern);
+        put_size(w,_records.size());
+
+        fs::path directory = fs::path(fname).parent_path();
+        for(const auto &r: _records)
+        {
+            w.put(index_path(r.file,directory));
+
+            put_size(w,r.nx);
+            put_size(w,r.ny);
+            w.put(static_cast<uint8>(r.element_type));
+            w.put(static_cast<uint8>(r.compression));
+            put_size(w,r.element_bits);
+            put_size(w,r.data_offset);
+            put_size(w,r.data_size);
+            put_size(w,r.file_size);
+            w.put(r.file_time);
+
+            w.put(r.header.detector);
+            w.put(r.header.timestamp);
+            w.put(r.header.exposure_time);
+            w.put(r.header.exposure_period);
+            w.put(r.header.start_angle);
+            w.put(r.header.angle_increment);
+            w.put(r.header.detector_2theta);
+        }
+
+        //write to a temporary file first so that concurrent readers never
+        //see a partially written index
+        string tmp = fname+".tmp";
+        {
+            std::ofstream stream(tmp.c_str(),std::ios::binary|std::ios::trunc);
+            if(!stream.is_open())
+                throw file_error(EXCEPTION_RECORD,
+                        "Cannot open index file ["+tmp+"]!");
+
+            stream.write(buffer.data(),buffer.size());
+            if(!stream)
+                throw file_error(EXCEPTION_RECORD,
+                        "Error writing index file ["+tmp+"]!");
+        }
+
+        boost::system::error_code error;
+        fs::rename(tmp,fname,error);
+        if(error)
+        {
+            fs::remove(tmp,error);
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot create index file ["+fname+"]!");
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    const frame_record &scan_index::at(size_t i) const
+    {
+        if(i>=_records.size())
+        {
+            std::stringstream ss;
+            ss<<"Frame index "<<i<<" exceeds number of frames ("
+              <<_records.size()<<")!";
+            throw index_error(EXCEPTION_RECORD,ss.str());
+        }
+        return _records[i];
+    }
+
+//end of namespace
+}
+}
+}
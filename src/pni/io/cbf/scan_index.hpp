@@ -0,0 +1,232 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/image_info.hpp>
+#include <pni/io/cbf/header_parser.hpp>
+#include <pni/io/cbf/types.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace cbf{
+
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief metadata of a single CBF file
+    //!
+    //! Everything required to read the image data of a CBF file without
+    //! parsing its header again.
+    //!
+    struct PNIIO_EXPORT frame_record
+    {
+        //! path to the file
+        pni::core::string file;
+        //! number of pixels along the slow dimension
+        size_t nx;
+        //! number of pixels along the fast dimension
+        size_t ny;
+        //! element type of the binary section
+        pni::core::type_id_t element_type;
+        //! number of bits per element
+        size_t element_bits;
+        //! compression algorithm
+        compression_id compression;
+        //! offset of the binary section in the file
+        size_t data_offset;
+        //! size of the binary section in bytes
+        size_t data_size;
+        //! size of the file when the record was created
+        size_t file_size;
+        //! modification time of the file in ns when the record was created
+        pni::core::int64 file_time;
+        //! miniCBF header values
+        minicbf_header header;
+
+        //! default constructor
+        frame_record();
+
+        //! get the image information of the frame
+        image_info info() const;
+
+        //!
+        //! \brief check if the file was modified
+        //!
+        //! Compares size and modification time of the file with the values
+        //! stored in the record. The header of the file is not read.
+        //!
+        //! \return true if the file does not exist or has been modified
+        //!
+        bool is_stale() const;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief read the metadata of a CBF file
+    //!
+    //! Reads only the header of the file. The binary section is not touched.
+    //!
+    //! \throws file_error if the file cannot be opened or is not a CBF file
+    //! \param fname name of the file
+    //! \return metadata record
+    //!
+    PNIIO_EXPORT frame_record read_frame_record(const pni::core::string &fname);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_cbf
+    //! \brief metadata index of a CBF scan
+    //!
+    //! A scan index holds a frame_record for every file of a scan. Building
+    //! the index reads only the file headers. The index can be stored in a
+    //! compact binary sidecar file next to the data so that a scan can be
+    //! re-opened with a single read without parsing any CBF header. A
+    //! cbf_reader constructed from a record of the index seeks directly to
+    //! the binary section of the file.
+    //!
+    //! \code
+    //! auto index = cbf::scan_index::open("/data/scan_0001");
+    //! cbf_reader reader(index[42]);
+    //! auto frame = reader.image<std::vector<int32>>(0);
+    //! \endcode
+    //!
+    class PNIIO_EXPORT scan_index
+    {
+        private:
+#ifdef _MSC_VER
+#pragma warning(disable:4251)
+#endif
+            //! glob pattern used to collect the files
+            pni::core::string _pattern;
+            //! records of all files
+            std::vector<frame_record> _records;
+#ifdef _MSC_VER
+#pragma warning(default:4251)
+#endif
+        public:
+            //! name of the sidecar index file within the scan directory
+            static const pni::core::string index_name;
+
+            typedef std::vector<frame_record>::const_iterator const_iterator;
+
+            //-----------------------------------------------------------------
+            //! default constructor - an empty index
+            scan_index();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief build an index
+            //!
+            //! Parses the header of all files in the directory matching
+            //! pattern. The files are sorted by name.
+            //!
+            //! \throws file_error if a file cannot be read
+            //! \param directory scan directory
+            //! \param pattern glob pattern for the file names
+            //! \return new index
+            //!
+            static scan_index build(const pni::core::string &directory,
+                                    const pni::core::string &pattern="*.cbf");
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief open the index of a scan
+            //!
+            //! If the directory contains an index file built for the same
+            //! pattern it is loaded. Otherwise the index is built and written
+            //! to the directory. If the directory is not writable the index
+            //! is built on every call.
+            //!
+            //! A loaded index is checked against the directory: only the
+            //! headers of files which have been added or whose size or
+            //! modification time changed are read. Records of removed files
+            //! are dropped. If anything changed the index file is updated.
+            //! Use rebuild=true to read all headers again.
+            //!
+            //! \throws file_error if a file cannot be read
+            //! \param directory scan directory
+            //! \param pattern glob pattern for the file names
+            //! \param rebuild ignore an existing index file
+            //! \return scan index
+            //!
+            static scan_index open(const pni::core::string &directory,
+                                   const pni::core::string &pattern="*.cbf",
+                                   bool rebuild=false);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief load an index file
+            //!
+            //! Relative file names in the index are relative to the directory
+            //! of the index file.
+            //!
+            //! \throws file_error if the file cannot be read or is not a
+            //! valid index file
+            //! \param fname name of the index file
+            //! \return scan index
+            //!
+            static scan_index load(const pni::core::string &fname);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write the index to a file
+            //!
+            //! Files located below the directory of the index file are
+            //! stored relative to this directory, all others with their
+            //! absolute path.
+            //!
+            //! \throws file_error if the file cannot be written
+            //! \param fname name of the index file
+            //!
+            void save(const pni::core::string &fname) const;
+
+            //-----------------------------------------------------------------
+            //! get the glob pattern the index was built with
+            const pni::core::string &pattern() const { return _pattern; }
+
+            //! get number of frames
+            size_t size() const { return _records.size(); }
+
+            //! get record of frame i
+            const frame_record &operator[](size_t i) const
+            {
+                return _records[i];
+            }
+
+            //! get record of frame i with range check
+            const frame_record &at(size_t i) const;
+
+            //! iterator to the first record
+            const_iterator begin() const { return _records.begin(); }
+
+            //! iterator to the last record
+            const_iterator end() const { return _records.end(); }
+    };
+
+//end of namespace
+}
+}
+}
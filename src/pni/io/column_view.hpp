@@ -0,0 +1,375 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup ascii_io
+    //! \brief description of a column kept in memory by a reader
+    //!
+    struct column_buffer
+    {
+        const void *data;           //!< pointer to the first value
+        pni::core::type_id_t type;  //!< type of the values
+        size_t size;                //!< number of values
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup ascii_io
+    //! \brief random access iterator over values accessed by index
+    //!
+    //! \tparam VIEWT view type providing operator[]
+    //! \tparam VALUET type returned by the view
+    //!
+    template<typename VIEWT,typename VALUET>
+    class index_iterator
+    {
+        private:
+            const VIEWT *_view; //!< the view
+            std::ptrdiff_t _index; //!< current index
+        public:
+            //=====================public types================================
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef VALUET value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const VALUET *pointer;
+            typedef VALUET reference;
+
+            //=====================constructors================================
+            //! default constructor
+            index_iterator():_view(nullptr),_index(0) {}
+
+            //! constructor
+            index_iterator(const VIEWT *view,std::ptrdiff_t index):
+                _view(view),
+                _index(index)
+            {}
+
+            //=====================operators===================================
+            //! get the current value
+            reference operator*() const { return (*_view)[_index]; }
+
+            //! get the value at an offset
+            reference operator[](difference_type n) const
+            {
+                return (*_view)[_index+n];
+            }
+
+            index_iterator &operator++() { ++_index; return *this; }
+            index_iterator &operator--() { --_index; return *this; }
+            index_iterator operator++(int) { index_iterator i(*this); ++_index; return i; }
+            index_iterator operator--(int) { index_iterator i(*this); --_index; return i; }
+            index_iterator &operator+=(difference_type n) { _index+=n; return *this; }
+            index_iterator &operator-=(difference_type n) { _index-=n; return *this; }
+
+            index_iterator operator+(difference_type n) const
+            {
+                return index_iterator(_view,_index+n);
+            }
+
+            index_iterator operator-(difference_type n) const
+            {
+                return index_iterator(_view,_index-n);
+            }
+
+            difference_type operator-(const index_iterator &i) const
+            {
+                return _index-i._index;
+            }
+
+            bool operator==(const index_iterator &i) const { return _index==i._index; }
+            bool operator!=(const index_iterator &i) const { return _index!=i._index; }
+            bool operator<(const index_iterator &i) const { return _index<i._index; }
+            bool operator>(const index_iterator &i) const { return _index>i._index; }
+            bool operator<=(const index_iterator &i) const { return _index<=i._index; }
+            bool operator>=(const index_iterator &i) const { return _index>=i._index; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup ascii_io
+    //! \brief typed view on a column
+    //!
+    //! A non-owning view on a column kept in memory by a reader. If the
+    //! type of the stored values is T the view refers directly to the
+    //! buffer of the reader and data() returns a pointer to the values.
+    //! Otherwise every value is converted to T when it is accessed.
+    //!
+    //! The view is valid as long as the reader exists and the column is not
+    //! modified (for instance by fio_reader::refresh()).
+    //!
+    //! \tparam T type of the values
+    //!
+    template<typename T>
+    class column_view
+    {
+        private:
+            //! function converting the value at an index to T
+            typedef T (*convert_function)(const void *data,size_t i);
+
+            const void *_data;        //!< the buffer
+            size_t _size;             //!< number of values
+            convert_function _convert; //!< nullptr if the buffer stores T
+
+            //-----------------------------------------------------------------
+            //! convert a value of type S
+            template<typename S>
+            static T _convert_value(const void *data,size_t i)
+            {
+                return static_cast<T>(static_cast<const S*>(data)[i]);
+            }
+
+            //-----------------------------------------------------------------
+            //! get the conversion function for the type of the buffer
+            static convert_function _get_convert(pni::core::type_id_t tid)
+            {
+                using namespace pni::core;
+
+                switch(tid)
+                {
+                    case type_id_t::UINT8:    return &_convert_value<uint8>;
+                    case type_id_t::INT8:     return &_convert_value<int8>;
+                    case type_id_t::UINT16:   return &_convert_value<uint16>;
+                    case type_id_t::INT16:    return &_convert_value<int16>;
+                    case type_id_t::UINT32:   return &_convert_value<uint32>;
+                    case type_id_t::INT32:    return &_convert_value<int32>;
+                    case type_id_t::UINT64:   return &_convert_value<uint64>;
+                    case type_id_t::INT64:    return &_convert_value<int64>;
+                    case type_id_t::FLOAT32:  return &_convert_value<float32>;
+                    case type_id_t::FLOAT64:  return &_convert_value<float64>;
+                    case type_id_t::FLOAT128: return &_convert_value<float128>;
+                    default:
+                        throw type_error(EXCEPTION_RECORD,
+                                "Column values cannot be converted!");
+                }
+            }
+        public:
+            //=====================public types================================
+            typedef T value_type;
+            typedef index_iterator<column_view<T>,T> const_iterator;
+            typedef const_iterator iterator;
+
+            //=====================constructors================================
+            //! default constructor - an empty view
+            column_view():_data(nullptr),_size(0),_convert(nullptr) {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \throws type_error if the values cannot be converted to T
+            //! \param buffer the column buffer
+            //!
+            explicit column_view(const column_buffer &buffer):
+                _data(buffer.data),
+                _size(buffer.size),
+                _convert(buffer.type==pni::core::type_id(T()) ? nullptr :
+                         _get_convert(buffer.type))
+            {}
+
+            //=====================public member functions=====================
+            //! get the number of values
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! true if the view is empty
+            bool empty() const { return !_size; }
+
+            //-----------------------------------------------------------------
+            //! true if the view refers directly to values of type T
+            bool is_contiguous() const { return !_convert; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get a pointer to the values
+            //!
+            //! \return pointer to the first value or nullptr if the values
+            //! are converted
+            //!
+            const T *data() const
+            {
+                return _convert ? nullptr : static_cast<const T*>(_data);
+            }
+
+            //-----------------------------------------------------------------
+            //! get the value at index i without bounds checking
+            T operator[](size_t i) const
+            {
+                return _convert ? _convert(_data,i) : static_cast<const T*>(_data)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get the value at index i
+            //!
+            //! \throws index_error if i exceeds the size of the view
+            //! \param i index of the value
+            //! \return value
+            //!
+            T at(size_t i) const
+            {
+                if(i>=_size)
+                    throw pni::core::index_error(EXCEPTION_RECORD,
+                            "Index "+std::to_string(i)+" exceeds column size "+
+                            std::to_string(_size)+"!");
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the first value
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! get iterator after the last value
+            const_iterator end() const { return const_iterator(this,_size); }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup ascii_io
+    //! \brief view on a single record
+    //!
+    //! Provides access to the values of a record in a set of columns.
+    //!
+    //! \tparam T type of the values
+    //!
+    template<typename T>
+    class record_view
+    {
+        private:
+            const std::vector<column_view<T>> *_columns; //!< the columns
+            size_t _record; //!< index of the record
+        public:
+            //=====================public types================================
+            typedef T value_type;
+            typedef index_iterator<record_view<T>,T> const_iterator;
+            typedef const_iterator iterator;
+
+            //=====================constructors================================
+            //! constructor
+            record_view(const std::vector<column_view<T>> *columns,
+                        size_t record):
+                _columns(columns),
+                _record(record)
+            {}
+
+            //=====================public member functions=====================
+            //! get the index of the record
+            size_t index() const { return _record; }
+
+            //-----------------------------------------------------------------
+            //! get the number of values (columns)
+            size_t size() const { return _columns->size(); }
+
+            //-----------------------------------------------------------------
+            //! get the value of column i in the order the columns were
+            //! requested
+            T operator[](size_t i) const { return (*_columns)[i][_record]; }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the first value
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! get iterator after the last value
+            const_iterator end() const { return const_iterator(this,size()); }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup ascii_io
+    //! \brief range of records in a set of columns
+    //!
+    //! Iterating over the range yields a record_view for every record.
+    //!
+    //! \tparam T type of the values
+    //!
+    template<typename T>
+    class record_range
+    {
+        private:
+            std::vector<column_view<T>> _columns; //!< the columns
+            size_t _size; //!< number of records
+        public:
+            //=====================public types================================
+            typedef record_view<T> value_type;
+            typedef index_iterator<record_range<T>,record_view<T>> const_iterator;
+            typedef const_iterator iterator;
+
+            //=====================constructors================================
+            //!
+            //! \brief constructor
+            //!
+            //! \param columns views on the columns
+            //! \param size number of records
+            //!
+            record_range(std::vector<column_view<T>> columns,size_t size):
+                _columns(std::move(columns)),
+                _size(size)
+            {}
+
+            //-----------------------------------------------------------------
+            //! copy constructor - record views refer to the columns of the
+            //! range
+            record_range(const record_range &r) = default;
+
+            //=====================public member functions=====================
+            //! get the number of records
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! get the number of columns
+            size_t ncolumns() const { return _columns.size(); }
+
+            //-----------------------------------------------------------------
+            //! get the view on column i
+            const column_view<T> &column(size_t i) const { return _columns[i]; }
+
+            //-----------------------------------------------------------------
+            //! get record i
+            record_view<T> operator[](size_t i) const
+            {
+                return record_view<T>(&_columns,i);
+            }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the first record
+            const_iterator begin() const { return const_iterator(this,0); }
+
+            //-----------------------------------------------------------------
+            //! get iterator after the last record
+            const_iterator end() const { return const_iterator(this,_size); }
+    };
+
+//end of namespace
+}
+}
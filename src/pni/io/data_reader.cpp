@@ -54,7 +54,10 @@ namespace io{
     data_reader::data_reader():
         _fname(),
         _is_binary(true),
-        _istream(nullptr)
+        _istream(nullptr),
+        _map(nullptr),
+        _use_map(true),
+        _map_failed(false)
     {}
 
     //-------------------------------------------------------------------------
@@ -62,7 +65,10 @@ namespace io{
     data_reader::data_reader(const pni::core::string &fname,bool binary):
         _fname(fname),
         _is_binary(binary),
-        _istream(_open_stream(fname))
+        _istream(_open_stream(fname)),
+        _map(nullptr),
+        _use_map(true),
+        _map_failed(false)
     { 
         
         if(_istream->fail())
@@ -75,7 +81,10 @@ namespace io{
     data_reader::data_reader(data_reader &&r):
         _fname(std::move(r._fname)),
         _is_binary(std::move(r._is_binary)),
-        _istream(std::move(r._istream))
+        _istream(std::move(r._istream)),
+        _map(std::move(r._map)),
+        _use_map(r._use_map),
+        _map_failed(r._map_failed)
     {}
 
     //-------------------------------------------------------------------------
@@ -94,6 +103,9 @@ namespace io{
 
         _fname = std::move(r._fname);
         _istream = std::move(r._istream);
+        _map = std::move(r._map);
+        _use_map = r._use_map;
+        _map_failed = r._map_failed;
 
         return *this;
     }
@@ -115,6 +127,9 @@ namespace io{
     {
         if(_istream)
             if(_istream->is_open()) _istream->close();
+
+        _map.reset();
+        _map_failed = false;
     }
 
     //-------------------------------------------------------------------------
@@ -124,6 +139,37 @@ namespace io{
         _istream = _open_stream(filename());
     }
 
+    //-------------------------------------------------------------------------
+    void data_reader::use_mmap(bool value)
+    {
+        _use_map = value;
+        if(!_use_map) _map.reset();
+    }
+
+    //-------------------------------------------------------------------------
+    const file_map *data_reader::_get_map() const
+    {
+        if(_map || !_use_map || _map_failed) return _map.get();
+
+        try
+        {
+            _map.reset(new file_map(filename()));
+        }
+        catch(file_error &)
+        {
+            //fall back to the stream for files which cannot be mapped
+            _map_failed = true;
+        }
+        return _map.get();
+    }
+
+    //-------------------------------------------------------------------------
+    void data_reader::_reset_map() const
+    {
+        _map.reset();
+        _map_failed = false;
+    }
+
 //end of namespace
 }
 }
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <fstream>
 #include <pni/core/types.hpp>
+#include <pni/io/file_map.hpp>
 #include <pni/io/windows.hpp>
 
 
@@ -43,6 +44,12 @@ namespace io{
     //! concrete reader classes.  Thus all constructors are protected making 
     //! them available only for derived classes.
     //!
+    //! In addition to the stream a derived class can request a read-only 
+    //! memory map of the file via _get_map(). The map is created on first
+    //! use. If the file cannot be mapped (pipes, special or empty files) or
+    //! mapping was disabled with use_mmap(false) _get_map() returns a null
+    //! pointer and the stream must be used instead.
+    //!
     class PNIIO_EXPORT data_reader
     {
         private:
@@ -58,6 +65,12 @@ namespace io{
             //pointer
             //! stream from which to read data
             mutable std::unique_ptr<std::ifstream> _istream;  
+            //! memory map of the file (created on demand)
+            mutable std::unique_ptr<file_map> _map;
+            //! true if the file should be memory mapped
+            bool _use_map;
+            //! true if mapping the file has failed
+            mutable bool _map_failed;
 
             //! 
             //! \brief open the stream
@@ -90,6 +103,28 @@ namespace io{
             //!
             std::ifstream &_get_stream() const { return *_istream; } 
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get memory map
+            //!
+            //! Return a pointer to a read-only memory map of the entire file.
+            //! The file is mapped on the first call. The pointer remains 
+            //! valid until the file is closed.
+            //!
+            //! \return pointer to the map or nullptr if the file cannot be 
+            //! mapped or mapping is disabled
+            //!
+            const file_map *_get_map() const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief drop the memory map
+            //!
+            //! The file is mapped again by the next call to _get_map(). This
+            //! is required if the file has grown since it was mapped.
+            //!
+            void _reset_map() const;
+
             //-----------------------------------------------------------------
             //!
             //! \brief set binary mode
@@ -167,6 +202,21 @@ namespace io{
             //!
             virtual void open();
 
+            //-------------------------------------------------------------
+            //!
+            //! \brief enable or disable memory mapping
+            //!
+            //! If disabled all data is read via the stream. Mapping is 
+            //! enabled by default.
+            //!
+            //! \param value true to use a memory map
+            //!
+            void use_mmap(bool value);
+
+            //-------------------------------------------------------------
+            //! true if memory mapping is enabled
+            bool use_mmap() const { return _use_map; }
+
     };
 
 //end of namespace
@@ -0,0 +1,197 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <utility>
+#include <pni/core/error.hpp>
+#include <pni/io/file_map.hpp>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pni{
+namespace io{
+
+    using namespace pni::core;
+
+    //-------------------------------------------------------------------------
+    file_map::file_map():
+        _data(nullptr),
+        _size(0)
+#ifdef _WIN32
+        ,_handle(nullptr)
+#endif
+    {}
+
+#ifdef _WIN32
+    //-------------------------------------------------------------------------
+    file_map::file_map(const string &fname):
+        _data(nullptr),
+        _size(0),
+        _handle(nullptr)
+    {
+        HANDLE file = CreateFileA(fname.c_str(),GENERIC_READ,FILE_SHARE_READ,
+                                  nullptr,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if(file == INVALID_HANDLE_VALUE)
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot open file ["+fname+"] for mapping!");
+
+        LARGE_INTEGER size;
+        if(GetFileType(file)!=FILE_TYPE_DISK || !GetFileSizeEx(file,&size) ||
+           size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            throw file_error(EXCEPTION_RECORD,
+                    "File ["+fname+"] cannot be mapped!");
+        }
+
+        HANDLE mapping = CreateFileMappingA(file,nullptr,PAGE_READONLY,0,0,
+                                            nullptr);
+        //the mapping keeps its own reference to the file
+        CloseHandle(file);
+        if(!mapping)
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot create mapping for file ["+fname+"]!");
+
+        void *data = MapViewOfFile(mapping,FILE_MAP_READ,0,0,0);
+        if(!data)
+        {
+            CloseHandle(mapping);
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot map file ["+fname+"]!");
+        }
+
+        _data   = static_cast<const char*>(data);
+        _size   = static_cast<size_t>(size.QuadPart);
+        _handle = mapping;
+    }
+
+    //-------------------------------------------------------------------------
+    void file_map::_unmap()
+    {
+        if(_data) UnmapViewOfFile(_data);
+        if(_handle) CloseHandle(_handle);
+        _data   = nullptr;
+        _size   = 0;
+        _handle = nullptr;
+    }
+#else
+    //-------------------------------------------------------------------------
+    file_map::file_map(const string &fname):
+        _data(nullptr),
+        _size(0)
+    {
+        int fd = ::open(fname.c_str(),O_RDONLY);
+        if(fd<0)
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot open file ["+fname+"] for mapping!");
+
+        struct stat st;
+        if(fstat(fd,&st)!=0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+        {
+            ::close(fd);
+            throw file_error(EXCEPTION_RECORD,
+                    "File ["+fname+"] cannot be mapped!");
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+        void *data = mmap(nullptr,size,PROT_READ,MAP_PRIVATE,fd,0);
+        //the mapping keeps its own reference to the file
+        ::close(fd);
+        if(data == MAP_FAILED)
+            throw file_error(EXCEPTION_RECORD,
+                    "Cannot map file ["+fname+"]!");
+
+        _data = static_cast<const char*>(data);
+        _size = size;
+    }
+
+    //-------------------------------------------------------------------------
+    void file_map::_unmap()
+    {
+        if(_data) munmap(const_cast<char*>(_data),_size);
+        _data = nullptr;
+        _size = 0;
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    void file_map::advise(access pattern) const
+    {
+#ifdef _WIN32
+        (void)pattern;
+#else
+        if(!_data) return;
+
+        int advice = MADV_NORMAL;
+        if(pattern == access::SEQUENTIAL) advice = MADV_SEQUENTIAL;
+        else if(pattern == access::RANDOM) advice = MADV_RANDOM;
+
+        madvise(const_cast<char*>(_data),_size,advice);
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    file_map::file_map(file_map &&m):
+        _data(m._data),
+        _size(m._size)
+#ifdef _WIN32
+        ,_handle(m._handle)
+#endif
+    {
+        m._data = nullptr;
+        m._size = 0;
+#ifdef _WIN32
+        m._handle = nullptr;
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    file_map::~file_map()
+    {
+        _unmap();
+    }
+
+    //-------------------------------------------------------------------------
+    file_map &file_map::operator=(file_map &&m)
+    {
+        if(this == &m) return *this;
+
+        _unmap();
+        std::swap(_data,m._data);
+        std::swap(_size,m._size);
+#ifdef _WIN32
+        std::swap(_handle,m._handle);
+#endif
+        return *this;
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,118 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <pni/core/types.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup general_io
+    //! \brief read-only memory map of a file
+    //!
+    //! Maps an entire file read-only into the address space of the process.
+    //! The mapped bytes can be accessed via data() and size() as long as
+    //! the object exists. Only regular, non-empty files can be mapped.
+    //!
+    //! A new mapping uses the default paging behaviour of the operating
+    //! system. Readers which scan the whole file from the beginning to the
+    //! end can request more aggressive read-ahead with advise().
+    //!
+    class PNIIO_EXPORT file_map
+    {
+        public:
+            //! expected access pattern of the mapped data
+            enum class access { NORMAL, SEQUENTIAL, RANDOM };
+
+        private:
+            //! pointer to the first mapped byte
+            const char *_data;
+            //! number of mapped bytes
+            size_t _size;
+#ifdef _WIN32
+            //! handle of the file mapping object
+            void *_handle;
+#endif
+
+            //! release the mapping
+            void _unmap();
+        public:
+            //=================constructors and destructor====================
+            //! default constructor - nothing is mapped
+            file_map();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief map a file
+            //!
+            //! \throws file_error if the file cannot be opened or mapped
+            //! \param fname name of the file
+            //!
+            explicit file_map(const pni::core::string &fname);
+
+            //-----------------------------------------------------------------
+            //! move constructor
+            file_map(file_map &&m);
+
+            //-----------------------------------------------------------------
+            //! copy constructor is deleted
+            file_map(const file_map &) = delete;
+
+            //-----------------------------------------------------------------
+            //! destructor
+            ~file_map();
+
+            //====================assignment operators========================
+            //! move assignment
+            file_map &operator=(file_map &&m);
+
+            //! copy assignment is deleted
+            file_map &operator=(const file_map &) = delete;
+
+            //=====================public member functions====================
+            //! pointer to the first byte of the file
+            const char *data() const { return _data; }
+
+            //! number of bytes in the file
+            size_t size() const { return _size; }
+
+            //! true if a file is mapped
+            bool is_mapped() const { return _data != nullptr; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief set the expected access pattern
+            //!
+            //! This is only a hint to the operating system and is ignored
+            //! where it is not supported.
+            //!
+            //! \param pattern access pattern for the entire mapping
+            //!
+            void advise(access pattern) const;
+    };
+
+//end of namespace
+}
+}
@@ -22,18 +22,127 @@
 //
 ///
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <pni/io/fio/fio_reader.hpp>
+#include <pni/io/parallel_for.hpp>
+#include <pni/io/parsers/from_chars.hpp>
 #include <boost/regex.hpp>
 #include <boost/algorithm/string/trim.hpp>
 
 static const boost::regex parameter_section_re("^[[:space:]]*%p[[:space:]]*");
 static const boost::regex data_section_re("^[[:space:]]*%d[[:space:]]*");
 static const boost::regex key_value_re("^\\s*(?<KEY>[^=]+)\\s*=\\s*(?<VALUE>.+)\\s*");
-static const boost::regex col_descriptor_re("^\\s*Col\\s+(?<INDEX>\\d+)\\s+(?<NAME>\\w+)\\s+(?<TYPE>\\w+)\\s*");
-static const boost::regex data_record_re("^(?:\\s+[+-\\.0-9eE]+)+\\s*");
-static const boost::regex data_cell_re("[+-\\.0-9eE]+");
+
+namespace {
+
+  //! size of the chunks in which the data section is read from a stream
+  const size_t data_chunk_size = 1024*1024;
+
+  //! minimum size of the chunks parsed in parallel
+  const size_t min_parallel_chunk_size = 1024*1024;
+
+  //! marks a cell without column descriptor
+  const size_t no_column = size_t(-1);
+
+  //-------------------------------------------------------------------------
+  bool is_space(char c)
+  {
+    return c==' ' || c=='\t' || c=='\r' || c=='\v' || c=='\f';
+  }
+
+  //-------------------------------------------------------------------------
+  const char *skip_space(const char *first,const char *last)
+  {
+    while(first!=last && is_space(*first)) ++first;
+    return first;
+  }
+
+  //-------------------------------------------------------------------------
+  bool starts_with_number(const char *first,const char *last)
+  {
+    pni::core::float64 value;
+    return pni::io::from_chars(first,last,value).ec != 
+           std::errc::invalid_argument;
+  }
+
+  //-------------------------------------------------------------------------
+  //!
+  //! \brief parse a single cell
+  //!
+  //! \return pointer after the cell or nullptr if the cell is not a number
+  //!
+  template<typename T>
+  const char *parse_cell(const char *first,const char *last,
+                         std::vector<T> &data)
+  {
+    T value;
+    pni::io::from_chars_result result = pni::io::from_chars(first,last,value);
+    if(result.ec!=std::errc() || (result.ptr!=last && !is_space(*result.ptr)))
+      return nullptr;
+
+    data.push_back(value);
+    return result.ptr;
+  }
+
+  //-------------------------------------------------------------------------
+  //! return pointer after a cell which is not decoded
+  const char *skip_cell(const char *first,const char *last)
+  {
+    while(first!=last && !is_space(*first)) ++first;
+    return first;
+  }
+
+  //-------------------------------------------------------------------------
+  //! return pointer after the last newline in [first,last) or first
+  const char *last_line_end(const char *first,const char *last)
+  {
+    while(last!=first && last[-1]!='\n') --last;
+    return last;
+  }
+
+  //-------------------------------------------------------------------------
+  //! true if the line is a data record - a record starts with a number
+  bool is_record(const char *first,const char *last)
+  {
+    first = skip_space(first,last);
+    return first!=last && *first!='!' && starts_with_number(first,last);
+  }
+
+  //-------------------------------------------------------------------------
+  //! return pointer to the first record line in [first,last)
+  const char *first_record(const char *first,const char *last)
+  {
+    while(first!=last)
+    {
+      const char *line_end = static_cast<const char*>(std::memchr(first,'\n',last-first));
+      if(!line_end) line_end = last;
+      if(is_record(first,line_end)) return first;
+
+      first = line_end==last ? last : line_end+1;
+    }
+    return last;
+  }
+
+  //-------------------------------------------------------------------------
+  //! call f for every line in [first,last)
+  template<typename FUNC>
+  void for_each_line(const char *first,const char *last,FUNC &&f)
+  {
+    while(first!=last)
+    {
+      const char *line_end = static_cast<const char*>(std::memchr(first,'\n',last-first));
+      if(!line_end) line_end = last;
+
+      f(first,line_end);
+
+      first = line_end==last ? last : line_end+1;
+    }
+  }
+
+}
 
 namespace pni{
 namespace io{
@@ -100,66 +209,424 @@ void fio_reader::_parse_parameters(std::ifstream &stream)
 }
 
 //-------------------------------------------------------------------------
-std::vector<pni::core::string> fio_reader::_read_data_line(const pni::core::string &line)
+template<typename FUNC>
+std::streamoff fio_reader::_for_each_line(std::streamoff start,
+                                          std::streamoff end,FUNC &&f,
+                                          std::string &tail) const
 {
-  boost::regex dcol("[+-]?\\d+\\.?\\d*e?[+-]?\\d*");
-  std::vector<pni::core::string> record;
+  std::ifstream &stream = _get_stream();
+  tail.clear();
 
-  boost::match_results<pni::core::string::const_iterator> imatch;
-  pni::core::string::const_iterator start = line.begin();
-  pni::core::string::const_iterator end   = line.end();
-  while(boost::regex_search(start,end,imatch,dcol,boost::match_default))
+  if(const file_map *map = _get_map())
   {
-    record.push_back(imatch.str());
-    start = imatch[0].second;
+    //parse the data section directly from the mapped file
+    if(start<0) return -1;
+
+    const char *last  = map->data()+map->size();
+    if(end>=0 && size_t(end)<map->size()) last = map->data()+end;
+    const char *first = std::min(map->data()+start,last);
+
+    const char *complete = last_line_end(first,last);
+    for_each_line(first,complete,f);
+    tail.assign(complete,last);
+    return complete-map->data();
   }
 
-  return record;
+  //read the data section in large chunks - a line crossing the end of a
+  //chunk is moved to the beginning of the buffer and completed with the
+  //next chunk
+  stream.clear();
+  if(start>=0) stream.seekg(start);
+
+  std::vector<char> buffer(data_chunk_size);
+  size_t size = 0;
+  std::streamoff offset = start;
+  std::streamoff remaining = end>=0 ? end-start : -1;
+
+  while(stream && remaining)
+  {
+    std::streamoff count = std::streamoff(buffer.size()-size);
+    if(remaining>0) count = std::min(count,remaining);
+    stream.read(buffer.data()+size,count);
+    size += size_t(stream.gcount());
+    if(remaining>0) remaining -= stream.gcount();
+
+    const char *first = buffer.data();
+    const char *last  = last_line_end(first,first+size);
+    if(last == first && size == buffer.size())
+    {
+      //a single line longer than the buffer
+      buffer.resize(2*buffer.size());
+      continue;
+    }
+
+    for_each_line(first,last,f);
+    if(offset>=0) offset += last-first;
+    size = size_t(first+size-last);
+    std::copy(last,last+size,buffer.data());
+  }
+  tail.assign(buffer.data(),size);
+
+  //must be called here to clear EOF error bit
+  //must be called before next call to seekg
+  stream.clear();
+  return offset;
 }
 
 //-------------------------------------------------------------------------
 void fio_reader::_parse_data(std::ifstream &stream)
 {
-  boost::smatch match;
-  size_t nr = 0; //number of records
+  _data_offset = stream.tellg();
 
-  pni::core::string line_buffer;
-  std::map<int,pni::core::string> index_name_map;
+  std::string tail;
+  const file_map *map = _get_map();
+  //the data section is always scanned from the beginning to the end
+  if(map) map->advise(file_map::access::SEQUENTIAL);
+  if(map && _data_offset>=0 && worker_threads(_nthreads)>1)
+  {
+    //the column descriptors are parsed before the records which are
+    //then parsed in parallel
+    const char *first = map->data()+std::min<size_t>(_data_offset,map->size());
+    const char *last  = map->data()+map->size();
+    const char *complete = last_line_end(first,last);
+    const char *records = first_record(first,complete);
+    for_each_line(first,records,[this](const char *first,const char *last)
+                                { _parse_line(first,last); });
+
+    _nrecords(_parse_records_parallel(records,complete));
+    _data_end = complete-map->data();
+    tail.assign(complete,last);
+  }
+  else
+  {
+    _data_end = _for_each_line(_data_offset,-1,
+                               [this](const char *first,const char *last)
+                               { _parse_line(first,last); },tail);
+  }
 
-  while(!stream.eof())
+  _parse_tail(tail);
+  for(auto &data: _columns) data.decode = false;
+}
+
+//-------------------------------------------------------------------------
+void fio_reader::_parse_tail(const std::string &tail)
+{
+  const char *first = tail.data();
+  const char *last  = first+tail.size();
+  if(!is_record(first,last)) return;
+
+  try
   {
-    std::getline(stream,line_buffer);
+    _parse_record(skip_space(first,last),last,nrecords(),_columns);
+  }
+  catch(pni::core::file_error &)
+  {
+    //the last line is still being written
+    _truncate_columns(nrecords());
+    return;
+  }
+
+  _tail = tail;
+  _nrecords(nrecords()+1);
+}
+
+//-------------------------------------------------------------------------
+void fio_reader::_truncate_columns(size_t n) const
+{
+  for(auto &data: _columns)
+  {
+    if(data.float32_data.size()>n) data.float32_data.resize(n);
+    if(data.float64_data.size()>n) data.float64_data.resize(n);
+  }
+}
+
+//-------------------------------------------------------------------------
+void fio_reader::_parse_line(const char *first,const char *last)
+{
+  first = skip_space(first,last);
+  if(first!=last && *first=='C' && _parse_column_descriptor(first,last)) 
+    return;
+
+  //a line which does not start with a number is not a record
+  if(!is_record(first,last)) return;
+
+  if(!_lazy) _parse_record(first,last,nrecords(),_columns);
+  _nrecords(nrecords()+1);
+}
+
+//-------------------------------------------------------------------------
+void fio_reader::_parse_record(const char *first,const char *last,
+                               size_t record,
+                               std::vector<column_data> &columns) const
+{
+  using namespace pni::core;
+
+  size_t cell = 0;
+  while(first!=last)
+  {
+    if(cell>=_cell_columns.size() || _cell_columns[cell]==no_column)
+      throw file_error(EXCEPTION_RECORD,
+          "Record "+std::to_string(record+1)+" of file ["+filename()+
+          "] has more cells than there are columns!");
+
+    column_data &data = columns[_cell_columns[cell]];
+    const char *cell_end;
+    if(!data.decode)
+      cell_end = skip_cell(first,last);
+    else if(data.type == type_id_t::FLOAT32)
+      cell_end = parse_cell(first,last,data.float32_data);
+    else
+      cell_end = parse_cell(first,last,data.float64_data);
+
+    if(!cell_end)
+      throw file_error(EXCEPTION_RECORD,
+          "Cell "+std::to_string(cell+1)+" of record "+
+          std::to_string(record+1)+" of file ["+filename()+
+          "] is not a valid number!");
+
+    first = skip_space(cell_end,last);
+    ++cell;
+  }
+
+  if(cell!=_cell_columns.size())
+    throw file_error(EXCEPTION_RECORD,
+        "Record "+std::to_string(record+1)+" of file ["+filename()+
+        "] has "+std::to_string(cell)+" cells but there are "+
+        std::to_string(_cell_columns.size())+" columns!");
+}
 
-    if(boost::regex_match(line_buffer,match,col_descriptor_re))
+//-------------------------------------------------------------------------
+size_t fio_reader::_parse_records_parallel(const char *first,
+                                           const char *last) const
+{
+  //records in a chunk are decoded into buffers of their own which are 
+  //appended to the column data once all chunks are done
+  struct chunk_result
+  {
+    size_t nrecords;
+    std::vector<column_data> columns;
+    const char *error_first; //first invalid record
+    const char *error_last;
+  };
+
+  auto empty_columns = [this]() -> std::vector<column_data>
+  {
+    std::vector<column_data> columns;
+    for(const auto &data: _columns)
     {
-      pni::core::string cname = match.str("NAME"),
-          ctype = match.str("TYPE");
-      boost::trim(cname);
-      boost::trim(ctype);
-
-      _append_column(column_info(cname,_typestr2id(ctype),std::vector<size_t>()));
-      index_name_map.insert({boost::lexical_cast<int>(match.str("INDEX"))-1,cname});
-      _columns.insert({cname,column_type{}});
+      column_data chunk_data;
+      chunk_data.type   = data.type;
+      chunk_data.loaded = false;
+      chunk_data.decode = data.decode;
+      columns.push_back(std::move(chunk_data));
     }
-    else if(boost::regex_match(line_buffer,match,data_record_re))
+    return columns;
+  };
+
+  bool decode = std::any_of(_columns.begin(),_columns.end(),
+                            [](const column_data &data) { return data.decode; });
+
+  //split the records in chunks starting at the beginning of a line 
+  size_t nthreads = worker_threads(_nthreads);
+  size_t nchunks  = std::max<size_t>(1,std::min<size_t>(4*nthreads,
+                                     size_t(last-first)/min_parallel_chunk_size));
+  std::vector<const char*> bounds{first};
+  for(size_t c=1;c<nchunks;++c)
+  {
+    const char *p = std::max(first+size_t(last-first)*c/nchunks,bounds.back());
+    p = static_cast<const char*>(std::memchr(p,'\n',last-p));
+    bounds.push_back(p ? p+1 : last);
+  }
+  bounds.push_back(last);
+
+  std::vector<chunk_result> results(nchunks);
+  parallel_for(nchunks,nthreads,[&](size_t c)
+  {
+    chunk_result &result = results[c];
+    result.nrecords    = 0;
+    result.error_first = nullptr;
+    result.error_last  = nullptr;
+    if(decode) result.columns = empty_columns();
+
+    auto parse = [&](const char *first,const char *last)
     {
-      size_t column_index=0;
-      boost::sregex_iterator iter(line_buffer.begin(),line_buffer.end(),data_cell_re);
-      boost::sregex_iterator iter_end;
+      if(result.error_first || !is_record(first,last)) return;
 
-      for(;iter!=iter_end;++iter,++column_index)
+      if(decode)
       {
-        _columns.at(index_name_map.at(column_index)).push_back(iter->str());
+        try
+        {
+          _parse_record(skip_space(first,last),last,result.nrecords,
+                        result.columns);
+        }
+        catch(pni::core::file_error &)
+        {
+          result.error_first = first;
+          result.error_last  = last;
+          return;
+        }
       }
-      nr++;
+      ++result.nrecords;
+    };
+    for_each_line(bounds[c],bounds[c+1],parse);
+  });
+
+  //report the first invalid record with its index in the file
+  size_t nrecords = 0;
+  for(const auto &result: results)
+  {
+    if(result.error_first)
+    {
+      std::vector<column_data> columns = empty_columns();
+      _parse_record(skip_space(result.error_first,result.error_last),
+                    result.error_last,nrecords+result.nrecords,columns);
     }
+    nrecords += result.nrecords;
   }
 
-  //set the number of records in the file
-  _nrecords(nr);
-  //must be called here to clear EOF error bit
-  //must be called before next call to seekg
-  stream.clear();
+  if(!decode) return nrecords;
+
+  for(size_t i=0;i<_columns.size();++i)
+  {
+    column_data &data = _columns[i];
+    if(!data.decode) continue;
+
+    data.float32_data.reserve(data.float32_data.size()+nrecords);
+    data.float64_data.reserve(data.float64_data.size()+nrecords);
+    for(const auto &result: results)
+    {
+      const column_data &chunk_data = result.columns[i];
+      data.float32_data.insert(data.float32_data.end(),
+                               chunk_data.float32_data.begin(),
+                               chunk_data.float32_data.end());
+      data.float64_data.insert(data.float64_data.end(),
+                               chunk_data.float64_data.begin(),
+                               chunk_data.float64_data.end());
+    }
+  }
+
+  return nrecords;
+}
+
+//-------------------------------------------------------------------------
+void fio_reader::_load_columns(const std::vector<size_t> &indices) const
+{
+  using namespace pni::core;
+
+  std::vector<size_t> load;
+  for(auto index: indices)
+  {
+    column_data &data = _columns[index];
+    if(data.loaded || data.decode) continue;
+
+    data.decode = true;
+    if(data.type == type_id_t::FLOAT32)
+      data.float32_data.reserve(nrecords());
+    else
+      data.float64_data.reserve(nrecords());
+    load.push_back(index);
+  }
+
+  if(load.empty()) return;
+
+  try
+  {
+    if(_data_offset<0 || _data_end<0)
+      throw file_error(EXCEPTION_RECORD,
+          "The data section of file ["+filename()+"] cannot be read again!");
+
+    //only the lines which have been parsed when the file was opened or 
+    //refreshed are read
+    const file_map *map = _get_map();
+    if(map) map->advise(file_map::access::SEQUENTIAL);
+    size_t record = 0;
+    if(map && worker_threads(_nthreads)>1)
+    {
+      const char *last  = map->data()+std::min<size_t>(_data_end,map->size());
+      const char *first = std::min(map->data()+_data_offset,last);
+      record = _parse_records_parallel(first_record(first,last),last);
+    }
+    else
+    {
+      std::string tail;
+      _for_each_line(_data_offset,_data_end,
+                     [this,&record](const char *first,const char *last)
+      {
+        if(!is_record(first,last)) return;
+
+        _parse_record(skip_space(first,last),last,record++,_columns);
+      },tail);
+    }
+
+    if(!_tail.empty())
+      _parse_record(skip_space(_tail.data(),_tail.data()+_tail.size()),
+                    _tail.data()+_tail.size(),record++,_columns);
+
+    if(record!=nrecords())
+      throw file_error(EXCEPTION_RECORD,
+          "File ["+filename()+"] has changed since it was opened!");
+  }
+  catch(...)
+  {
+    for(auto index: load)
+    {
+      _columns[index].decode = false;
+      _columns[index].float32_data.clear();
+      _columns[index].float64_data.clear();
+    }
+    throw;
+  }
+
+  for(auto index: load)
+  {
+    _columns[index].decode = false;
+    _columns[index].loaded = true;
+  }
+}
+
+//-------------------------------------------------------------------------
+bool fio_reader::_parse_column_descriptor(const char *first,const char *last)
+{
+  using namespace pni::core;
+
+  //split the line in at most 4 tokens
+  std::pair<const char*,const char*> tokens[4];
+  size_t ntokens = 0;
+  for(first = skip_space(first,last);first!=last && ntokens<4;
+      first = skip_space(first,last))
+  {
+    const char *token_end = first;
+    while(token_end!=last && !is_space(*token_end)) ++token_end;
+    tokens[ntokens++] = {first,token_end};
+    first = token_end;
+  }
+
+  if(ntokens!=4 || first!=last || 
+     string(tokens[0].first,tokens[0].second)!="Col") 
+    return false;
+
+  uint64 index = 0;
+  from_chars_result result = from_chars(tokens[1].first,tokens[1].second,index);
+  if(result.ec!=std::errc() || result.ptr!=tokens[1].second || !index)
+    return false;
+
+  string cname(tokens[2].first,tokens[2].second);
+  string ctype(tokens[3].first,tokens[3].second);
+
+  _append_column(column_info(cname,_typestr2id(ctype),std::vector<size_t>()));
+
+  //only FLOAT columns are stored in single precision - in lazy mode 
+  //columns are decoded when they are requested for the first time
+  column_data data;
+  data.type = _typestr2id(ctype)==type_id_t::FLOAT32 ? type_id_t::FLOAT32 :
+                                                       type_id_t::FLOAT64;
+  data.loaded = !_lazy;
+  data.decode = !_lazy;
+  _columns.push_back(std::move(data));
+
+  if(_cell_columns.size()<index) _cell_columns.resize(index,no_column);
+  _cell_columns[index-1] = _columns.size()-1;
+  return true;
 }
 
 //-------------------------------------------------------------------------
@@ -178,6 +645,28 @@ const
   }
 }
 
+//-------------------------------------------------------------------------
+std::vector<column_buffer> 
+fio_reader::_get_column_buffers(const std::vector<size_t> &indices) const
+{
+  using namespace pni::core;
+
+  _load_columns(indices);
+
+  std::vector<column_buffer> buffers;
+  for(auto index: indices)
+  {
+    const column_data &data = _columns[index];
+    if(data.type == type_id_t::FLOAT32)
+      buffers.push_back({data.float32_data.data(),data.type,
+                         data.float32_data.size()});
+    else
+      buffers.push_back({data.float64_data.data(),data.type,
+                         data.float64_data.size()});
+  }
+  return buffers;
+}
+
 //=================implementation of static private methods================
 pni::core::type_id_t fio_reader::_typestr2id(const pni::core::string &tstr)
 {
@@ -194,15 +683,28 @@ pni::core::type_id_t fio_reader::_typestr2id(const pni::core::string &tstr)
 fio_reader::fio_reader():
     	    spreadsheet_reader(),
     	    _param_map(),
-    	    _columns()
+    	    _columns(),
+    	    _cell_columns(),
+    	    _lazy(false),
+    	    _nthreads(1),
+    	    _data_offset(-1),
+    	    _data_end(-1),
+    	    _tail()
 {}
 
 //-------------------------------------------------------------------------
 //standard constructor implementation
-fio_reader::fio_reader(const pni::core::string &n):
+fio_reader::fio_reader(const pni::core::string &n,bool lazy,
+                       size_t nthreads):
             spreadsheet_reader(n),
             _param_map(),
-            _columns()
+            _columns(),
+            _cell_columns(),
+            _lazy(lazy),
+            _nthreads(nthreads),
+            _data_offset(-1),
+            _data_end(-1),
+            _tail()
 {
   _parse_file(_get_stream());
 }
@@ -213,6 +715,66 @@ fio_reader::~fio_reader()
 {}
 
 //=============public memeber methods======================================
+size_t fio_reader::refresh()
+{
+  using namespace pni::core;
+
+  if(_data_offset<0 || _data_end<0)
+    throw file_error(EXCEPTION_RECORD,
+        "File ["+filename()+"] cannot be refreshed!");
+
+  //the file has grown since it was mapped
+  _reset_map();
+
+  //a record without newline at the end of the file is parsed again
+  size_t nrecords_old = nrecords();
+  size_t nrecords_complete = nrecords_old-(_tail.empty() ? 0 : 1);
+  std::string tail_old;
+  std::swap(tail_old,_tail);
+  _truncate_columns(nrecords_complete);
+  _nrecords(nrecords_complete);
+
+  for(auto &data: _columns) data.decode = data.loaded;
+  try
+  {
+    std::string tail;
+    _data_end = _for_each_line(_data_end,-1,
+                               [this](const char *first,const char *last)
+    {
+      if(is_record(first,last))
+      {
+        _parse_record(skip_space(first,last),last,nrecords(),_columns);
+        _nrecords(nrecords()+1);
+      }
+      else if(!nrecords())
+      {
+        //column descriptors may be written after the file was opened
+        _parse_line(first,last);
+      }
+    },tail);
+
+    _parse_tail(tail);
+  }
+  catch(...)
+  {
+    _truncate_columns(nrecords_complete);
+    _nrecords(nrecords_complete);
+    _parse_tail(tail_old);
+    for(auto &data: _columns) data.decode = false;
+    throw;
+  }
+  for(auto &data: _columns) data.decode = false;
+
+  return nrecords()-std::min(nrecords(),nrecords_old);
+}
+
+//-------------------------------------------------------------------------
+bool fio_reader::column_loaded(const pni::core::string &n) const
+{
+  return _columns[this->column_index(n)].loaded;
+}
+
+//-------------------------------------------------------------------------
 //implementation of nparameters
 size_t fio_reader::nparameters() const
 {
@@ -45,6 +45,16 @@ namespace io{
     software used at DESY. FIO files are basically ACII files where data is
     stored in columns. Thus such files correspond to the family of spreadsheet
     style files. 
+
+    The data section is parsed once when the file is opened. The cells are 
+    converted directly to the type declared for their column (FLOAT or 
+    DOUBLE) and stored in one contiguous buffer per column.
+
+    If the reader is opened in lazy mode only the parameters, the column 
+    descriptors and the number of records are read on opening. A column is
+    decoded when it is requested for the first time and kept for later
+    requests. Use columns() to decode several columns with a single scan of
+    the data section.
     */
     class PNIIO_EXPORT fio_reader:public spreadsheet_reader
     {
@@ -53,12 +63,33 @@ namespace io{
 #pragma warning(disable:4251)
 #endif
     	    using parameter_map_type = std::map<pni::core::string,pni::core::string>;
-    	    using column_type = std::vector<pni::core::string>;
-    	    using column_map_type = std::map<pni::core::string,column_type>;
+
+            //! data of a column stored with the type declared in the file
+            struct column_data
+            {
+                pni::core::type_id_t type; //!< FLOAT32 or FLOAT64
+                bool loaded; //!< true if the data has been decoded
+                bool decode; //!< true if the column is currently decoded
+                std::vector<pni::core::float32> float32_data; //!< FLOAT data
+                std::vector<pni::core::float64> float64_data; //!< DOUBLE data
+            };
+
             //! parameter stream positions
             std::map<pni::core::string,pni::core::string> _param_map;
-            //! column data
-            std::map<pni::core::string,std::vector<pni::core::string>> _columns;
+            //! column data in the order of the columns
+            mutable std::vector<column_data> _columns;
+            //! index of the column for every cell of a record
+            std::vector<size_t> _cell_columns;
+            //! true if columns are decoded on request
+            bool _lazy;
+            //! number of threads used for decoding
+            size_t _nthreads;
+            //! offset of the first line after %d, -1 if unknown
+            std::streamoff _data_offset;
+            //! offset after the last complete line parsed, -1 if unknown
+            std::streamoff _data_end;
+            //! last line of the file without newline if it is a record
+            pni::core::string _tail;
 #ifdef _MSC_VER
 #pragma warning(default:4251)
 #endif
@@ -89,11 +120,117 @@ namespace io{
 
             Private function which execudes parser code for the data section of
             the FIO file. It collects all the information about columns present
-            in the file.
-            \param stream input stream from which to read data
+            in the file. The section is parsed from the memory map of the file
+            or, if the file cannot be mapped, read in large chunks from the 
+            stream.
+            \param stream input stream pointing to the first line after %d
             */
             void _parse_data(std::ifstream &stream);
 
+            //-----------------------------------------------------------------
+            /*! 
+            \brief call a function for every line of the data section
+
+            Calls f for every line terminated by a newline in [start,end) 
+            of the file. If start is negative the stream is read from its 
+            current position.
+            \param start offset of the first line
+            \param end offset where to stop or -1 for the end of the file
+            \param f function called with pointers to the first and after 
+            the last character of a line
+            \param tail characters after the last newline 
+            \return offset after the last newline or -1 if unknown
+            */
+            template<typename FUNC> 
+            std::streamoff _for_each_line(std::streamoff start,
+                                          std::streamoff end,FUNC &&f,
+                                          pni::core::string &tail) const;
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief parse the last line of the file
+
+            If the file does not end with a newline its last line may still
+            be written. The line is added as a record only if it is valid. 
+            It is parsed again by refresh().
+            \param tail characters after the last newline
+            */
+            void _parse_tail(const pni::core::string &tail);
+
+            //-----------------------------------------------------------------
+            //! remove all cells of records n and above from the column data
+            void _truncate_columns(size_t n) const;
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief parse a single line of the data section
+
+            The line is either a column descriptor, a comment or a data 
+            record. Lines which do not start with a number are ignored.
+            Records are only counted in lazy mode.
+            \throws file_error if the cells of a record cannot be parsed
+            or the number of cells does not match the number of columns
+            \param first pointer to the first character of the line
+            \param last pointer after the last character of the line
+            */
+            void _parse_line(const char *first,const char *last);
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief parse a data record
+
+            Decodes the cells of all columns whose decode flag is set and 
+            skips all others.
+            \throws file_error if a decoded cell is not a number or the 
+            number of cells does not match the number of columns
+            \param first pointer to the first cell
+            \param last pointer after the last character of the line
+            \param record index of the record (used for error messages)
+            \param columns column data where to store the cells
+            */
+            void _parse_record(const char *first,const char *last,
+                               size_t record,
+                               std::vector<column_data> &columns) const;
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief parse records in parallel
+
+            Splits the records of the memory mapped data section into 
+            chunks of complete lines which are parsed by nthreads() threads.
+            The cells of all columns whose decode flag is set are appended 
+            to the column data in the order of the records.
+            \throws file_error if a record is invalid
+            \param first pointer to the first record
+            \param last pointer to the end of the file
+            \return number of records
+            */
+            size_t _parse_records_parallel(const char *first,
+                                           const char *last) const;
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief decode columns
+
+            Decodes all columns in indices which have not been loaded yet 
+            with a single scan of the data section. 
+            \throws file_error if the data section cannot be read 
+            \param indices column indices
+            */
+            void _load_columns(const std::vector<size_t> &indices) const;
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief parse a column descriptor
+
+            Parses a line of the form "Col index name type" and adds the 
+            column.
+            \param first pointer to the first character of the line
+            \param last pointer after the last character of the line
+            \return true if the line is a column descriptor
+            */
+            bool _parse_column_descriptor(const char *first,const char *last);
+
             //-----------------------------------------------------------------
             /*! 
             \brief type id from type string 
@@ -107,15 +244,25 @@ namespace io{
           
             //------------------------------------------------------------------
             /*! 
-            \brief read data line
+            \brief get column buffers
 
-            Reads a data line and splits the line into its cells. The method
-            returns a vector of Strings where each elements corresponds to a
-            particular cell. 
-            \param line input line
-            \return vector with cell content as strings
+            Decodes all requested columns which have not been loaded yet.
+            \throws file_error if the data section cannot be read
+            \param indices column indices
+            \return one buffer for each index
             */
-            static std::vector<pni::core::string> _read_data_line(const pni::core::string &line);
+            virtual std::vector<column_buffer> 
+            _get_column_buffers(const std::vector<size_t> &indices) const;
+
+            //------------------------------------------------------------------
+            /*! 
+            \brief copy column data to a container
+
+            \param data column data
+            \param c container with at least data.size() elements
+            */
+            template<typename T,typename CTYPE> 
+            static void _copy_column(const std::vector<T> &data,CTYPE &c);
 
             //-----------------------------------------------------------------
             /*! 
@@ -165,8 +312,16 @@ namespace io{
             //! move constructor
             fio_reader(fio_reader &&r) = default;
 
-            //! standard constructor
-            fio_reader(const pni::core::string &n);
+            //!
+            //! \brief standard constructor
+            //!
+            //! \param n name of the file
+            //! \param lazy if true columns are decoded on request
+            //! \param nthreads number of threads used to decode the data 
+            //! section, 0 for one thread per core
+            //!
+            fio_reader(const pni::core::string &n,bool lazy=false,
+                       size_t nthreads=1);
 
             //! destructor
             ~fio_reader();
@@ -214,7 +369,9 @@ namespace io{
             \brief get single column
 
             Returns a single column and stores the data into an array object.
-            If the column name does not exist an exception is thrown.
+            If the column name does not exist an exception is thrown. The 
+            values are converted from the type declared in the file to the
+            element type of the container.
             \throws key_error if column does not exist
             \throws file_error if EOF is reached before end of data
             \param n name of the column
@@ -239,6 +396,64 @@ namespace io{
             template<typename CTYPE> 
                 void column(const std::string &n,CTYPE &c) const;
 
+            //-----------------------------------------------------------------
+            /*! 
+            \brief get several columns
+
+            Returns the requested columns in the order of their names. In 
+            lazy mode all columns which have not been decoded yet are 
+            decoded with a single scan of the data section.
+            \throws key_error if one of the columns does not exist
+            \throws file_error if the data section cannot be read
+            \tparam CTYPE container type
+            \param names names of the columns
+            \return one container for each name
+            */
+            template<typename CTYPE> 
+            std::vector<CTYPE> columns(const std::vector<std::string> &names) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read records appended to the file
+            //!
+            //! Parses only the lines written to the file since it was opened
+            //! or refreshed the last time. The new records are appended to 
+            //! all decoded columns. A last line without newline is only 
+            //! added if it is a valid record and is parsed again by the 
+            //! next call.
+            //!
+            //! \throws file_error if a new record is invalid or the file 
+            //! cannot be read again (pipes)
+            //! \return number of new records
+            //!
+            size_t refresh();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief set the number of decoding threads
+            //!
+            //! Memory mapped files are split in chunks of records which are 
+            //! decoded in parallel. The setting is used for columns decoded
+            //! in lazy mode.
+            //!
+            //! \param n number of threads, 0 for one thread per core
+            //!
+            void nthreads(size_t n) { _nthreads = n; }
+
+            //-----------------------------------------------------------------
+            //! get the number of decoding threads
+            size_t nthreads() const { return _nthreads; }
+
+            //-----------------------------------------------------------------
+            /*! 
+            \brief check if a column has been decoded
+
+            \throws key_error if the column does not exist
+            \param n name of the column
+            \return true if the column is kept in memory
+            */
+            bool column_loaded(const std::string &n) const;
+
     };
     
     //==========implementation of private template methods=====================
@@ -255,20 +470,34 @@ namespace io{
         return boost::lexical_cast<T>(_param_map.at(name));
     }
 
+    //-------------------------------------------------------------------------
+    template<typename T,typename CTYPE> 
+        void fio_reader::_copy_column(const std::vector<T> &data,CTYPE &c)
+    {
+        using value_type = typename CTYPE::value_type;
+
+        size_t index=0;
+        for(auto value: data)
+            c[index++] = static_cast<value_type>(value);
+    }
+
     //-------------------------------------------------------------------------
     template<typename CTYPE> 
         void fio_reader::column(const std::string &n,CTYPE &c) const
     {
         using namespace pni::core;
-        using value_type = typename CTYPE::value_type;
 
         try
         {
-            const column_type &column  = _columns.at(n);
+            size_t index = this->column_index(n);
+            _load_columns({index});
+
+            const column_data &data = _columns[index];
 
-            size_t index=0;
-            for(auto value: column)
-            	c[index++] = boost::lexical_cast<value_type>(value);
+            if(data.type == type_id_t::FLOAT32)
+                _copy_column(data.float32_data,c);
+            else
+                _copy_column(data.float64_data,c);
         }
         catch(key_error &error)
         {
@@ -293,6 +522,20 @@ namespace io{
         return data;
     }
 
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+    std::vector<CTYPE> 
+    fio_reader::columns(const std::vector<std::string> &names) const
+    {
+        std::vector<size_t> indices;
+        for(auto name: names) indices.push_back(this->column_index(name));
+        _load_columns(indices);
+
+        std::vector<CTYPE> data;
+        for(auto name: names) data.push_back(column<CTYPE>(name));
+        return data;
+    }
+
 
 //end of namespace
 }
@@ -25,3 +25,4 @@
 
 #include <pni/io/formatters/scalar_format.hpp>
 #include <pni/io/formatters/vector_format.hpp>
+#include <pni/io/formatters/array_writer.hpp>
@@ -0,0 +1,111 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+
+#include <pni/io/formatters/array_writer.hpp>
+
+namespace pni{
+namespace io{
+
+    using namespace pni::core;
+
+    const size_t array_writer::default_buffer_size;
+
+    //-------------------------------------------------------------------------
+    array_writer::array_writer(std::ostream &stream,
+                               const container_io_config &config,
+                               const format_config &value_config,
+                               size_t buffer_size):
+        _stream(stream),
+        _config(config),
+        _value_config(value_config),
+        _buffer_size(buffer_size),
+        _buffer()
+    {
+        //leave room for the value which exceeds the threshold
+        _buffer.reserve(_buffer_size+max_scalar_format_size+2);
+    }
+
+    //-------------------------------------------------------------------------
+    array_writer::~array_writer()
+    {
+        if(!_buffer.empty())
+            _stream.write(_buffer.data(),_buffer.size());
+    }
+
+    //-------------------------------------------------------------------------
+    void array_writer::flush()
+    {
+        _stream.write(_buffer.data(),_buffer.size());
+        _buffer.clear();
+
+        if(!_stream)
+            throw file_error(EXCEPTION_RECORD,
+                    "Error writing formatted data to stream!");
+    }
+
+    //-------------------------------------------------------------------------
+    void array_writer::write(const array &a)
+    {
+        auto shape = a.shape<std::vector<size_t>>();
+        size_t row_size = _row_size(shape,a.size());
+
+#define PNIIO_WRITE_TYPED(tid,type)\
+        case type_id_t::tid:\
+        {\
+            const type *data = static_cast<const type*>(a.data());\
+            if(shape.size()<2) write_row(data,data+a.size());\
+            else write_rows(data,data+a.size(),row_size);\
+            return;\
+        }
+
+        switch(a.type_id())
+        {
+            PNIIO_WRITE_TYPED(UINT8,uint8)
+            PNIIO_WRITE_TYPED(INT8,int8)
+            PNIIO_WRITE_TYPED(UINT16,uint16)
+            PNIIO_WRITE_TYPED(INT16,int16)
+            PNIIO_WRITE_TYPED(UINT32,uint32)
+            PNIIO_WRITE_TYPED(INT32,int32)
+            PNIIO_WRITE_TYPED(UINT64,uint64)
+            PNIIO_WRITE_TYPED(INT64,int64)
+            PNIIO_WRITE_TYPED(FLOAT32,float32)
+            PNIIO_WRITE_TYPED(FLOAT64,float64)
+            PNIIO_WRITE_TYPED(FLOAT128,float128)
+            PNIIO_WRITE_TYPED(COMPLEX32,complex32)
+            PNIIO_WRITE_TYPED(COMPLEX64,complex64)
+            PNIIO_WRITE_TYPED(COMPLEX128,complex128)
+            PNIIO_WRITE_TYPED(BOOL,bool_t)
+            PNIIO_WRITE_TYPED(STRING,string)
+            default:
+                break;
+        }
+#undef PNIIO_WRITE_TYPED
+
+        if(shape.size()<2)
+            write_row(a.begin(),a.end());
+        else
+            write_rows(a.begin(),a.end(),row_size);
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,211 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures.hpp>
+#include <pni/io/container_io_config.hpp>
+#include <pni/io/windows.hpp>
+#include <pni/io/formatters/scalar_format.hpp>
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup formatter_classes
+    //! \brief write arrays row by row to a stream
+    //!
+    //! The writer formats arrays incrementally. Every row is written like a
+    //! container by format() followed by a newline. The formatted text is
+    //! collected in a buffer of fixed size which is written to the stream
+    //! whenever it is full. Thus arrays of any size can be written without
+    //! keeping their text representation in memory.
+    //!
+    //! For arrays of rank 2 and higher a row consists of the elements of
+    //! the last dimension, so a matrix is written as a table. Arrays of
+    //! rank 0 and 1 are written as a single row.
+    //!
+    //! ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+    //! std::ofstream stream("data.txt");
+    //! array_writer writer(stream,container_io_config(),format_config(6));
+    //! writer.write(data);
+    //! writer.flush();
+    //! ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    //!
+    class PNIIO_EXPORT array_writer
+    {
+        private:
+            std::ostream &_stream;              //!< the output stream
+            container_io_config _config;        //!< row configuration
+            format_config _value_config;        //!< value configuration
+            size_t _buffer_size;                //!< flush threshold
+            pni::core::string _buffer;          //!< output buffer
+
+            //-----------------------------------------------------------------
+            //! write the buffer to the stream if it is full
+            void _flush_if_full()
+            {
+                if(_buffer.size()>=_buffer_size) flush();
+            }
+
+            //-----------------------------------------------------------------
+            //! number of values in a row of an array with the given shape
+            static size_t _row_size(const std::vector<size_t> &shape,
+                                    size_t size)
+            {
+                return shape.size()<2 ? size : shape.back();
+            }
+        public:
+            //! default size of the output buffer
+            static const size_t default_buffer_size = 1<<16;
+
+            //=====================constructors and destructor=================
+            //!
+            //! \brief constructor
+            //!
+            //! \param stream the stream to write to
+            //! \param config start, stop and separator symbols of a row
+            //! \param value_config format configuration for the values
+            //! \param buffer_size size of the output buffer
+            //!
+            explicit array_writer(std::ostream &stream,
+                                  const container_io_config &config=container_io_config(),
+                                  const format_config &value_config=format_config(),
+                                  size_t buffer_size=default_buffer_size);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief destructor
+            //!
+            //! Writes the remaining content of the buffer to the stream.
+            //! Errors are not reported, call flush() to check for them.
+            //!
+            ~array_writer();
+
+            array_writer(const array_writer &) = delete;
+            array_writer &operator=(const array_writer &) = delete;
+
+            //=====================public member functions=====================
+            //!
+            //! \brief write a single row
+            //!
+            //! \tparam ITER iterator type
+            //! \param first iterator to the first value of the row
+            //! \param last iterator after the last value of the row
+            //!
+            template<typename ITER>
+            void write_row(ITER first,ITER last)
+            {
+                if(_config.start_symbol()) _buffer += _config.start_symbol();
+
+                for(ITER iter = first;iter!=last;++iter)
+                {
+                    if(iter!=first) _buffer += _config.separator();
+                    format_to(_buffer,*iter,_value_config);
+                    _flush_if_full();
+                }
+
+                if(_config.stop_symbol()) _buffer += _config.stop_symbol();
+                _buffer += '\n';
+                _flush_if_full();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write a sequence of rows
+            //!
+            //! The values in [first,last) are split into rows of row_size
+            //! values. The last row may be shorter.
+            //!
+            //! \tparam ITER iterator type
+            //! \param first iterator to the first value
+            //! \param last iterator after the last value
+            //! \param row_size number of values per row
+            //!
+            template<typename ITER>
+            void write_rows(ITER first,ITER last,size_t row_size)
+            {
+                if(!row_size) return;
+
+                while(first!=last)
+                {
+                    if(_config.start_symbol())
+                        _buffer += _config.start_symbol();
+
+                    for(size_t i=0;i<row_size && first!=last;++i,++first)
+                    {
+                        if(i) _buffer += _config.separator();
+                        format_to(_buffer,*first,_value_config);
+                        _flush_if_full();
+                    }
+
+                    if(_config.stop_symbol())
+                        _buffer += _config.stop_symbol();
+                    _buffer += '\n';
+                }
+                _flush_if_full();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write an mdarray
+            //!
+            //! \tparam OTYPES template parameters for mdarray
+            //! \param a the array to write
+            //!
+            template<typename ...OTYPES>
+            void write(const pni::core::mdarray<OTYPES...> &a)
+            {
+                auto shape = a.template shape<std::vector<size_t>>();
+                if(shape.size()<2)
+                    write_row(a.begin(),a.end());
+                else
+                    write_rows(a.begin(),a.end(),_row_size(shape,a.size()));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write an array
+            //!
+            //! For numeric, boolean and string arrays the values are read
+            //! directly from the buffer of the array without creating value
+            //! instances.
+            //!
+            //! \param a the array to write
+            //!
+            void write(const pni::core::array &a);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief write the buffer to the stream
+            //!
+            //! \throws file_error if writing to the stream fails
+            //!
+            void flush();
+    };
+
+//end of namespace
+}
+}
@@ -22,211 +22,536 @@
 //
 //
 
+#include <clocale>
+#include <cstdio>
+#include <cstring>
+#include <vector>
 #include <pni/io/formatters/scalar_format.hpp>
-#include <boost/format.hpp>
 
 namespace pni{
 namespace io{
     using namespace pni::core;
 
-#define SCALAR_FORMAT_FUNCTION(type) \
-    string format(type v)\
-    {\
-        return ""; \
-    }
+    const size_t format_config::full_precision;
 
-    //=========================================================================
-    string format(const uint8 &v)
-    {
-        boost::format fmt("%|+|");
-        fmt % uint16(v);
+    //-------------------------------------------------------------------------
+    format_config::format_config():
+        _always_sign(true),
+        _minimum_width(0),
+        _precision(full_precision)
+    {}
+
+    //-------------------------------------------------------------------------
+    format_config::format_config(size_t precision,size_t minimum_width,
+                                 bool always_sign):
+        _always_sign(always_sign),
+        _minimum_width(minimum_width),
+        _precision(precision)
+    {}
 
-        return fmt.str();
+    //-------------------------------------------------------------------------
+    bool format_config::always_sign() const
+    {
+        return _always_sign;
     }
 
-    //=========================================================================
-    string format(const int8 &v)
+    //-------------------------------------------------------------------------
+    size_t format_config::minimum_width() const
     {
-        boost::format fmt("%|+|");
-        fmt % int16(v);
-        return fmt.str();
+        return _minimum_width;
     }
 
-    //=========================================================================
-    string format(const uint16 &v)
+    //-------------------------------------------------------------------------
+    size_t format_config::precision() const
     {
-        boost::format fmt("%|+|");
-        fmt % v;
-        return fmt.str();
+        return _precision;
+    }
+
+    namespace {
+
+        //---------------------------------------------------------------------
+        //! result for a buffer which is too small
+        format_to_result too_large(char *last)
+        {
+            return {last,std::errc::value_too_large};
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief copy characters to the output buffer
+        //!
+        format_to_result copy(const char *data,size_t size,char *first,
+                              char *last)
+        {
+            if(size_t(last-first)<size) return too_large(last);
+            std::memcpy(first,data,size);
+            return {first+size,std::errc()};
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief pad the output with blanks to the minimum width
+        //!
+        //! The output in [first,result.ptr) is moved to the right if it is
+        //! shorter than the minimum width.
+        //!
+        format_to_result pad(char *first,char *last,format_to_result result,
+                             const format_config &config)
+        {
+            size_t size = result.ptr-first;
+            if(result.ec!=std::errc() || size>=config.minimum_width())
+                return result;
+
+            size_t n = config.minimum_width()-size;
+            if(size_t(last-result.ptr)<n) return too_large(last);
+
+            std::memmove(first+n,first,size);
+            std::memset(first,' ',n);
+            return {result.ptr+n,std::errc()};
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief write an unsigned integer
+        //!
+        //! Unsigned integers are written without sign.
+        //!
+        format_to_result write_integer(char *first,char *last,uint64 v,
+                                       char sign)
+        {
+            char buffer[24];
+            char *p = buffer+sizeof(buffer);
+            do
+            {
+                *--p = char('0'+v%10);
+                v /= 10;
+            }
+            while(v);
+            if(sign) *--p = sign;
+
+            return copy(p,buffer+sizeof(buffer)-p,first,last);
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief write a signed integer
+        //!
+        //! Positive numbers are written with sign if requested by the
+        //! configuration.
+        //!
+        format_to_result write_integer(char *first,char *last,int64 v,
+                                       const format_config &config)
+        {
+            uint64 magnitude = v<0 ? uint64(0)-uint64(v) : uint64(v);
+            char sign = v<0 ? '-' : (config.always_sign() ? '+' : 0);
+            return write_integer(first,last,magnitude,sign);
+        }
+
+        //---------------------------------------------------------------------
+        //! printf conversion for a floating point type
+        const char *float_format(float64,bool sign)
+        {
+            return sign ? "%+.*e" : "%.*e";
+        }
+
+        const char *float_format(float128,bool sign)
+        {
+            return sign ? "%+.*Le" : "%.*Le";
+        }
+
+        //---------------------------------------------------------------------
+        //! get the precision for a floating point type
+        template<typename T>
+        int float_precision(const format_config &config)
+        {
+            return config.precision()==format_config::full_precision ?
+                   int(max_format_size<T>::precision) :
+                   int(config.precision());
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief write a floating point number with printf
+        //!
+        //! Numbers are formatted as the former boost::format implementation
+        //! did, which used the same printf conversions. Like the C++
+        //! streams the output always uses a point as decimal separator
+        //! independent of the C locale.
+        //!
+        template<typename T>
+        format_to_result write_float(char *first,char *last,T v,
+                                     int precision,bool sign)
+        {
+            const char *format = float_format(v,sign);
+            char stack_buffer[max_scalar_format_size];
+            std::vector<char> heap_buffer;
+            char *buffer = stack_buffer;
+
+            int size = std::snprintf(buffer,sizeof(stack_buffer),format,
+                                     precision,v);
+            if(size<0) return too_large(last);
+            if(size_t(size)>=sizeof(stack_buffer))
+            {
+                //only for very large precisions
+                heap_buffer.resize(size+1);
+                buffer = heap_buffer.data();
+                std::snprintf(buffer,heap_buffer.size(),format,precision,v);
+            }
+
+            const char *point = std::localeconv()->decimal_point;
+            if(point[0]!='.' || point[1])
+            {
+                char *p = std::strstr(buffer,point);
+                if(p)
+                {
+                    size_t n = std::strlen(point);
+                    *p = '.';
+                    std::memmove(p+1,p+n,buffer+size-(p+n));
+                    size -= int(n-1);
+                }
+            }
+
+            return copy(buffer,size,first,last);
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief write a complex number
+        //!
+        //! The real part is written with sign followed by +I or -I and the
+        //! magnitude of the imaginary part.
+        //!
+        template<typename T>
+        format_to_result write_complex(char *first,char *last,
+                                       const std::complex<T> &v,
+                                       int precision,bool sign)
+        {
+            format_to_result result = write_float(first,last,v.real(),
+                                                  precision,sign);
+            if(result.ec!=std::errc()) return result;
+
+            bool negative = v.imag()<0;
+            result = copy(negative ? "-I" : "+I",2,result.ptr,last);
+            if(result.ec!=std::errc()) return result;
+
+            return write_float(result.ptr,last,
+                               negative ? -v.imag() : v.imag(),
+                               precision,false);
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief append a value to a string
+        //!
+        //! The value is written to a stack buffer. Only if the configuration
+        //! requires more space the output is written to the string
+        //! directly.
+        //!
+        template<typename T>
+        void append(string &output,const T &v,const format_config &config)
+        {
+            char buffer[max_scalar_format_size];
+            format_to_result result = format_to(buffer,
+                                                buffer+sizeof(buffer),
+                                                v,config);
+            if(result.ec==std::errc())
+            {
+                output.append(buffer,result.ptr);
+                return;
+            }
+
+            size_t size = output.size();
+            output.resize(size+max_format_size_of<T>(config));
+            result = format_to(&output[size],&output[0]+output.size(),v,
+                               config);
+            output.resize(result.ptr-&output[0]);
+        }
+
+        //---------------------------------------------------------------------
+        //! format a value into a new string
+        template<typename T>
+        string to_string(const T &v,const format_config &config)
+        {
+            char buffer[max_scalar_format_size];
+            format_to_result result = format_to(buffer,
+                                                buffer+sizeof(buffer),
+                                                v,config);
+            if(result.ec==std::errc())
+                return string(buffer,result.ptr);
+
+            string output;
+            append(output,v,config);
+            return output;
+        }
     }
 
     //=========================================================================
-    string format(const int16 &v)
+    size_t max_format_size_of(type_id_t tid,const format_config &config)
     {
-        boost::format fmt("%|+|");
-        fmt %v;
-        return fmt.str();
+        switch(tid)
+        {
+            case type_id_t::UINT8:      return max_format_size_of<uint8>(config);
+            case type_id_t::INT8:       return max_format_size_of<int8>(config);
+            case type_id_t::UINT16:     return max_format_size_of<uint16>(config);
+            case type_id_t::INT16:      return max_format_size_of<int16>(config);
+            case type_id_t::UINT32:     return max_format_size_of<uint32>(config);
+            case type_id_t::INT32:      return max_format_size_of<int32>(config);
+            case type_id_t::UINT64:     return max_format_size_of<uint64>(config);
+            case type_id_t::INT64:      return max_format_size_of<int64>(config);
+            case type_id_t::FLOAT32:    return max_format_size_of<float32>(config);
+            case type_id_t::FLOAT64:    return max_format_size_of<float64>(config);
+            case type_id_t::FLOAT128:   return max_format_size_of<float128>(config);
+            case type_id_t::COMPLEX32:  return max_format_size_of<complex32>(config);
+            case type_id_t::COMPLEX64:  return max_format_size_of<complex64>(config);
+            case type_id_t::COMPLEX128: return max_format_size_of<complex128>(config);
+            case type_id_t::BOOL:       return max_format_size_of<bool_t>(config);
+            default:                    return config.minimum_width();
+        }
     }
 
     //=========================================================================
-    string format(const uint32 &v)
+    format_to_result format_to(char *first,char *last,const uint8 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,v,0),config);
     }
 
-    //=========================================================================
-    string format(const int32 &v)
+    format_to_result format_to(char *first,char *last,const int8 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,int64(v),config),
+                   config);
     }
 
-    string format(const uint64 &v)
+    format_to_result format_to(char *first,char *last,const uint16 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,v,0),config);
     }
 
-    string format(const int64 &v)
+    format_to_result format_to(char *first,char *last,const int16 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,int64(v),config),
+                   config);
     }
 
-    string format(const float32 &v)
+    format_to_result format_to(char *first,char *last,const uint32 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+.9e|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,v,0),config);
     }
-    string format(const float64 &v)
+
+    format_to_result format_to(char *first,char *last,const int32 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+.17e|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,int64(v),config),
+                   config);
     }
 
-    string format(const float128 &v)
+    format_to_result format_to(char *first,char *last,const uint64 &v,
+                               const format_config &config)
     {
-        boost::format fmt("%|+.17e|");
-        fmt %v;
-        return fmt.str();
+        return pad(first,last,write_integer(first,last,v,0),config);
     }
 
-    string format(const complex32 &v)
+    format_to_result format_to(char *first,char *last,const int64 &v,
+                               const format_config &config)
     {
-        boost::format fmt_p("%|+.9e|+I%|.9e|");
-        boost::format fmt_m("%|+.9e|-I%|.9e|");
+        return pad(first,last,write_integer(first,last,v,config),config);
+    }
 
-        if(v.imag()<0)
-        {
-            fmt_m %v.real() %(-1.*v.imag());
-            return fmt_m.str();
-        }
-        else
-        {
-            fmt_p %v.real() %v.imag();
-            return fmt_p.str();
-        }
+    //-------------------------------------------------------------------------
+    format_to_result format_to(char *first,char *last,const float32 &v,
+                               const format_config &config)
+    {
+        return pad(first,last,
+                   write_float(first,last,float64(v),
+                               float_precision<float32>(config),
+                               config.always_sign()),
+                   config);
+    }
 
+    format_to_result format_to(char *first,char *last,const float64 &v,
+                               const format_config &config)
+    {
+        return pad(first,last,
+                   write_float(first,last,v,
+                               float_precision<float64>(config),
+                               config.always_sign()),
+                   config);
     }
-    string format(const complex64 &v)
+
+    format_to_result format_to(char *first,char *last,const float128 &v,
+                               const format_config &config)
     {
-        boost::format fmt_p("%|+.17e|+I%|.17e|");
-        boost::format fmt_m("%|+.17e|-I%|.17e|");
+        return pad(first,last,
+                   write_float(first,last,v,
+                               float_precision<float128>(config),
+                               config.always_sign()),
+                   config);
+    }
 
-        if(v.imag()<0)
-        {
-            fmt_m %v.real() %(-1.*v.imag());
-            return fmt_m.str();
-        }
-        else
-        {
-            fmt_p %v.real() %v.imag();
-            return fmt_p.str();
-        }
+    //-------------------------------------------------------------------------
+    format_to_result format_to(char *first,char *last,const complex32 &v,
+                               const format_config &config)
+    {
+        return pad(first,last,
+                   write_complex(first,last,complex64(v.real(),v.imag()),
+                                 float_precision<complex32>(config),
+                                 config.always_sign()),
+                   config);
     }
 
-    string format(const complex128 &v)
+    format_to_result format_to(char *first,char *last,const complex64 &v,
+                               const format_config &config)
     {
-        boost::format fmt_p("%|+.17e|+I%|.17e|");
-        boost::format fmt_m("%|+.17e|-I%|.17e|");
+        return pad(first,last,
+                   write_complex(first,last,v,
+                                 float_precision<complex64>(config),
+                                 config.always_sign()),
+                   config);
+    }
 
-        if(v.imag()<0)
-        {
-            fmt_m %v.real() %(-1.*v.imag());
-            return fmt_m.str();
-        }
-        else
-        {
-            fmt_p %v.real() %v.imag();
-            return fmt_p.str();
-        }
+    format_to_result format_to(char *first,char *last,const complex128 &v,
+                               const format_config &config)
+    {
+        return pad(first,last,
+                   write_complex(first,last,v,
+                                 float_precision<complex128>(config),
+                                 config.always_sign()),
+                   config);
     }
 
-    string format(const bool_t &v)
+    //-------------------------------------------------------------------------
+    format_to_result format_to(char *first,char *last,const bool_t &v,
+                               const format_config &config)
     {
-        if(v)
-            return "true";
-        else
-            return "false";
+        return pad(first,last,
+                   v ? copy("true",4,first,last) : copy("false",5,first,last),
+                   config);
     }
 
+    //=========================================================================
+#define PNIIO_FORMAT_TO_STRING(type)\
+    void format_to(string &output,const type &v,const format_config &config)\
+    {\
+        append(output,v,config);\
+    }
+
+    PNIIO_FORMAT_TO_STRING(uint8)
+    PNIIO_FORMAT_TO_STRING(int8)
+    PNIIO_FORMAT_TO_STRING(uint16)
+    PNIIO_FORMAT_TO_STRING(int16)
+    PNIIO_FORMAT_TO_STRING(uint32)
+    PNIIO_FORMAT_TO_STRING(int32)
+    PNIIO_FORMAT_TO_STRING(uint64)
+    PNIIO_FORMAT_TO_STRING(int64)
+    PNIIO_FORMAT_TO_STRING(float32)
+    PNIIO_FORMAT_TO_STRING(float64)
+    PNIIO_FORMAT_TO_STRING(float128)
+    PNIIO_FORMAT_TO_STRING(complex32)
+    PNIIO_FORMAT_TO_STRING(complex64)
+    PNIIO_FORMAT_TO_STRING(complex128)
+    PNIIO_FORMAT_TO_STRING(bool_t)
+#undef PNIIO_FORMAT_TO_STRING
+
     //-------------------------------------------------------------------------
-    string format(const string &s)
+    void format_to(string &output,const string &s,const format_config &config)
     {
-        return s;
+        if(s.size()<config.minimum_width())
+            output.append(config.minimum_width()-s.size(),' ');
+        output += s;
     }
 
     //-------------------------------------------------------------------------
-    string format(const value &v)
+    void format_to(string &output,const value &v,const format_config &config)
     {
         switch(v.type_id())
         {
             case type_id_t::UINT8:
-                return format(v.as<uint8>());
+                format_to(output,v.as<uint8>(),config); break;
             case type_id_t::INT8:
-                return format(v.as<int8>());
+                format_to(output,v.as<int8>(),config); break;
             case type_id_t::INT16:
-                return format(v.as<int16>());
+                format_to(output,v.as<int16>(),config); break;
             case type_id_t::UINT16:
-                return format(v.as<uint16>());
+                format_to(output,v.as<uint16>(),config); break;
             case type_id_t::UINT32:
-                return format(v.as<uint32>());
+                format_to(output,v.as<uint32>(),config); break;
             case type_id_t::INT32:
-                return format(v.as<int32>());
+                format_to(output,v.as<int32>(),config); break;
             case type_id_t::UINT64:
-                return format(v.as<uint64>());
+                format_to(output,v.as<uint64>(),config); break;
             case type_id_t::INT64:
-                return format(v.as<int64>());
+                format_to(output,v.as<int64>(),config); break;
             case type_id_t::FLOAT32:
-                return format(v.as<float32>());
+                format_to(output,v.as<float32>(),config); break;
             case type_id_t::FLOAT64:
-                return format(v.as<float64>());
+                format_to(output,v.as<float64>(),config); break;
             case type_id_t::FLOAT128:
-                return format(v.as<float128>());
+                format_to(output,v.as<float128>(),config); break;
             case type_id_t::COMPLEX32:
-                return format(v.as<complex32>());
+                format_to(output,v.as<complex32>(),config); break;
             case type_id_t::COMPLEX64:
-                return format(v.as<complex64>());
+                format_to(output,v.as<complex64>(),config); break;
             case type_id_t::COMPLEX128:
-                return format(v.as<complex128>());
+                format_to(output,v.as<complex128>(),config); break;
             case type_id_t::BOOL:
-                return format(v.as<bool_t>());
+                format_to(output,v.as<bool_t>(),config); break;
             case type_id_t::STRING:
-                return format(v.as<string>());
+                format_to(output,v.as<string>(),config); break;
             default:
-                return "";
+                break;
         }
     }
 
     //-------------------------------------------------------------------------
-    string format(const value_ref &)
+    void format_to(string &,const value_ref &,const format_config &)
+    {}
+
+    //=========================================================================
+#define PNIIO_FORMAT(type)\
+    string format(const type &v,const format_config &config)\
+    {\
+        return to_string(v,config);\
+    }
+
+    PNIIO_FORMAT(uint8)
+    PNIIO_FORMAT(int8)
+    PNIIO_FORMAT(uint16)
+    PNIIO_FORMAT(int16)
+    PNIIO_FORMAT(uint32)
+    PNIIO_FORMAT(int32)
+    PNIIO_FORMAT(uint64)
+    PNIIO_FORMAT(int64)
+    PNIIO_FORMAT(float32)
+    PNIIO_FORMAT(float64)
+    PNIIO_FORMAT(float128)
+    PNIIO_FORMAT(complex32)
+    PNIIO_FORMAT(complex64)
+    PNIIO_FORMAT(complex128)
+    PNIIO_FORMAT(bool_t)
+#undef PNIIO_FORMAT
+
+    //-------------------------------------------------------------------------
+    string format(const string &s,const format_config &config)
+    {
+        string output;
+        format_to(output,s,config);
+        return output;
+    }
+
+    //-------------------------------------------------------------------------
+    string format(const value &v,const format_config &config)
+    {
+        string output;
+        format_to(output,v,config);
+        return output;
+    }
+
+    //-------------------------------------------------------------------------
+    string format(const value_ref &,const format_config &)
     {
         return "";
     }
@@ -23,6 +23,7 @@
 //
 #pragma once
 
+#include <system_error>
 #include <pni/core/types.hpp>
 #include <pni/core/type_erasures.hpp>
 #include <pni/io/windows.hpp>
@@ -38,44 +39,349 @@ namespace io{
     //! This class contains a set of parameters independent of the underlying
     //! output mechanism. It an be used to configure whatever method for
     //! writing numbers is used to so that the desired result can be achieved.
-    //! qppq
-
-    class format_config
+    //!
+    //! * the precision is the number of digits after the decimal point of
+    //!   floating point numbers and of both parts of complex numbers. By
+    //!   default all digits required to restore the value are written
+    //!   (9 for 32-bit and 17 for 64-bit and larger types).
+    //! * the minimum width of the output. Shorter output is padded with
+    //!   blanks on the left.
+    //! * whether positive numbers of signed integer, floating point and
+    //!   complex types are written with a + sign. Unsigned integers are
+    //!   always written without sign.
+    //!
+    //! ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+    //! format(1.2,format_config(3));         // "+1.200e+00"
+    //! format(1.2,format_config(3,12,false)); // "   1.200e+00"
+    //! ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    //!
+    //! Like container_io_config instances can only be configured during
+    //! construction.
+    //!
+    class PNIIO_EXPORT format_config
     {
     private:
         bool   _always_sign;    //!< always show the sign
         size_t _minimum_width;  //!< the minimum widht (length) of the field
-        size_t _precission;     //!< the numeric precision
+        size_t _precision;      //!< the numeric precision
 
     public:
+        //! precision value selecting the full precision of a type
+        static const size_t full_precision = static_cast<size_t>(-1);
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief default constructor
+        //!
+        //! Numbers are written with full precision, without padding and
+        //! with sign.
+        //!
+        format_config();
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief constructor
+        //!
+        //! \param precision number of digits after the decimal point
+        //! \param minimum_width minimum number of characters
+        //! \param always_sign write + for positive numbers
+        //!
+        explicit format_config(size_t precision,size_t minimum_width=0,
+                               bool always_sign=true);
+
+        //---------------------------------------------------------------------
+        //! true if positive numbers are written with sign
+        bool always_sign() const;
+
+        //---------------------------------------------------------------------
+        //! get the minimum width of the output
+        size_t minimum_width() const;
+
+        //---------------------------------------------------------------------
+        //! get the precision, full_precision for the default
+        size_t precision() const;
     };
 
     template<typename T> struct format_str {};
 
+    //!
+    //! \ingroup formatter_classes
+    //! \brief result of format_to
+    //!
+    //! ptr points after the last character written. If the buffer is too
+    //! small ec is std::errc::value_too_large, ptr is equal to the end of
+    //! the buffer and the content of the buffer is unspecified.
+    //!
+    struct format_to_result
+    {
+        char *ptr;    //!< end of the output
+        std::errc ec; //!< error code - a value initialized errc on success
+    };
+
+    //!
+    //! \ingroup formatter_classes
+    //! \brief maximum number of characters written for a type
+    //!
+    //! value is the maximum number of characters format writes for a
+    //! scalar of type T with the default format_config. For strings and
+    //! other types without an upper bound value is 0. precision is the
+    //! default precision of floating point types and parts the number of
+    //! floating point numbers written (2 for complex types).
+    //!
+    //! \tparam T scalar type
+    //!
+    template<typename T> struct max_format_size
+    {
+        static const size_t value = 0;     //!< maximum size
+        static const size_t precision = 0; //!< default precision
+        static const size_t parts = 0;     //!< number of floating point parts
+    };
+
+    //! \cond internal
+#define PNIIO_MAX_FORMAT_SIZE(type,size,prec,nparts)\
+    template<> struct max_format_size<type>\
+    {\
+        static const size_t value = size;\
+        static const size_t precision = prec;\
+        static const size_t parts = nparts;\
+    };
+
+    PNIIO_MAX_FORMAT_SIZE(pni::core::uint8,3,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::int8,4,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::uint16,5,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::int16,6,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::uint32,10,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::int32,11,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::uint64,20,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::int64,20,0,0)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::float32,16,9,1)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::float64,25,17,1)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::float128,26,17,1)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::complex32,2*16+2,9,2)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::complex64,2*25+2,17,2)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::complex128,2*26+2,17,2)
+    PNIIO_MAX_FORMAT_SIZE(pni::core::bool_t,5,0,0)
+#undef PNIIO_MAX_FORMAT_SIZE
+    //! \endcond
+
+    //!
+    //! \ingroup formatter_classes
+    //! \brief maximum number of characters written for a type
+    //!
+    //! \tparam T scalar type
+    //! \param config the format configuration
+    //! \return maximum size of the output for numeric types, the minimum
+    //! width for all other types
+    //!
+    template<typename T>
+    size_t max_format_size_of(const format_config &config)
+    {
+        typedef max_format_size<T> trait_type;
+
+        size_t size = trait_type::value;
+        if(config.precision()!=format_config::full_precision)
+            size = size - trait_type::parts*trait_type::precision
+                        + trait_type::parts*config.precision();
+
+        return size<config.minimum_width() ? config.minimum_width() : size;
+    }
+
+    //!
+    //! \ingroup formatter_classes
+    //! \brief maximum number of characters written for a type
+    //!
+    //! Runtime version of max_format_size for type erasures.
+    //!
+    //! \param tid type id of the scalar
+    //! \param config the format configuration
+    //! \return maximum size of the output, the minimum width if there is
+    //! no upper bound
+    //!
+    size_t PNIIO_EXPORT max_format_size_of(pni::core::type_id_t tid,
+                                           const format_config &config=format_config());
+
+    //!
+    //! \ingroup formatter_classes
+    //! \brief size of a buffer large enough for any numeric scalar
+    //!
+    const size_t max_scalar_format_size = 64;
+
+    //!
+    //! \ingroup formatter_classes
+    //! \brief write a scalar to a buffer
+    //!
+    //! Writes the same characters as format() to [first,last) without
+    //! allocating memory. With the default configuration a buffer of
+    //! max_scalar_format_size characters is sufficient for all numeric
+    //! types, otherwise max_format_size_of() characters are required.
+    //!
+    //! \param first pointer to the beginning of the buffer
+    //! \param last pointer after the end of the buffer
+    //! \param v the value to write
+    //! \param config the format configuration
+    //! \return end of the output and error code
+    //!
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::uint8 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::int8 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::uint16 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::int16 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::uint32 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::int32 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::uint64 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::int64 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::float32 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::float64 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::float128 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::complex32 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::complex64 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::complex128 &v,
+                                            const format_config &config=format_config());
+    format_to_result PNIIO_EXPORT format_to(char *first,char *last,
+                                            const pni::core::bool_t &v,
+                                            const format_config &config=format_config());
 
+    //!
+    //! \ingroup formatter_classes
+    //! \brief append a scalar to a string
+    //!
+    //! Appends the same characters as format() to output. The string can
+    //! be reused for many values, in which case no memory is allocated
+    //! once its capacity is sufficient.
+    //!
+    //! \param output the string to append to
+    //! \param v the value to write
+    //! \param config the format configuration
+    //!
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::uint8 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::int8 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::uint16 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::int16 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::uint32 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::int32 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::uint64 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::int64 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::float32 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::float64 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::float128 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::complex32 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::complex64 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::complex128 &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::bool_t &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::string &s,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::value &v,
+                                const format_config &config=format_config());
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::value_ref &v,
+                                const format_config &config=format_config());
 
-    pni::core::string PNIIO_EXPORT format(const pni::core::uint8 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::int8 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::uint16 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::int16 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::uint32 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::int32 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::uint64 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::int64 &v);
+    //!
+    //! \ingroup formatter_classes
+    //! \brief format a scalar
+    //!
+    //! \param v the value to write
+    //! \param config the format configuration
+    //! \return string representation of the value
+    //!
+    pni::core::string PNIIO_EXPORT format(const pni::core::uint8 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::int8 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::uint16 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::int16 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::uint32 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::int32 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::uint64 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::int64 &v,
+                                          const format_config &config=format_config());
 
-    pni::core::string PNIIO_EXPORT format(const pni::core::float32 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::float64 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::float128 &v);
+    pni::core::string PNIIO_EXPORT format(const pni::core::float32 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::float64 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::float128 &v,
+                                          const format_config &config=format_config());
 
-    pni::core::string PNIIO_EXPORT format(const pni::core::complex32 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::complex64 &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::complex128 &v);
+    pni::core::string PNIIO_EXPORT format(const pni::core::complex32 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::complex64 &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::complex128 &v,
+                                          const format_config &config=format_config());
 
-    pni::core::string PNIIO_EXPORT format(const pni::core::bool_t &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::string &s);
+    pni::core::string PNIIO_EXPORT format(const pni::core::bool_t &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::string &s,
+                                          const format_config &config=format_config());
 
-    pni::core::string PNIIO_EXPORT format(const pni::core::value &v);
-    pni::core::string PNIIO_EXPORT format(const pni::core::value_ref &v);
+    pni::core::string PNIIO_EXPORT format(const pni::core::value &v,
+                                          const format_config &config=format_config());
+    pni::core::string PNIIO_EXPORT format(const pni::core::value_ref &v,
+                                          const format_config &config=format_config());
 
 }
 }
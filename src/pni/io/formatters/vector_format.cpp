@@ -29,23 +29,22 @@ namespace io{
 
     using namespace pni::core;
 
-    pni::core::string format(const pni::core::array &v,
-                             const container_io_config &config)
+    void format_to(string &output,const array &v,
+                   const container_io_config &config,
+                   const format_config &value_config)
     {
-        using namespace pni::core;
+        format_range_to(output,v.begin(),v.end(),config,value_config);
+    }
 
+    //-------------------------------------------------------------------------
+    string format(const array &v,const container_io_config &config,
+                  const format_config &value_config)
+    {
         string output;
-        if(config.start_symbol())
-            output+=string(1,config.start_symbol());
-
-        for(const auto &value: v)
-            output+=format(value)+string(1,config.separator());
-
-        if(config.stop_symbol())
-            output[output.size()-1]=config.stop_symbol();
-        else
-            output = string(output.begin(),--output.end());
-
+        output.reserve(format_size_hint(
+                       max_format_size_of(v.type_id(),value_config),
+                       v.size()));
+        format_to(output,v,config,value_config);
         return output;
     }
 }
@@ -34,26 +34,115 @@
 namespace pni{
 namespace io{
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_internal_classes
+    //! \brief append a range of values to a string
+    //!
+    //! Writes the start symbol, the values separated by the separator and
+    //! the stop symbol. The values are appended to the output directly
+    //! without creating temporary strings.
+    //!
+    //! \tparam ITER iterator type
+    //! \param output the string to append to
+    //! \param first iterator to the first value
+    //! \param last iterator after the last value
+    //! \param config container configuration
+    //! \param value_config format configuration for the values
+    //!
+    template<typename ITER>
+    void format_range_to(pni::core::string &output,ITER first,ITER last,
+                         const container_io_config &config,
+                         const format_config &value_config=format_config())
+    {
+        if(config.start_symbol()) output += config.start_symbol();
+
+        for(ITER iter = first;iter!=last;++iter)
+        {
+            if(iter!=first) output += config.separator();
+            format_to(output,*iter,value_config);
+        }
+
+        if(config.stop_symbol()) output += config.stop_symbol();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_internal_classes
+    //! \brief estimate the size of a formatted container
+    //!
+    //! \param element_size maximum size of an element
+    //! \param n number of elements
+    //! \return upper bound of the output size for numeric types
+    //!
+    inline size_t format_size_hint(size_t element_size,size_t n)
+    {
+        return n*(element_size+1)+2;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_classes
+    //! \brief append a vector to a string
+    //!
+    //! \param output the string to append to
+    //! \param v the vector to write
+    //! \param config container configuration
+    //! \param value_config format configuration for the elements
+    //!
+    template<typename T>
+    void format_to(pni::core::string &output,const std::vector<T> &v,
+                   const container_io_config &config=container_io_config(),
+                   const format_config &value_config=format_config())
+    {
+        format_range_to(output,v.begin(),v.end(),config,value_config);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_classes
+    //! \brief formatter for std::vector instances
+    //!
+    //! For numeric element types the output is built with a single
+    //! allocation.
+    //!
+    //! \param v the vector to write
+    //! \param config container configuration
+    //! \param value_config format configuration for the elements
+    //! \return string representation of the vector
+    //!
     template<typename T>
     pni::core::string format(const std::vector<T> &v,
-                             const container_io_config &config=container_io_config())
+                             const container_io_config &config=container_io_config(),
+                             const format_config &value_config=format_config())
     {
         using namespace pni::core;
 
         string output;
-        if(config.start_symbol())
-            output+=string(1,config.start_symbol());
-
-        for(const auto &value: v)
-            output+=format(value)+string(1,config.separator());
-
-        if(config.stop_symbol())
-            output[output.size()-1]=config.stop_symbol();
-        else
-            output = string(output.begin(),--output.end());
-
+        output.reserve(format_size_hint(max_format_size_of<T>(value_config),
+                                        v.size()));
+        format_to(output,v,config,value_config);
         return output;
+    }
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_classes
+    //! \brief append an mdarray to a string
+    //!
+    //! \tparam OTYPES template parameters for mdarray
+    //! \param output the string to append to
+    //! \param v the array to write
+    //! \param config container configuration
+    //! \param value_config format configuration for the elements
+    //!
+    template<typename ...OTYPES>
+    void format_to(pni::core::string &output,
+                   const pni::core::mdarray<OTYPES...> &v,
+                   const container_io_config &config=container_io_config(),
+                   const format_config &value_config=format_config())
+    {
+        format_range_to(output,v.begin(),v.end(),config,value_config);
     }
 
     //-------------------------------------------------------------------------
@@ -65,30 +154,54 @@ namespace io{
     //! template.
     //!
     //! \tparam OTYPES template parameters for mdarray
+    //! \param v the array to write
+    //! \param config container configuration
+    //! \param value_config format configuration for the elements
+    //! \return string representation of the array
     //!
     template<typename ...OTYPES>
     pni::core::string format(const pni::core::mdarray<OTYPES...> &v,
-                             const container_io_config &config=container_io_config())
+                             const container_io_config &config=container_io_config(),
+                             const format_config &value_config=format_config())
     {
         using namespace pni::core;
+        typedef typename mdarray<OTYPES...>::value_type value_type;
 
         string output;
-        if(config.start_symbol())
-            output+=string(1,config.start_symbol());
-
-        for(const auto &value: v)
-            output+=format(value)+string(1,config.separator());
-
-        if(config.stop_symbol())
-            output[output.size()-1]=config.stop_symbol();
-        else
-            output = string(output.begin(),--output.end());
-
+        output.reserve(format_size_hint(
+                       max_format_size_of<value_type>(value_config),v.size()));
+        format_to(output,v,config,value_config);
         return output;
     }
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_classes
+    //! \brief append an array to a string
+    //!
+    //! \param output the string to append to
+    //! \param v the array to write
+    //! \param config container configuration
+    //! \param value_config format configuration for the elements
+    //!
+    void PNIIO_EXPORT format_to(pni::core::string &output,
+                                const pni::core::array &v,
+                                const container_io_config &config=container_io_config(),
+                                const format_config &value_config=format_config());
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup formatter_classes
+    //! \brief formatter for array instances
+    //!
+    //! \param v the array to write
+    //! \param config container configuration
+    //! \param value_config format configuration for the elements
+    //! \return string representation of the array
+    //!
     pni::core::string PNIIO_EXPORT format(const pni::core::array &v,
-                             const container_io_config &config=container_io_config());
+                             const container_io_config &config=container_io_config(),
+                             const format_config &value_config=format_config());
 
 }
 }
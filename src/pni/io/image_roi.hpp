@@ -0,0 +1,108 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#pragma once
+
+#include <iostream>
+#include <pni/core/types.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup io_classes
+    //! \brief region of interest of an image
+    //!
+    //! A rectangular part of an image. Following the image model x is the 
+    //! slow (row) and y the fast (column) index. Image data read for a 
+    //! region of interest is stored row by row with ny() pixels per row.
+    //!
+    class PNIIO_EXPORT image_roi
+    {
+        private:
+            size_t _x;  //!< index of the first row
+            size_t _y;  //!< index of the first column
+            size_t _nx; //!< number of rows
+            size_t _ny; //!< number of columns
+        public:
+            //-----------------------------------------------------------------
+            //! default constructor - an empty region
+            image_roi():
+                _x(0),
+                _y(0),
+                _nx(0),
+                _ny(0)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief standard constructor
+            //!
+            //! \param x index of the first row
+            //! \param y index of the first column
+            //! \param nx number of rows
+            //! \param ny number of columns
+            //!
+            image_roi(size_t x,size_t y,size_t nx,size_t ny):
+                _x(x),
+                _y(y),
+                _nx(nx),
+                _ny(ny)
+            {}
+
+            //-----------------------------------------------------------------
+            //! get index of the first row
+            size_t x() const { return _x; }
+
+            //-----------------------------------------------------------------
+            //! get index of the first column
+            size_t y() const { return _y; }
+
+            //-----------------------------------------------------------------
+            //! get number of rows
+            size_t nx() const { return _nx; }
+
+            //-----------------------------------------------------------------
+            //! get number of columns
+            size_t ny() const { return _ny; }
+
+            //-----------------------------------------------------------------
+            //! get number of pixels in the region
+            size_t npixels() const { return _nx*_ny; }
+    };
+
+    //-------------------------------------------------------------------------
+    //! 
+    //! \ingroup io_classes
+    //! \brief output operator for a region of interest
+    //!
+    inline std::ostream &operator<<(std::ostream &o,const image_roi &roi)
+    {
+        return o<<"["<<roi.x()<<":"<<roi.x()+roi.nx()<<","
+                <<roi.y()<<":"<<roi.y()+roi.ny()<<"]";
+    }
+
+//end of namespace
+}
+}
@@ -21,75 +21,123 @@
 // Created on: Dec 18, 2017
 //
 #include <pni/io/nexus/path/utils.hpp>
-#include <pni/io/nexus/path/make_relative.hpp>
+#include <pni/io/nexus/path/path_matcher.hpp>
 #include <pni/io/nexus/containers.hpp>
-#include <algorithm>
 
 namespace pni {
 namespace io {
 namespace nexus {
 
-bool is_resolvable(const hdf5::node::Link &link)
+namespace {
+
+//
+// true if name can be the name of a link
+//
+bool is_link_name(const std::string &name)
 {
-  try
-  {
-    *link;
-    return true;
-  }
-  catch(...)
+  return !name.empty() && name != "." && name != ".." &&
+         name.find('/') == std::string::npos;
+}
+
+//
+// the NeXus class of a group - empty for all other nodes
+//
+std::string get_class(const hdf5::node::Node &node)
+{
+  std::string node_class;
+  if(node.type() == hdf5::node::Type::GROUP &&
+     node.attributes.exists("NX_class"))
   {
-    return false;
+    hdf5::attribute::Attribute nx_class = node.attributes["NX_class"];
+    hdf5::datatype::String file_type = nx_class.datatype();
+    nx_class.read(node_class,file_type);
   }
+  return node_class;
 }
 
-class AbsolutePathMatcher
+//
+// Recursive search with a compiled path. Every link below a group is
+// matched against a single element of the query path. Subtrees are only
+// entered if the path to them matches the query so far, thus the search
+// never goes deeper than the query path and no full path has to be
+// constructed for a link.
+//
+class ObjectSearch
 {
   public:
-    AbsolutePathMatcher(const Path &path):
-      path_(path)
+    ObjectSearch(const PathMatcher &matcher,PathObjectList &list):
+      matcher_(matcher),
+      list_(list)
     {}
 
-    bool operator()(const hdf5::node::Link &link) const
+    //
+    // search the links of group for the element at position index of the
+    // query path - returns true if the search is finished
+    //
+    bool search(const hdf5::node::Group &group,size_t index)
     {
-      Path path;
-      if(!is_resolvable(link))
-        path = get_path(link);
-      else
-        path = get_path(*link);
-
-      bool result = match(path,path_);
-      return result;
-    }
+      const std::string &name = matcher_.name(index);
 
-  private:
-    Path path_;
-};
+      //only a single link can match a named element
+      if(!name.empty())
+      {
+        if(!is_link_name(name) || !group.links.exists(name))
+          return false;
 
-class RelativePathMatcher
-{
-  public:
-    RelativePathMatcher(const Path &path,const Path &base_path):
-      path_(path),
-      base_path_(base_path)
-    {}
+        return visit(group.links[name],index);
+      }
 
-    bool operator()(const hdf5::node::Link &link) const
-    {
-      Path path;
-      if(!is_resolvable(link))
-        path = get_path(link);
-      else
-        path = get_path(*link);
-
-      path = make_relative(base_path_,path);
-      return match(path,path_);
+      for(auto link: group.links)
+        if(visit(link,index)) return true;
+
+      return false;
     }
 
   private:
-    Path path_;
-    Path base_path_;
+    const PathMatcher &matcher_;
+    PathObjectList &list_;
+
+    bool visit(const hdf5::node::Link &link,size_t index)
+    {
+      std::string name = link.path().name();
+      if(!matcher_.match_name(index,name)) return false;
+
+      bool last = index+1 == matcher_.size();
+
+      //an unresolvable link has only a name
+      if(!link.is_resolvable())
+      {
+        if(!last || !matcher_.match(index,{name,std::string()}))
+          return false;
+
+        list_.push_back(PathObject(link));
+        return matcher_.is_unique();
+      }
+
+      hdf5::node::Node node = *link;
+      if(node.type() != hdf5::node::Type::GROUP &&
+         node.type() != hdf5::node::Type::DATASET)
+        return false;
+
+      //the class is only read if the query requires it
+      if(matcher_.requires_class(index) &&
+         !matcher_.match(index,{name,get_class(node)}))
+        return false;
+
+      if(last)
+      {
+        list_.push_back(PathObject(node));
+        return matcher_.is_unique();
+      }
+
+      if(node.type() != hdf5::node::Type::GROUP) return false;
+
+      return search(hdf5::node::Group(node),index+1);
+    }
 };
 
+} // anonymous namespace
+
 PathObjectList get_objects(const hdf5::node::Group &base,const Path &path)
 {
   PathObjectList list;
@@ -121,15 +169,22 @@ PathObjectList get_objects(const hdf5::node::Group &base,const Path &path)
   }
   else
   {
-    auto iter_begin = hdf5::node::RecursiveLinkIterator::begin(base);
-    auto iter_end = hdf5::node::RecursiveLinkIterator::end(base);
+    PathMatcher matcher(path);
+    size_t index = 0;
 
-    if(is_absolute(path))
-      std::copy_if(iter_begin,iter_end,std::back_inserter(list),AbsolutePathMatcher(path));
-    else
+    //for an absolute path the path of base must match the first elements
+    //of the query and the search continues below them
+    if(matcher.is_absolute())
     {
-      std::copy_if(iter_begin,iter_end,std::back_inserter(list),RelativePathMatcher(path,get_path(base)));
+      Path base_path = get_path(base);
+      if(base_path.size() >= matcher.size()) return list;
+
+      for(const auto &element: base_path)
+        if(!matcher.match(index++,element)) return list;
     }
+
+    if(index<matcher.size())
+      ObjectSearch(matcher,list).search(base,index);
   }
 
   return list;
@@ -81,12 +81,10 @@ Path make_relative(const Path &parent_path,const Path &orig_path)
   }
   else
   {
-    new_path = Path(orig_path);
-    new_path.filename(""); //reset the file name part
-    for(size_t element_index = 0;
-        element_index < parent_path.size();
-        element_index++)
-      new_path.pop_front();
+    //only the elements following the parent path are kept, the
+    //file name part is reset
+    new_path = Path("",Path::ElementList(orig_path.begin()+parent_path.size(),
+                                         orig_path.end()),"");
   }
 
   //
@@ -23,80 +23,87 @@
 
 #include <pni/io/nexus/path/parser.hpp>
 #include <pni/io/exceptions.hpp>
-#include <boost/algorithm/string/predicate.hpp>
-#include <boost/regex.hpp>
-#include <boost/algorithm/string/split.hpp>
-#include <boost/algorithm/string/trim.hpp>
 #include <algorithm>
+#include <sstream>
 
 namespace pni{
 namespace io{
 namespace nexus{
 namespace parsers{
 
-namespace algo = boost::algorithm;
-
 static const std::string file_sep="://";
 
-Path::Element get_element(const std::string &estr)
+//!
+//! \brief true if a character is allowed in names and classes
+//!
+//! Names and classes consist of the characters [A-Za-z0-9_-].
+//!
+static bool is_element_char(char c)
 {
-  using namespace pni::core;
-  boost::regex expr("^(?<GNAME>[A-Za-z0-9_-]+)?(:(?<GTYPE>[A-Za-z0-0_-]+))?$");
-
-  if(estr=="." || estr == "..")
-    return {estr,string()};
+  return (c>='A' && c<='Z') || (c>='a' && c<='z') || (c>='0' && c<='9') ||
+         c=='_' || c=='-';
+}
 
-  boost::smatch result;
-  if(boost::regex_match(estr,result,expr))
-  {
-    string group_name = result.str("GNAME"),
-        group_type = result.str("GTYPE");
+//!
+//! \brief parse a single element
+//!
+//! An element has the form name, name:class or :class.
+//!
+Path::Element get_element(const char *first,const char *last)
+{
+  using namespace pni::core;
 
-    if(group_name.empty() && group_type.empty())
-    {
-      throw parser_error(EXCEPTION_RECORD,"Missing path element!");
-    }
+  if((last-first==1 && first[0]=='.') ||
+     (last-first==2 && first[0]=='.' && first[1]=='.'))
+    return {string(first,last),string()};
 
-    return {group_name,group_type};
+  const char *colon = std::find(first,last,':');
+  bool valid = std::all_of(first,colon,is_element_char);
+  if(colon!=last)
+    valid = valid && (colon+1!=last) &&
+            std::all_of(colon+1,last,is_element_char);
 
-  }
-  else
+  if(!valid)
   {
     std::stringstream ss;
-    ss<<"The element ["<<estr<<"] is not a valid NeXus path element!";
+    ss<<"The element ["<<string(first,last)<<"] is not a valid NeXus path element!";
     throw parser_error(EXCEPTION_RECORD,ss.str());
   }
+
+  if(first==last)
+    throw parser_error(EXCEPTION_RECORD,"Missing path element!");
+
+  return {string(first,colon),colon==last ? string() : string(colon+1,last)};
 }
 
 Path parse_path(const std::string &input)
 {
   using namespace pni::core;
 
+  const char *first = input.data();
+  const char *last = first+input.size();
   string file_part,attribute_part;
 
   // -------------------------------------------------------------------
   // check for an attribute section
   // -------------------------------------------------------------------
-  auto attr_sign = std::find(input.begin(),input.end(),'@');
+  const char *attr_sign = std::find(first,last,'@');
 
-  if(attr_sign!=input.end())
-  {
-    attribute_part = string(++attr_sign,input.end());
-    attr_sign--;
-  }
+  if(attr_sign!=last)
+    attribute_part.assign(attr_sign+1,last);
 
   // -------------------------------------------------------------------
   // check for file section
   // -------------------------------------------------------------------
-  auto file_end = std::search(input.begin(),input.end(),
-                              file_sep.begin(),file_sep.end());
-  if(file_end!=input.end())
+  const char *file_end = std::search(first,attr_sign,
+                                     file_sep.begin(),file_sep.end());
+  if(file_end!=attr_sign)
   {
-    file_part = string(input.begin(),file_end);
+    file_part.assign(first,file_end);
     std::advance(file_end,2);
   }
   else
-    file_end = input.begin(); //need to reset the iterator here
+    file_end = first; //need to reset the iterator here
 
 
   // --------------------------------------------------------------------
@@ -104,49 +111,32 @@ Path parse_path(const std::string &input)
   // --------------------------------------------------------------------
   Path::ElementList elements;
 
-  if(*file_end=='/') //check for the root group
+  if(file_end!=attr_sign && *file_end=='/') //check for the root group
   {
     elements.push_back({"/","NXroot"});
     std::advance(file_end,1);
   }
 
-  string elements_part(file_end,attr_sign);
-
-  if(!elements_part.empty())
+  //split all element entries in the path by / - empty entries are
+  //ignored
+  while(file_end!=attr_sign)
   {
-    //split all element entries in the path by /
-    std::vector<string> element_strings;
-    boost::split(element_strings,elements_part,
-                 boost::is_any_of("/"),boost::token_compress_on);
-
-    //there can be some empty values which we should remove from the list
-    auto new_end = std::remove_if(element_strings.begin(),
-                                  element_strings.end(),
-                                  [](const string &value)
-                                  {
-      return value.empty();
-                                  }
-    );
-    std::transform(element_strings.begin(),new_end,
-                   std::back_inserter(elements),
-                   get_element);
+    const char *element_end = std::find(file_end,attr_sign,'/');
+    if(element_end!=file_end)
+      elements.push_back(get_element(file_end,element_end));
+
+    file_end = element_end==attr_sign ? element_end : element_end+1;
   }
 
   //remove possible duplicate root entries
   if(elements.size()>1)
   {
-    auto iter = elements.begin();
-    if(iter->first=="/" && iter->second=="NXroot")
-    {
-      std::advance(iter,1);
-      if(iter->second=="NXroot")
-      {
-        elements.erase(iter);
-      }
-    }
+    if(elements[0].first=="/" && elements[0].second=="NXroot" &&
+       elements[1].second=="NXroot")
+      elements.erase(elements.begin()+1);
   }
 
-  return Path(file_part,elements,attribute_part);
+  return Path(file_part,std::move(elements),attribute_part);
 }
 
 //end of namespace
@@ -22,6 +22,8 @@
 //
 
 #include <sstream>
+#include <algorithm>
+#include <vector>
 #include <pni/core/error.hpp>
 #include <pni/io/nexus/path/path.hpp>
 #include <pni/io/nexus/path/parser.hpp>
@@ -53,8 +55,7 @@ Path::Path(const hdf5::Path &path):
     auto new_pos = std::remove_if(_elements.begin(),_elements.end(),
                                   [](const Element &element)
                                   { return element.first == "."; });
-    if(new_pos!=_elements.end())
-      _elements.erase(new_pos);
+    _elements.erase(new_pos,_elements.end());
   }
 }
 
@@ -63,7 +64,8 @@ Path::operator hdf5::Path()
   if(is_unique(*this))
   {
     //get all object names from the NeXus path
-    std::list<std::string> object_names;
+    std::vector<std::string> object_names;
+    object_names.reserve(size());
     std::transform(begin(),end(),std::back_inserter(object_names),
                    [](const Element &element) { return element.first; });
 
@@ -90,11 +92,11 @@ Path::operator hdf5::Path()
 
 //-------------------------------------------------------------------------
 Path::Path(const boost::filesystem::path &file,
-           const Path::ElementList &objects,
+           Path::ElementList objects,
            const std::string &attr):
     _file_name(file.string()),
     _attribute_name(attr),
-    _elements(objects)
+    _elements(std::move(objects))
 {}
 
 //-------------------------------------------------------------------------
@@ -168,13 +170,13 @@ void Path::push_front(const Element &o)
   if(o.first==".")
     return;
 
-  _elements.push_front(o);
+  _elements.insert(_elements.begin(),o);
 }
     
 //-------------------------------------------------------------------------
 void Path::pop_front()
 {
-  _elements.pop_front();
+  _elements.erase(_elements.begin());
 }
 
 //-------------------------------------------------------------------------
@@ -183,12 +185,6 @@ void Path::pop_back()
   _elements.pop_back();
 }
 
-//-------------------------------------------------------------------------
-Path::Element Path::back() const
-{
-  return _elements.back();
-}
-
 //-------------------------------------------------------------------------
 size_t Path::size() const
 {
@@ -24,7 +24,7 @@
 
 #include <utility>
 #include <pni/core/types.hpp>
-#include <list>
+#include <boost/container/small_vector.hpp>
 #include <pni/io/windows.hpp>
 #include <boost/filesystem.hpp>
 #include <h5cpp/hdf5.hpp>
@@ -60,13 +60,20 @@ namespace nexus{
 //! object. However, a path with a filename part is always absolute (for
 //! obvious reasons).
 //!
+//! The elements are stored contiguously. Paths with up to
+//! inline_capacity elements do not allocate memory for the element
+//! sequence and element names short enough for the small string
+//! optimization of std::string are stored without allocation too.
+//!
 class PNIIO_EXPORT Path
 {
   public:
     //! object element (groupname:class)
     using Element = std::pair<pni::core::string,pni::core::string>;
+    //! number of elements stored without allocating memory
+    static constexpr size_t inline_capacity = 8;
     //! a list of subsequent objects
-    using ElementList =  std::list<Element>;
+    using ElementList = boost::container::small_vector<Element,inline_capacity>;
     //! iterator over elements
     using ElementIterator =  ElementList::iterator;
     //! const iterator over elements
@@ -101,7 +108,7 @@ class PNIIO_EXPORT Path
     //! \param attr the optional name of an attribute
     //!
     Path(const boost::filesystem::path &file,
-         const ElementList &groups,
+         ElementList groups,
          const pni::core::string &attr);
 
     //!
@@ -223,37 +230,43 @@ class PNIIO_EXPORT Path
 
     //----------------------------------------------------------------
     //!
-    //! \brief last element from path
+    //! \brief remove first element from path
     //!
     void pop_front();
 
     //----------------------------------------------------------------
     //!
-    //! \brief remove first element from path
+    //! \brief remove last element from path
     //!
     void pop_back();
 
     //-----------------------------------------------------------------
     //!
-    //! \brief get last element
+    //! \brief get first element
     //!
-    //! Return the last element of the Nexus path.
+    //! Return the first element of the Nexus path. The path must not be
+    //! empty.
     //!
-    //! \return last element
-    Element front() const
+    //! \return reference to the first element
+    //!
+    const Element &front() const
     {
       return _elements.front();
     }
 
     //----------------------------------------------------------------
     //!
-    //! \brief get first element
+    //! \brief get last element
     //!
-    //! Return the first element of the Nexus path
+    //! Return the last element of the Nexus path. The path must not be
+    //! empty.
     //!
-    //! \return first element
+    //! \return reference to the last element
     //!
-    Element back() const;
+    const Element &back() const
+    {
+      return _elements.back();
+    }
 
     //------------------------------------------------------------------
     //!
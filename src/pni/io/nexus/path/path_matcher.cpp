@@ -0,0 +1,90 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+#include <pni/io/nexus/path/path_matcher.hpp>
+#include <pni/io/nexus/path/utils.hpp>
+
+namespace pni{
+namespace io{
+namespace nexus{
+
+PathMatcher::PathMatcher(const Path &path):
+  _elements(),
+  _attribute(path.attribute()),
+  _absolute(nexus::is_absolute(path)),
+  _unique(true)
+{
+  _elements.reserve(path.size());
+  for(const auto &e: path)
+  {
+    _elements.push_back({e.first,e.second,
+                         !(e.first.empty() && e.second.empty())});
+    if(e.first.empty()) _unique = false;
+  }
+}
+
+//-------------------------------------------------------------------------
+bool PathMatcher::match_name(size_t index,
+                             const pni::core::string &name) const noexcept
+{
+  const Element &q = _elements[index];
+
+  if(!q.valid) return false;
+
+  //without a name the class decides
+  return q.name.empty() || q.name == name;
+}
+
+//-------------------------------------------------------------------------
+bool PathMatcher::match(size_t index,const Path::Element &e) const noexcept
+{
+  const Element &q = _elements[index];
+
+  if(!q.valid || (e.first.empty() && e.second.empty())) return false;
+
+  //if both have a name the names must be equal - the classes only if
+  //both are set
+  if(!q.name.empty() && !e.first.empty())
+  {
+    if(q.name != e.first) return false;
+
+    return q.type.empty() || e.second.empty() || q.type == e.second;
+  }
+
+  //otherwise both must have their class set
+  return !q.type.empty() && q.type == e.second;
+}
+
+//-------------------------------------------------------------------------
+bool PathMatcher::match(const Path &path) const noexcept
+{
+  if(path.size() != size()) return false;
+
+  size_t index = 0;
+  for(const auto &e: path)
+    if(!match(index++,e)) return false;
+
+  return path.attribute() == _attribute;
+}
+
+} // namespace nexus
+} // namespace io
+} // namespace pni
@@ -0,0 +1,164 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+#pragma once
+
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/nexus/path/path.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace nexus{
+
+//!
+//! @brief precompiled matcher for NeXus paths
+//!
+//! A PathMatcher is constructed once from a query path and can then be
+//! used to check many paths or, element by element, the objects visited
+//! during the traversal of a file. Unlike match() it does not require a
+//! full Path instance for every candidate. A traversal can thus reject a
+//! subtree as soon as a prefix of its path does not match.
+//!
+//! Elements are matched following the rules of match(). Elements without
+//! a name and a class never match.
+//!
+//! @code
+//! nexus::PathMatcher matcher(nexus::Path::from_string("/:NXentry/:NXdata"));
+//!
+//! if(matcher.match_name(1,link.path().name()))
+//! {
+//!   // ... read the class of the group and check it with match()
+//! }
+//! @endcode
+//!
+class PNIIO_EXPORT PathMatcher
+{
+  private:
+    //! compiled element of the query path
+    struct Element
+    {
+      pni::core::string name;  //!< name of the element (may be empty)
+      pni::core::string type;  //!< class of the element (may be empty)
+      bool valid;              //!< false if the element cannot match
+    };
+
+    std::vector<Element> _elements; //!< compiled elements
+    pni::core::string _attribute;    //!< attribute name
+    bool _absolute;                  //!< true for an absolute query path
+    bool _unique;                    //!< true if at most one path matches
+
+  public:
+    //!
+    //! @brief constructor
+    //!
+    //! @param path the query path
+    //!
+    explicit PathMatcher(const Path &path);
+
+    //!
+    //! @brief number of elements of the query path
+    //!
+    size_t size() const noexcept
+    {
+      return _elements.size();
+    }
+
+    //!
+    //! @brief true if the query path is absolute
+    //!
+    bool is_absolute() const noexcept
+    {
+      return _absolute;
+    }
+
+    //!
+    //! @brief true if the query can match only a single path
+    //!
+    //! This is the case if every element of the query path has a name.
+    //! A traversal can be stopped after the first match.
+    //!
+    bool is_unique() const noexcept
+    {
+      return _unique;
+    }
+
+    //!
+    //! @brief name of the element at position index
+    //!
+    //! @param index position of the element in the query path
+    //! @return name of the element, empty if the element has only a class
+    //!
+    const pni::core::string &name(size_t index) const noexcept
+    {
+      return _elements[index].name;
+    }
+
+    //!
+    //! @brief true if the element at position index requires a class
+    //!
+    //! If this is false match_name() alone decides whether an object
+    //! matches and its class does not have to be read from the file.
+    //!
+    //! @param index position of the element in the query path
+    //!
+    bool requires_class(size_t index) const noexcept
+    {
+      return !_elements[index].type.empty();
+    }
+
+    //!
+    //! @brief check the name of an object
+    //!
+    //! Returns false if an object with the given name cannot match the
+    //! element at position index regardless of its class.
+    //!
+    //! @param index position of the element in the query path
+    //! @param name the name of the object
+    //! @return true if the object can match, false otherwise
+    //!
+    bool match_name(size_t index,const pni::core::string &name) const noexcept;
+
+    //!
+    //! @brief check a single element
+    //!
+    //! @param index position of the element in the query path
+    //! @param element the element to check
+    //! @return true if the element matches, false otherwise
+    //!
+    bool match(size_t index,const Path::Element &element) const noexcept;
+
+    //!
+    //! @brief check a full path
+    //!
+    //! Equivalent to match(path,query) but does not throw for elements
+    //! without name and class.
+    //!
+    //! @param path the path to check
+    //! @return true if the path matches the query, false otherwise
+    //!
+    bool match(const Path &path) const noexcept;
+};
+
+} // namespace nexus
+} // namespace io
+} // namespace pni
@@ -60,17 +60,12 @@ void split_path(const Path &p,size_t s,Path &p1,Path &p2)
     ss<<p.size()<<"!";
     throw index_error(EXCEPTION_RECORD,ss.str());
   }
-  auto split_iter = p.begin();
-  std::advance(split_iter,s);
-
-  Path::ElementList gp1(s),gp2(p.size()-s);
-  std::copy(p.begin(),split_iter,gp1.begin());
-  std::copy(split_iter,p.end(),gp2.begin());
+  auto split_iter = p.begin()+s;
 
   //if the original path was absolute also the first part of the two
   //must be absolute
-  p1 = Path(p.filename(),gp1,"");
-  p2 = Path("",gp2,p.attribute());
+  p1 = Path(p.filename(),Path::ElementList(p.begin(),split_iter),"");
+  p2 = Path("",Path::ElementList(split_iter,p.end()),p.attribute());
 }
 
 //--------------------------------------------------------------------------
@@ -106,7 +101,7 @@ bool is_root_element(const Path::Element &e)
 //--------------------------------------------------------------------------
 bool is_absolute(const Path &p)
 {
-  return is_root_element(p.front());
+  return p.size() && is_root_element(p.front());
 }
 
 //--------------------------------------------------------------------------
@@ -161,11 +156,11 @@ Path join(const Path &a,const Path &b)
 
   //ok - here we are ready to do the join
   Path::ElementList elements;
+  elements.reserve(a.size()+b.size());
+  elements.insert(elements.end(),a.begin(),a.end());
+  elements.insert(elements.end(),b.begin(),b.end());
 
-  for(auto e: a) elements.push_back(e);
-  for(auto e: b) elements.push_back(e);
-
-  return Path(a.filename(),elements,b.attribute());
+  return Path(a.filename(),std::move(elements),b.attribute());
 }
 
 
@@ -181,6 +176,10 @@ std::istream &operator>>(std::istream &i,Path &p)
 //-------------------------------------------------------------------------
 bool match(const Path::Element &a,const Path::Element &b)
 {
+  //elements without name and class do not match anything
+  if((!has_name(a) && !has_class(a)) || (!has_name(b) && !has_class(b)))
+    return false;
+
   //if both elements are complete they must be equal
   if(is_complete(a) && is_complete(b))
     return a==b;
@@ -308,7 +307,7 @@ std::ostream &operator<<(std::ostream &stream,const Path &p)
 
   //write the object section
   size_t index = 0;
-  for(auto e: p)
+  for(const auto &e: p)
   {
     stream<<e;
     if((index++ < p.size()-1) && !is_root_element(e))
@@ -64,7 +64,8 @@ PNIIO_EXPORT bool match(const Path &a,const Path &b);
 //! @brief check if path elements match
 //!
 //! See the users guide for details about when paths elements are
-//! considered as matching.
+//! considered as matching. An element without name and class does not
+//! match any other element.
 //!
 //! @param a reference to first path element
 //! @param b reference to second path element
@@ -427,6 +428,11 @@ PNIIO_EXPORT Path get_path(const hdf5::node::Link &link);
 //! resolvable it will be converted into the appropriate node type. In the
 //! case of an unresolvable link the link itself will be stored.
 //!
+//! The query path is compiled into a PathMatcher once. Subtrees are only
+//! searched as long as their path matches the query, elements with a name
+//! are looked up directly and the search stops after the first match if
+//! every element of `path` has a name.
+//!
 //! @throws std::runtime_error in case of a failure
 //! @param base the base group from which to start the search
 //! @param path the path which to match
@@ -0,0 +1,127 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup general_io
+    //! \brief resolve the number of worker threads
+    //!
+    //! \param nthreads requested number of threads, 0 for one thread per
+    //! core
+    //! \return number of threads to use (at least 1)
+    //!
+    inline size_t worker_threads(size_t nthreads)
+    {
+        if(!nthreads) nthreads = std::thread::hardware_concurrency();
+        return std::max<size_t>(nthreads,1);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup general_io
+    //! \brief run jobs in parallel and pass the worker index
+    //!
+    //! Calls f(i,w) for every i in [0,n) using up to nthreads threads. w
+    //! is the index of the thread running the job, in [0,nthreads), and
+    //! can be used to access per thread resources like file streams
+    //! without locking. The calling thread takes part in the work as
+    //! worker 0. Jobs are handed out in ascending order. If a job throws,
+    //! no further jobs are started and the first exception is rethrown
+    //! once all threads have finished.
+    //!
+    //! \tparam FUNC callable with signature void(size_t,size_t)
+    //! \param n number of jobs
+    //! \param nthreads number of threads, 0 for one thread per core
+    //! \param f job function
+    //!
+    template<typename FUNC>
+    void parallel_for_worker(size_t n,size_t nthreads,FUNC &&f)
+    {
+        nthreads = std::min(worker_threads(nthreads),n);
+        if(nthreads<=1)
+        {
+            for(size_t i=0;i<n;++i) f(i,size_t(0));
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        auto worker = [&](size_t w)
+        {
+            for(size_t i=next++;i<n;i=next++)
+            {
+                try
+                {
+                    f(i,w);
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if(!error) error = std::current_exception();
+                    next = n;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for(size_t w=1;w<nthreads;++w) threads.emplace_back(worker,w);
+        worker(0);
+        for(auto &thread: threads) thread.join();
+
+        if(error) std::rethrow_exception(error);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup general_io
+    //! \brief run jobs in parallel
+    //!
+    //! Calls f(i) for every i in [0,n) using up to nthreads threads. See
+    //! parallel_for_worker() for details.
+    //!
+    //! \tparam FUNC callable with signature void(size_t)
+    //! \param n number of jobs
+    //! \param nthreads number of threads, 0 for one thread per core
+    //! \param f job function
+    //!
+    template<typename FUNC>
+    void parallel_for(size_t n,size_t nthreads,FUNC &&f)
+    {
+        parallel_for_worker(n,nthreads,[&f](size_t i,size_t) { f(i); });
+    }
+
+//end of namespace
+}
+}
@@ -33,3 +33,5 @@
 #include <pni/io/parsers/value_parser.hpp>
 #include <pni/io/parsers/slice_parser.hpp>
 #include <pni/io/parsers/bool_parser.hpp>
+#include <pni/io/parsers/from_chars.hpp>
+#include <pni/io/parsers/utils.hpp>
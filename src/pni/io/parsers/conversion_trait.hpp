@@ -24,6 +24,8 @@
 #pragma once
 
 #include <sstream>
+#include <limits>
+#include <system_error>
 
 #include <pni/core/types.hpp>
 
@@ -77,6 +79,20 @@ namespace io{
         {
             return v;
         }
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief non-throwing conversion function
+        //!
+        //! \param v value to convert
+        //! \param result reference to the result
+        //! \return error code - always success for the default trait
+        //!
+        static std::errc convert(const read_type &v,result_type &result) noexcept
+        {
+            result = v;
+            return std::errc();
+        }
     };
 
     //------------------------------------------------------------------------
@@ -130,6 +146,28 @@ namespace io{
         {
             return pni::core::convert<result_type>(v);
         }
+
+        //------------------------------------------------------------------
+        //!
+        //! \brief convert uint16 to uint8 without throwing
+        //!
+        //! Applies the same range check as the throwing version but
+        //! reports a violation by an error code.
+        //!
+        //! \param v lvalue reference to input
+        //! \param result reference to the result
+        //! \return std::errc::result_out_of_range if the input value exceeds
+        //!         the range of the output type
+        //!
+        static std::errc convert(const read_type &v,result_type &result) noexcept
+        {
+            if(v<std::numeric_limits<result_type>::min() ||
+               v>std::numeric_limits<result_type>::max())
+                return std::errc::result_out_of_range;
+
+            result = static_cast<result_type>(v);
+            return std::errc();
+        }
     };
 
     //------------------------------------------------------------------------
@@ -183,6 +221,28 @@ namespace io{
         {
             return pni::core::convert<result_type>(v);
         }
+
+        //------------------------------------------------------------------
+        //!
+        //! \brief convert int16 to int8 without throwing
+        //!
+        //! Applies the same range check as the throwing version but
+        //! reports a violation by an error code.
+        //!
+        //! \param v lvalue reference to input
+        //! \param result reference to the result
+        //! \return std::errc::result_out_of_range if the input value exceeds
+        //!         the range of the output type
+        //!
+        static std::errc convert(const read_type &v,result_type &result) noexcept
+        {
+            if(v<std::numeric_limits<result_type>::min() ||
+               v>std::numeric_limits<result_type>::max())
+                return std::errc::result_out_of_range;
+
+            result = static_cast<result_type>(v);
+            return std::errc();
+        }
     };
 
 //end of namespace
@@ -0,0 +1,353 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <pni/io/parsers/from_chars.hpp>
+
+using namespace pni::core;
+
+namespace pni{
+namespace io{
+
+    namespace {
+
+        //powers of ten which are exactly representable as double
+        const float64 float64_powers[] = {1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,
+                                          1e8,1e9,1e10,1e11,1e12,1e13,1e14,
+                                          1e15,1e16,1e17,1e18,1e19,1e20,
+                                          1e21,1e22};
+
+        //powers of ten which are exactly representable as float
+        const float32 float32_powers[] = {1e0f,1e1f,1e2f,1e3f,1e4f,1e5f,
+                                          1e6f,1e7f,1e8f,1e9f,1e10f};
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief decimal representation of a number
+        //!
+        //! The number is mantissa*10^exponent. At most 19 significant
+        //! digits are stored in the mantissa. If more digits are present
+        //! truncated is set.
+        //!
+        struct decimal_number
+        {
+            enum class kind_type {NUMBER,INF,NAN_VALUE};
+
+            uint64 mantissa;
+            int64 exponent;
+            bool negative;
+            bool truncated;
+            kind_type kind;
+        };
+
+        //---------------------------------------------------------------------
+        bool is_digit(char c) { return c>='0' && c<='9'; }
+
+        //---------------------------------------------------------------------
+        //case insensitive check if [first,last) starts with word
+        bool starts_with(const char *first,const char *last,const char *word)
+        {
+            for(;*word;++word,++first)
+            {
+                if(first == last) return false;
+                char c = *first;
+                if(c>='A' && c<='Z') c = c-'A'+'a';
+                if(c != *word) return false;
+            }
+            return true;
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief scan a floating point number
+        //!
+        //! \return pointer after the number or first if there is no number
+        //!
+        const char *scan_decimal(const char *first,const char *last,
+                                 decimal_number &d)
+        {
+            typedef decimal_number::kind_type kind_type;
+            d = decimal_number{0,0,false,false,kind_type::NUMBER};
+
+            const char *p = first;
+            if(p!=last && (*p=='+' || *p=='-'))
+            {
+                d.negative = *p=='-';
+                ++p;
+            }
+
+            if(starts_with(p,last,"infinity"))
+            {
+                d.kind = kind_type::INF;
+                return p+8;
+            }
+            if(starts_with(p,last,"inf"))
+            {
+                d.kind = kind_type::INF;
+                return p+3;
+            }
+            if(starts_with(p,last,"nan"))
+            {
+                d.kind = kind_type::NAN_VALUE;
+                return p+3;
+            }
+
+            //integer and fractional digits - leading zeros are not
+            //significant
+            size_t ndigits = 0;
+            bool has_digits = false;
+            auto add_digit = [&](unsigned digit,bool fraction)
+            {
+                has_digits = true;
+                if(ndigits<19)
+                {
+                    d.mantissa = 10*d.mantissa+digit;
+                    if(d.mantissa) ++ndigits;
+                    if(fraction) --d.exponent;
+                }
+                else
+                {
+                    if(digit) d.truncated = true;
+                    if(!fraction) ++d.exponent;
+                }
+            };
+
+            for(;p!=last && is_digit(*p);++p) add_digit(*p-'0',false);
+            if(p!=last && *p=='.')
+                for(++p;p!=last && is_digit(*p);++p) add_digit(*p-'0',true);
+
+            if(!has_digits) return first;
+
+            //the exponent is only consumed if it contains digits
+            if(p!=last && (*p=='e' || *p=='E'))
+            {
+                const char *q = p+1;
+                bool negative = false;
+                if(q!=last && (*q=='+' || *q=='-'))
+                {
+                    negative = *q=='-';
+                    ++q;
+                }
+
+                if(q!=last && is_digit(*q))
+                {
+                    int64 exponent = 0;
+                    for(;q!=last && is_digit(*q);++q)
+                        if(exponent<100000) exponent = 10*exponent+(*q-'0');
+
+                    d.exponent += negative ? -exponent : exponent;
+                    p = q;
+                }
+            }
+
+            return p;
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief convert a decimal number to double
+        //!
+        //! Numbers whose mantissa and power of ten are exactly
+        //! representable are converted with a single, correctly rounded,
+        //! floating point operation. All others are converted by the
+        //! standard library using the classic locale.
+        //!
+        //! \return false if the number is out of range
+        //!
+        bool to_float64(const decimal_number &d,const char *first,
+                        const char *last,float64 &value)
+        {
+            typedef decimal_number::kind_type kind_type;
+            float64 v;
+            if(d.kind == kind_type::INF)
+                v = std::numeric_limits<float64>::infinity();
+            else if(d.kind == kind_type::NAN_VALUE)
+                v = std::numeric_limits<float64>::quiet_NaN();
+            else if(!d.mantissa && !d.truncated)
+                v = 0.0;
+            else if(!d.truncated && d.mantissa<=(uint64(1)<<53) &&
+                    d.exponent>=-22 && d.exponent<=22)
+            {
+                v = float64(d.mantissa);
+                if(d.exponent<0) v /= float64_powers[-d.exponent];
+                else             v *= float64_powers[d.exponent];
+            }
+            else
+            {
+                std::istringstream stream(std::string(first,last));
+                stream.imbue(std::locale::classic());
+                stream>>v;
+                if(stream.fail()) return false;
+                value = v;
+                return true;
+            }
+
+            value = d.negative ? -v : v;
+            return true;
+        }
+
+    }
+
+    //-------------------------------------------------------------------------
+    from_chars_result from_chars(const char *first,const char *last,
+                                 float64 &value)
+    {
+        decimal_number d;
+        const char *end = scan_decimal(first,last,d);
+        if(end == first) return {first,std::errc::invalid_argument};
+
+        if(!to_float64(d,first,end,value))
+            return {end,std::errc::result_out_of_range};
+
+        return {end,std::errc()};
+    }
+
+    //-------------------------------------------------------------------------
+    from_chars_result from_chars(const char *first,const char *last,
+                                 float32 &value)
+    {
+        typedef decimal_number::kind_type kind_type;
+
+        decimal_number d;
+        const char *end = scan_decimal(first,last,d);
+        if(end == first) return {first,std::errc::invalid_argument};
+
+        float32 v;
+        if(d.kind == kind_type::INF)
+            v = std::numeric_limits<float32>::infinity();
+        else if(d.kind == kind_type::NAN_VALUE)
+            v = std::numeric_limits<float32>::quiet_NaN();
+        else if(!d.mantissa && !d.truncated)
+            v = 0.0f;
+        else if(!d.truncated && d.mantissa<=(uint64(1)<<24) &&
+                d.exponent>=-10 && d.exponent<=10)
+        {
+            v = float32(d.mantissa);
+            if(d.exponent<0) v /= float32_powers[-d.exponent];
+            else             v *= float32_powers[d.exponent];
+        }
+        else
+        {
+            //parse directly into float - going through double would round
+            //twice
+            std::istringstream stream(std::string(first,end));
+            stream.imbue(std::locale::classic());
+            stream>>v;
+            if(stream.fail()) return {end,std::errc::result_out_of_range};
+            value = v;
+            return {end,std::errc()};
+        }
+
+        value = d.negative ? -v : v;
+        return {end,std::errc()};
+    }
+
+    //-------------------------------------------------------------------------
+    from_chars_result from_chars(const char *first,const char *last,
+                                 float128 &value)
+    {
+        typedef decimal_number::kind_type kind_type;
+
+        decimal_number d;
+        const char *end = scan_decimal(first,last,d);
+        if(end == first) return {first,std::errc::invalid_argument};
+
+        float128 v;
+        if(d.kind == kind_type::INF)
+            v = std::numeric_limits<float128>::infinity();
+        else if(d.kind == kind_type::NAN_VALUE)
+            v = std::numeric_limits<float128>::quiet_NaN();
+        else if(!d.mantissa && !d.truncated)
+            v = 0.0;
+        else if(!d.truncated && d.mantissa<=(uint64(1)<<53) &&
+                d.exponent>=-22 && d.exponent<=22)
+        {
+            //operands are exact in double and thus in extended precision
+            v = float128(d.mantissa);
+            if(d.exponent<0) v /= float128(float64_powers[-d.exponent]);
+            else             v *= float128(float64_powers[d.exponent]);
+        }
+        else
+        {
+            std::istringstream stream(std::string(first,end));
+            stream.imbue(std::locale::classic());
+            stream>>v;
+            if(stream.fail()) return {end,std::errc::result_out_of_range};
+            value = v;
+            return {end,std::errc()};
+        }
+
+        value = d.negative ? -v : v;
+        return {end,std::errc()};
+    }
+
+    //-------------------------------------------------------------------------
+    from_chars_result from_chars(const char *first,const char *last,
+                                 uint64 &value)
+    {
+        const char *p = first;
+        if(p!=last && *p=='+') ++p;
+        if(p==last || !is_digit(*p)) return {first,std::errc::invalid_argument};
+
+        uint64 v = 0;
+        bool overflow = false;
+        for(;p!=last && is_digit(*p);++p)
+        {
+            uint64 digit = *p-'0';
+            if(v>(std::numeric_limits<uint64>::max()-digit)/10) overflow = true;
+            v = 10*v+digit;
+        }
+
+        if(overflow) return {p,std::errc::result_out_of_range};
+
+        value = v;
+        return {p,std::errc()};
+    }
+
+    //-------------------------------------------------------------------------
+    from_chars_result from_chars(const char *first,const char *last,
+                                 int64 &value)
+    {
+        bool negative = first!=last && *first=='-';
+        if(negative && first+1!=last && first[1]=='+')
+            return {first,std::errc::invalid_argument};
+
+        uint64 v = 0;
+        from_chars_result result = from_chars(first+(negative ? 1 : 0),last,v);
+        if(result.ec == std::errc::invalid_argument)
+            return {first,std::errc::invalid_argument};
+        if(result.ec != std::errc()) return result;
+
+        uint64 limit = uint64(std::numeric_limits<int64>::max())+(negative ? 1 : 0);
+        if(v>limit) return {result.ptr,std::errc::result_out_of_range};
+
+        value = negative ? int64(0-v) : int64(v);
+        return result;
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,136 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <system_error>
+#include <pni/core/types.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup parser_classes
+    //! \brief result of from_chars
+    //!
+    //! ptr points to the first character not belonging to the number. If
+    //! no number was found ptr is equal to the first character of the
+    //! input and ec is std::errc::invalid_argument. If the number does not
+    //! fit into the result type ec is std::errc::result_out_of_range and
+    //! the value is not modified.
+    //!
+    struct from_chars_result
+    {
+        const char *ptr; //!< first character after the number
+        std::errc ec;    //!< error code - a value initialized errc on success
+    };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup parser_classes
+    //! \brief parse a floating point number
+    //!
+    //! Parses a number of the form [+-]digits[.digits][(e|E)[+-]digits],
+    //! as well as inf, infinity and nan, from the beginning of [first,last)
+    //! without skipping whitespace. Unlike strtod the function neither
+    //! depends on the locale nor requires a terminated string. Numbers
+    //! with at most 15 significant digits and a moderate exponent, which
+    //! is the usual case for data files, are converted without calling
+    //! into the C library and are correctly rounded.
+    //!
+    //! \param first pointer to the first character
+    //! \param last pointer after the last character
+    //! \param value where to store the number
+    //! \return pointer after the number and error code
+    //!
+    PNIIO_EXPORT from_chars_result from_chars(const char *first,
+                                              const char *last,
+                                              pni::core::float64 &value);
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup parser_classes
+    //! \brief parse a single precision floating point number
+    //!
+    //! \param first pointer to the first character
+    //! \param last pointer after the last character
+    //! \param value where to store the number
+    //! \return pointer after the number and error code
+    //!
+    PNIIO_EXPORT from_chars_result from_chars(const char *first,
+                                              const char *last,
+                                              pni::core::float32 &value);
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup parser_classes
+    //! \brief parse an extended precision floating point number
+    //!
+    //! Accepts the same syntax as the float64 version. Numbers which
+    //! cannot be converted exactly with a single floating point operation
+    //! are converted by the standard library using the classic locale.
+    //!
+    //! \param first pointer to the first character
+    //! \param last pointer after the last character
+    //! \param value where to store the number
+    //! \return pointer after the number and error code
+    //!
+    PNIIO_EXPORT from_chars_result from_chars(const char *first,
+                                              const char *last,
+                                              pni::core::float128 &value);
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup parser_classes
+    //! \brief parse a signed integer
+    //!
+    //! Parses a number of the form [+-]digits.
+    //!
+    //! \param first pointer to the first character
+    //! \param last pointer after the last character
+    //! \param value where to store the number
+    //! \return pointer after the number and error code
+    //!
+    PNIIO_EXPORT from_chars_result from_chars(const char *first,
+                                              const char *last,
+                                              pni::core::int64 &value);
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup parser_classes
+    //! \brief parse an unsigned integer
+    //!
+    //! Parses a number of the form [+]digits.
+    //!
+    //! \param first pointer to the first character
+    //! \param last pointer after the last character
+    //! \param value where to store the number
+    //! \return pointer after the number and error code
+    //!
+    PNIIO_EXPORT from_chars_result from_chars(const char *first,
+                                              const char *last,
+                                              pni::core::uint64 &value);
+
+//end of namespace
+}
+}
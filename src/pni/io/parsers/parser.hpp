@@ -24,14 +24,18 @@
 
 #pragma once
 
+#include <limits>
+#include <sstream>
+#include <system_error>
+#include <type_traits>
 #include <pni/core/types.hpp>
 #include <pni/core/type_erasures/value.hpp>
 #include <pni/core/arrays/slice.hpp>
 
 #include <pni/io/exceptions.hpp>
 #include <pni/io/parsers/conversion_trait.hpp>
+#include <pni/io/parsers/from_chars.hpp>
 #include <pni/io/container_io_config.hpp>
-#include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
 #include <pni/io/windows.hpp>
@@ -44,23 +48,59 @@ namespace io{
     static const boost::regex default_complex_regexp("^(?<REALPART>[+-]?\\d+\\.(\\d+)?([Ee][+-]?\\d+)?)?((?<IMAGSIGN>[+-]?[ijI])(?<IMAGPART>[+-]?\\d+\\.(\\d+)?([Ee][+-]?\\d+)?)?)?$");
 
 
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup parser_internal_classes
+    //! \brief type used to scan a primitive type
+    //!
+    //! Integers are scanned with the 64-bit integer type of the same
+    //! signedness and floating point numbers with their own type. The
+    //! scanned value must then fit into the read_type of the
+    //! conversion_trait.
+    //!
+    //! \tparam T primitive type
+    //!
+    template<typename T,bool IS_INTEGER = std::numeric_limits<T>::is_integer,
+                        bool IS_SIGNED = std::numeric_limits<T>::is_signed>
+    struct scan_type_trait
+    {
+        //! the type passed to from_chars
+        typedef T type;
+    };
+
+    //! \cond internal
+    template<typename T>
+    struct scan_type_trait<T,true,true>
+    {
+        typedef pni::core::int64 type;
+    };
+
+    template<typename T>
+    struct scan_type_trait<T,true,false>
+    {
+        typedef pni::core::uint64 type;
+    };
+    //! \endcond
+
     //------------------------------------------------------------------------
     //!
     //! \ingroup parser_classes
     //! \brief parser for primitive types
     //!
     //! This version of the parser structure provides a default parsing
-    //! implementation for primitive types. The aim of this class is
-    //! to hide all the complexity of the boost::spirit::qi parsers.
-    //! In addition it catches all spirit exceptions and wraps them
-    //! into a parser_error exception.
+    //! implementation for primitive types. Numbers are scanned with
+    //! from_chars which neither allocates memory nor depends on the
+    //! locale. Range checks are done by the conversion_trait of the type.
     //!
     //! Use this parser to parse a single primitive value from a string.
     //! The input data must be trimmed - so no leading or trailing
     //! blanks are allowed. The string is supposed to end with the last
     //! character assembling the value to parse.
     //!
-    //! By default the output iterator is a const string iterator.
+    //! Two interfaces are provided: operator() throws parser_error in case
+    //! of errors while parse() reports errors by an error code. The
+    //! latter should be used where failures are expected, for instance
+    //! when trying several types for an input.
     //!
     //! \tparam T     primitive data type
     //!
@@ -72,61 +112,126 @@ namespace io{
     private:
         using conversion_t = conversion_trait<T>;
         using read_type = typename conversion_t::read_type;
+        using scan_type = typename scan_type_trait<read_type>::type;
         using type_info_t = pni::core::type_info<T>;
-    public:
-        using result_type = T;
+
+        //--------------------------------------------------------------------
         //!
-        //! \brief parser primitive type
+        //! \brief check if a scanned value fits into the read type
         //!
-        //! Parses the input string and returns an instance of a primitive type.
-        //! In case of errors parser_error is thrown.
+        //! \param v the scanned value
+        //! \return true if v can be stored in read_type
         //!
-        //! \throws parser_error in case of any problems
-        //! \param data the string with input data
-        //! \return instance of the primitive type
+        template<typename ST>
+        static bool _fits(ST v,std::true_type) noexcept
+        {
+            return v>=ST(std::numeric_limits<read_type>::min()) &&
+                   v<=ST(std::numeric_limits<read_type>::max());
+        }
+
+        template<typename ST>
+        static bool _fits(ST,std::false_type) noexcept
+        {
+            return true;
+        }
+
+        //--------------------------------------------------------------------
         //!
-        result_type operator()(const pni::core::string &data) const
+        //! \brief throw parser_error for an error code
+        //!
+        //! \throws parser_error always
+        //! \param data the input string
+        //! \param ec the error code reported by parse()
+        //!
+        static void _throw_error(const pni::core::string &data,std::errc ec)
         {
             using namespace pni::core;
 
-            result_type value;
-
-            if((!type_info_t::is_signed) && (data[0] == '-'))
+            std::stringstream ss;
+            if((!type_info_t::is_signed) && !data.empty() && (data[0] == '-'))
             {
-                std::stringstream ss;
                 ss<<"Cannot store a signed value ["<<data<<"] an instance of "
-                  <<type_id(value);
-                throw parser_error(EXCEPTION_RECORD,ss.str());
-            }
-
-            try
-            {
-                value = conversion_t::convert(
-                        boost::lexical_cast<read_type>(data));
-
+                  <<type_id(result_type());
             }
-            catch(const boost::bad_lexical_cast &)
+            else if(ec == std::errc::result_out_of_range)
             {
-                std::stringstream ss;
-                ss<<"Could not convert ["<<data<<"] to a value of type ";
-                ss<<type_id(value);
-                throw parser_error(EXCEPTION_RECORD,ss.str());
-            }
-            catch(const pni::core::range_error &error)
-            {
-                std::stringstream ss;
-                ss<<"A range error occured with: "<<error.description()<<std::endl;
+                ss<<"A range error occured with: the value exceeds the "
+                  <<"range of the type"<<std::endl;
                 ss<<"Could not convert input ["<<data<<"] to a value fo type ";
                 ss<<type_id(result_type());
-                throw parser_error(EXCEPTION_RECORD,ss.str());
             }
-            catch(...)
+            else
             {
-                std::stringstream ss;
-                ss<<"Unknown error when trying to convert ["<<data<<"] to ";
+                ss<<"Could not convert ["<<data<<"] to a value of type ";
                 ss<<type_id(result_type());
-                throw parser_error(EXCEPTION_RECORD,ss.str());
             }
+            throw parser_error(EXCEPTION_RECORD,ss.str());
+        }
+    public:
+        using result_type = T;
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief parse primitive type without throwing
+        //!
+        //! The entire range [first,last) must form the value. On failure
+        //! value is not modified.
+        //!
+        //! \param first pointer to the first character
+        //! \param last pointer after the last character
+        //! \param value reference to the result
+        //! \return std::errc::invalid_argument if the input is not a
+        //!         number of the requested type,
+        //!         std::errc::result_out_of_range if the number exceeds the
+        //!         range of the type and a value initialized std::errc on
+        //!         success
+        //!
+        std::errc parse(const char *first,const char *last,
+                        result_type &value) const noexcept
+        {
+            scan_type v;
+            from_chars_result result = from_chars(first,last,v);
+            if(result.ec != std::errc()) return result.ec;
+            if(result.ptr != last) return std::errc::invalid_argument;
+
+            typedef std::integral_constant<bool,
+                    std::numeric_limits<read_type>::is_integer> is_integer;
+            if(!_fits(v,is_integer())) return std::errc::result_out_of_range;
+
+            return conversion_t::convert(static_cast<read_type>(v),value);
+        }
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief parse primitive type without throwing
+        //!
+        //! \param data the string with input data
+        //! \param value reference to the result
+        //! \return error code - see above
+        //!
+        std::errc parse(const pni::core::string &data,
+                        result_type &value) const noexcept
+        {
+            return parse(data.data(),data.data()+data.size(),value);
+        }
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief parser primitive type
+        //!
+        //! Parses the input string and returns an instance of a primitive type.
+        //! In case of errors parser_error is thrown.
+        //!
+        //! \throws parser_error in case of any problems
+        //! \param data the string with input data
+        //! \return instance of the primitive type
+        //!
+        result_type operator()(const pni::core::string &data) const
+        {
+            result_type value = result_type();
+
+            std::errc ec = parse(data,value);
+            if(ec != std::errc()) _throw_error(data,ec);
 
             return value;
         }
@@ -21,6 +21,7 @@
 //     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
 //
 //
+#include <boost/lexical_cast.hpp>
 #include <pni/io/parsers/slice_parser.hpp>
 
 namespace pni {
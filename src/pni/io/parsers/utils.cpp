@@ -22,48 +22,222 @@
 //
 //
 
+#include <algorithm>
+#include <cstring>
 #include <pni/io/parsers/utils.hpp>
-#include <pni/io/parsers/parser.hpp>
-#include <boost/regex.hpp>
 
 namespace pni{
 namespace io {
 
-    bool is_integer(const pni::core::string &input)
+    namespace {
+
+        bool is_digit(char c) { return c>='0' && c<='9'; }
+
+        //---------------------------------------------------------------------
+        const char *skip_digits(const char *p,const char *last)
+        {
+            while(p!=last && is_digit(*p)) ++p;
+            return p;
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief result of scan_number
+        //!
+        struct number_scan
+        {
+            const char *last; //!< end of the number
+            bool digits;      //!< true if there are integer digits
+            bool point;       //!< true if there is a decimal point
+            bool exponent;    //!< true if there is an exponent
+        };
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief scan [+-]?\d+(\.\d*)?([Ee][+-]?\d+)?
+        //!
+        //! An exponent is only consumed if it has digits. Without integer
+        //! digits nothing is consumed.
+        //!
+        number_scan scan_number(const char *first,const char *last)
+        {
+            number_scan s{first,false,false,false};
+
+            const char *p = first;
+            if(p!=last && (*p=='+' || *p=='-')) ++p;
+
+            const char *digits = p;
+            p = skip_digits(p,last);
+            if(p==digits) return s;
+            s.digits = true;
+
+            if(p!=last && *p=='.')
+            {
+                s.point = true;
+                p = skip_digits(p+1,last);
+            }
+
+            if(p!=last && (*p=='e' || *p=='E'))
+            {
+                const char *q = p+1;
+                if(q!=last && (*q=='+' || *q=='-')) ++q;
+                if(q!=last && is_digit(*q))
+                {
+                    s.exponent = true;
+                    p = skip_digits(q,last);
+                }
+            }
+
+            s.last = p;
+            return s;
+        }
+
+        //---------------------------------------------------------------------
+        //! true if [first,last) is a float in the sense of
+        //! default_float_regexp
+        bool is_float_number(const number_scan &s,const char *last)
+        {
+            return s.digits && s.point && s.last==last;
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief check for a complex number
+        //!
+        //! Grammar: (float)?([+-]?[ijI](float)?)? where float requires a
+        //! decimal point. The number at the beginning has already been
+        //! scanned.
+        //!
+        bool scan_complex(const char *first,const char *last,
+                          const number_scan &number,lexical_info &info)
+        {
+            const char *p = first;
+            if(number.digits)
+            {
+                //a number without point is no real part and cannot be the
+                //start of the imaginary part
+                if(!number.point) return false;
+                info.real_first = first;
+                info.real_last  = number.last;
+                p = number.last;
+            }
+
+            if(p==last) return true;
+
+            if(*p=='+' || *p=='-')
+            {
+                info.imag_negative = *p=='-';
+                ++p;
+            }
+
+            if(p==last || (*p!='i' && *p!='j' && *p!='I')) return false;
+            ++p;
+
+            if(p==last) return true;
+
+            if(!is_float_number(scan_number(p,last),last)) return false;
+            info.imag_first = p;
+            info.imag_last  = last;
+            return true;
+        }
+
+        //---------------------------------------------------------------------
+        bool is_boolean_word(const char *first,const char *last)
+        {
+            static const char *words[] = {"true","True","TRUE","1",
+                                          "false","False","FALSE","0"};
+
+            size_t size = last-first;
+            for(auto word: words)
+                if(std::strlen(word)==size && std::equal(first,last,word))
+                    return true;
+
+            return false;
+        }
+
+        //---------------------------------------------------------------------
+        //! check for \d+:(\d*(:\d+)?)?
+        bool is_slice_range(const char *first,const char *last)
+        {
+            const char *p = skip_digits(first,last);
+            if(p==first || p==last || *p!=':') return false;
+
+            p = skip_digits(p+1,last);
+            if(p==last) return true;
+            if(*p!=':') return false;
+
+            const char *stride = p+1;
+            p = skip_digits(stride,last);
+            return p!=stride && p==last;
+        }
+
+    }
+
+    //=========================================================================
+    lexical_info classify(const char *first,const char *last) noexcept
     {
-        //boost::regex expr(default_int_regexp);
+        lexical_info info{0,first,first,first,first,false};
+
+        number_scan number = scan_number(first,last);
+        if(number.digits && number.last==last)
+        {
+            if(!number.point && !number.exponent)
+                info.classes |= unsigned(lexical_class::INTEGER);
+            if(number.point)
+                info.classes |= unsigned(lexical_class::FLOAT);
+        }
+
+        if(scan_complex(first,last,number,info))
+            info.classes |= unsigned(lexical_class::COMPLEX);
+        else
+        {
+            info.real_first = info.real_last = first;
+            info.imag_first = info.imag_last = first;
+            info.imag_negative = false;
+        }
+
+        if(is_boolean_word(first,last))
+            info.classes |= unsigned(lexical_class::BOOLEAN);
 
-        return boost::regex_match(input,default_int_regexp);
+        if(is_slice_range(first,last))
+            info.classes |= unsigned(lexical_class::SLICE);
+
+        return info;
     }
 
     //=========================================================================
-    bool is_float(const pni::core::string &input)
+    bool is_integer(const pni::core::string &input)
     {
-        //boost::regex expr(default_float_regexp);
+        const char *first = input.data();
+        return classify(first,first+input.size()).is(lexical_class::INTEGER);
+    }
 
-        return boost::regex_match(input,default_float_regexp);
+    //=========================================================================
+    bool is_float(const pni::core::string &input)
+    {
+        const char *first = input.data();
+        return classify(first,first+input.size()).is(lexical_class::FLOAT);
     }
 
     //=========================================================================
     bool is_boolean(const pni::core::string &input)
     {
-        boost::regex expr("^T(rue|RUE)|true|1|F(alse|ALSE)|false|0$");
-
-        return boost::regex_match(input,expr);
+        const char *first = input.data();
+        return classify(first,first+input.size()).is(lexical_class::BOOLEAN);
     }
 
     //=========================================================================
-    bool is_complex(const pni::core::string &)
+    bool is_complex(const pni::core::string &input)
     {
-        return false;
+        const char *first = input.data();
+        return classify(first,first+input.size()).is(lexical_class::COMPLEX);
     }
 
     //=========================================================================
     bool is_slice(const pni::core::string &input)
     {
-        boost::regex expr("^\\d+:(\\d*(:\\d+)?)?$");
-
-        return boost::regex_match(input,expr);
+        const char *first = input.data();
+        return classify(first,first+input.size()).is(lexical_class::SLICE);
     }
 
 }
@@ -24,10 +24,70 @@
 #pragma once
 
 #include <pni/core/types.hpp>
+#include <pni/io/windows.hpp>
 
 namespace pni {
 namespace io {
 
+    //!
+    //! \ingroup parser_classes
+    //! \brief lexical classes of an input string
+    //!
+    //! The classes follow the default regular expressions of the parsers.
+    //! As an input can belong to several classes (1 is an integer as well
+    //! as a boolean value) the values can be combined bitwise.
+    //!
+    enum class lexical_class : unsigned
+    {
+        NONE    = 0,  //!< input belongs to no class
+        INTEGER = 1,  //!< matches default_int_regexp
+        FLOAT   = 2,  //!< matches default_float_regexp
+        COMPLEX = 4,  //!< matches default_complex_regexp
+        BOOLEAN = 8,  //!< true, false, 1, 0 and their capitalized forms
+        SLICE   = 16  //!< start:[stop[:stride]]
+    };
+
+    //!
+    //! \ingroup parser_classes
+    //! \brief result of the lexical classification
+    //!
+    //! For complex numbers the parts of the input holding the real and
+    //! the imaginary part are stored. A part which is not present is
+    //! an empty range.
+    //!
+    struct lexical_info
+    {
+        unsigned classes;        //!< bitwise or of lexical_class values
+        const char *real_first;  //!< first character of the real part
+        const char *real_last;   //!< end of the real part
+        const char *imag_first;  //!< first character of the imaginary part
+        const char *imag_last;   //!< end of the imaginary part
+        bool imag_negative;      //!< true if the imaginary unit is negated
+
+        //! true if the input belongs to class c
+        bool is(lexical_class c) const noexcept
+        {
+            return classes & static_cast<unsigned>(c);
+        }
+    };
+
+    //!
+    //! \ingroup parser_classes
+    //! \brief classify an input string
+    //!
+    //! Determines all lexical classes the input belongs to in a single
+    //! pass over the characters. The result is the same as matching the
+    //! input against the default regular expressions of the parsers but
+    //! neither a regular expression nor memory is required. Like for the
+    //! is_ functions below the input is assumed to be trimmed.
+    //!
+    //! \param first pointer to the first character
+    //! \param last pointer after the last character
+    //! \return classes and the parts of a complex number
+    //!
+    PNIIO_EXPORT lexical_info classify(const char *first,
+                                       const char *last) noexcept;
+
     //!
     //! \ingroup parser_classes
     //! \brief check if input is an integer
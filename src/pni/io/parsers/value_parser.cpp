@@ -23,21 +23,50 @@
 //
 
 #include <pni/io/parsers/value_parser.hpp>
+#include <pni/io/parsers/utils.hpp>
 
 namespace pni{
 namespace io{
 
+    namespace {
+
+        //convert a part of the input with a primitive parser
+        template<typename T>
+        T parse_part(const parser<T> &p,const char *first,const char *last)
+        {
+            T value = T();
+            if(p.parse(first,last,value)!=std::errc())
+                return p(pni::core::string(first,last)); //throws parser_error
+
+            return value;
+        }
+
+    }
+
+    //-------------------------------------------------------------------------
     parser<pni::core::value>::result_type
     parser<pni::core::value>::operator()(const pni::core::string &input) const
     {
         using namespace pni::core;
 
-        if(boost::regex_match(input,default_int_regexp))
-            return result_type(_int_parser(input));
-        else if(boost::regex_match(input,default_float_regexp))
-            return result_type(_float_parser(input));
-        else if(boost::regex_match(input,default_complex_regexp))
-            return result_type(_complex_parser(input));
+        const char *first = input.data();
+        const char *last  = first+input.size();
+        lexical_info info = classify(first,last);
+
+        if(info.is(lexical_class::INTEGER))
+            return result_type(parse_part(_int_parser,first,last));
+        else if(info.is(lexical_class::FLOAT))
+            return result_type(parse_part(_float_parser,first,last));
+        else if(info.is(lexical_class::COMPLEX))
+        {
+            float64 real = 0.0, imag = 0.0;
+            if(info.real_first!=info.real_last)
+                real = parse_part(_float_parser,info.real_first,info.real_last);
+            if(info.imag_first!=info.imag_last)
+                imag = parse_part(_float_parser,info.imag_first,info.imag_last);
+
+            return result_type(complex64(real,info.imag_negative ? -imag : imag));
+        }
         else
         {
             std::stringstream ss;
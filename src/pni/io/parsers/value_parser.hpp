@@ -43,6 +43,10 @@ namespace io{
     //! * 64Bit complex floats
     //! * and strings
     //!
+    //! The type is determined by classify() in a single pass over the
+    //! input. The parts of the input are then converted without creating
+    //! temporary strings.
+    //!
     template<>
     class PNIIO_EXPORT parser<pni::core::value>
     {
@@ -56,11 +60,6 @@ namespace io{
         //! parser for float values (doubles)
         //!
         parser<pni::core::float64>   _float_parser;
-
-        //!
-        //! parser for complex values
-        //!
-        parser<pni::core::complex64> _complex_parser;
     public:
         using result_type = pni::core::value;
 
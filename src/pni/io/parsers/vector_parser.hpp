@@ -28,16 +28,18 @@
 #include <pni/core/types.hpp>
 #include <pni/core/error.hpp>
 #include <vector>
-#include <boost/algorithm/string/split.hpp>
-#include <boost/algorithm/string/trim.hpp>
+#include <boost/utility/string_view.hpp>
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 #include <pni/io/exceptions.hpp>
 #include <pni/io/parsers/slice_parser.hpp>
 #include <pni/io/parsers/bool_parser.hpp>
 #include <pni/io/parsers/value_parser.hpp>
 #include <pni/io/parsers/complex_parser.hpp>
+#include <pni/io/parsers/string_parser.hpp>
 #include <pni/io/parsers/parser.hpp>
 #include <pni/io/container_io_config.hpp>
 
@@ -45,6 +47,33 @@
 namespace pni{
 namespace io{
 
+//------------------------------------------------------------------------
+//!
+//! @ingroup parser_internal_classes
+//! @brief check if the parser for T can parse a range of characters
+//!
+//! true if parser<T> provides a non-throwing member function
+//! parse(const char *first,const char *last,T &value).
+//!
+//! @tparam T element type
+//!
+template<typename T>
+class has_range_parse
+{
+  private:
+    template<typename P>
+    static auto test(int) -> decltype(
+        std::declval<const P&>().parse(static_cast<const char*>(nullptr),
+                                       static_cast<const char*>(nullptr),
+                                       std::declval<T&>()),
+        std::true_type());
+
+    template<typename P>
+    static std::false_type test(...);
+  public:
+    static const bool value = decltype(test<parser<T>>(0))::value;
+};
+
 //------------------------------------------------------------------------
 //!
 //! @brief std::vector parser
@@ -58,7 +87,10 @@ namespace io{
 //! between a start and a stop token. The elements are assumed to be
 //! separated by a delimiter token.
 //!
-//! The container can be any STL compliant container type.
+//! The input is tokenized in place. Besides operator(), which returns a
+//! new vector, the parser can append the elements to an existing
+//! container or write them to a preallocated buffer. For numeric element
+//! types no memory is allocated apart from the output.
 //!
 //! @tparam T the value type of the vector
 //!
@@ -71,26 +103,66 @@ class parser<std::vector<T>>
     parser<value_type>  _value_parser;
     container_io_config _config;
 
-  public:
-    using result_type = std::vector<value_type>;
+    //--------------------------------------------------------------------
+    //! true if c is removed from the beginning and end of an element
+    static bool _is_space(char c)
+    {
+      return c==' ' || c=='\t' || c=='\n' || c=='\v' || c=='\f' || c=='\r';
+    }
 
+    //--------------------------------------------------------------------
     //!
-    //! @brief constructor
+    //! @brief convert a single element
     //!
-    //! With this constructor a container IO configuration can be
-    //! passed which determines the value seperator, start and stop symbols.
+    //! Version for element parsers which can parse a range of characters.
     //!
-    //! @param config reference to the IO configuration
+    //! @throws parser_error if the element cannot be converted
     //!
-    parser(const container_io_config &config=container_io_config()):
-      _config(config)
-    {}
+    value_type _convert(const char *first,const char *last,
+                        pni::core::string &,std::true_type) const
+    {
+      value_type value = value_type();
+      if(_value_parser.parse(first,last,value)!=std::errc())
+        return _value_parser(pni::core::string(first,last)); //throws
 
-    result_type operator()(const pni::core::string &input) const
+      return value;
+    }
+
+    //--------------------------------------------------------------------
+    //!
+    //! @brief convert a single element
+    //!
+    //! Version for element parsers which require a string. The buffer is
+    //! reused for all elements.
+    //!
+    //! @throws parser_error if the element cannot be converted
+    //!
+    value_type _convert(const char *first,const char *last,
+                        pni::core::string &buffer,std::false_type) const
+    {
+      buffer.assign(first,last);
+      return _value_parser(buffer);
+    }
+
+    //--------------------------------------------------------------------
+    //!
+    //! @brief call a function for every element
+    //!
+    //! Determines the range between the start and stop symbol and splits
+    //! it at the separator. Whitespace is removed from both ends of the
+    //! elements and empty elements are skipped.
+    //!
+    //! @throws parser_error if a start or stop symbol is missing
+    //! @param input the input string
+    //! @param f function called with the converted elements
+    //! @return number of elements
+    //!
+    template<typename FUNC>
+    size_t _for_each(boost::string_view input,FUNC &&f) const
     {
       using namespace pni::core;
-      auto first = input.begin();
-      auto last  = input.end();
+      const char *first = input.data();
+      const char *last  = input.data()+input.size();
       //need to find the start and stop
       if(_config.start_symbol())
       {
@@ -107,7 +179,7 @@ class parser<std::vector<T>>
       if(_config.stop_symbol())
       {
         last = std::find(first,last,_config.stop_symbol());
-        if(last==input.end())
+        if(last==input.data()+input.size())
         {
           std::stringstream ss;
           ss<<"Input: "<<input<<" - has no stop symbol!";
@@ -115,23 +187,114 @@ class parser<std::vector<T>>
         }
       }
 
-      string buffer(first,last);
-      std::vector<string> elements;
-      string sep(1,_config.separator());
-      boost::split(elements,buffer, boost::is_any_of(sep),
-                   boost::token_compress_on);
-      std::transform(elements.begin(),elements.end(),elements.begin(),
-                     [](string &value) { boost::trim(value); return value; });
-      auto new_end = std::remove_if(elements.begin(),elements.end(),
-                                    [](const string &value) { return value.empty(); });
+      std::integral_constant<bool,has_range_parse<value_type>::value> tag;
+      string buffer;
+      size_t n = 0;
+      while(first!=last)
+      {
+        const char *end = std::find(first,last,_config.separator());
+        const char *next = end==last ? last : end+1;
 
-      result_type result;
-      std::transform(elements.begin(),new_end,
-                     std::back_inserter(result),
-                     _value_parser);
+        while(first!=end && _is_space(*first)) ++first;
+        while(end!=first && _is_space(*(end-1))) --end;
+
+        if(first!=end)
+        {
+          f(_convert(first,end,buffer,tag));
+          ++n;
+        }
+        first = next;
+      }
 
+      return n;
+    }
+
+  public:
+    using result_type = std::vector<value_type>;
+
+    //!
+    //! @brief constructor
+    //!
+    //! With this constructor a container IO configuration can be
+    //! passed which determines the value seperator, start and stop symbols.
+    //!
+    //! @param config reference to the IO configuration
+    //!
+    parser(const container_io_config &config=container_io_config()):
+      _config(config)
+    {}
+
+    //--------------------------------------------------------------------
+    //!
+    //! @brief parse a vector
+    //!
+    //! @throws parser_error in case of any problems
+    //! @param input the input string
+    //! @return vector with the elements
+    //!
+    result_type operator()(const pni::core::string &input) const
+    {
+      result_type result;
+      append(input,result);
       return result;
     }
+
+    //--------------------------------------------------------------------
+    //!
+    //! @brief append the elements to a container
+    //!
+    //! The elements are converted while the input is tokenized and
+    //! appended to the container with push_back. In case of an error
+    //! the container is restored to its original size.
+    //!
+    //! @throws parser_error in case of any problems
+    //! @tparam CTYPE container type
+    //! @param input the input string
+    //! @param container the container to append the elements to
+    //! @return number of appended elements
+    //!
+    template<typename CTYPE>
+    size_t append(boost::string_view input,CTYPE &container) const
+    {
+      size_t size = container.size();
+      try
+      {
+        return _for_each(input,[&container](value_type &&value)
+                         { container.push_back(std::move(value)); });
+      }
+      catch(...)
+      {
+        container.resize(size);
+        throw;
+      }
+    }
+
+    //--------------------------------------------------------------------
+    //!
+    //! @brief write the elements to a buffer
+    //!
+    //! @throws parser_error in case of any problems
+    //! @throws size_mismatch_error if the input contains more than size
+    //!         elements
+    //! @param input the input string
+    //! @param buffer pointer to the first element of the buffer
+    //! @param size number of elements the buffer can hold
+    //! @return number of elements written
+    //!
+    size_t parse(boost::string_view input,value_type *buffer,size_t size) const
+    {
+      using namespace pni::core;
+
+      size_t n = 0;
+      return _for_each(input,[&](value_type &&value)
+      {
+        if(n==size)
+          throw size_mismatch_error(EXCEPTION_RECORD,
+                  "Input contains more than "+std::to_string(size)+
+                  " elements!");
+        buffer[n++] = std::move(value);
+      });
+    }
 };
 
 //end of namespace
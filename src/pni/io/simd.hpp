@@ -0,0 +1,206 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+//
+// Internal header shared by the SIMD kernels of the library - it is not
+// installed.
+//
+// SIMD kernels are only available on x86 with GCC, Clang or MSVC. The
+// kernels are compiled with function level target attributes so that the
+// library itself can be built for the baseline architecture. The kernel 
+// to use is selected at runtime with simd_dispatch.
+//
+
+#include <initializer_list>
+#include <vector>
+#include <pni/core/error.hpp>
+#include <pni/io/simd_extension.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define PNIIO_SIMD_X86
+#endif
+#endif
+
+#ifdef PNIIO_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define PNIIO_TARGET_SSE2
+#define PNIIO_TARGET_SSSE3
+#define PNIIO_TARGET_AVX2
+#else
+#define PNIIO_TARGET_SSE2 __attribute__((target("sse2")))
+#define PNIIO_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define PNIIO_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \brief check if the CPU supports a SIMD extension
+    //!
+    //! \param ext the extension to check
+    //! \return true if ext can be used on this machine, always true for
+    //! NONE
+    //!
+    inline bool cpu_supports(simd_extension ext)
+    {
+        if(ext == simd_extension::NONE) return true;
+#ifdef PNIIO_SIMD_X86
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info,0);
+        int nids = info[0];
+        if(ext == simd_extension::SSE2)
+        {
+            __cpuid(info,1);
+            return (info[3] & (1<<26)) != 0;
+        }
+        if(ext == simd_extension::SSSE3)
+        {
+            __cpuid(info,1);
+            return (info[2] & (1<<9)) != 0;
+        }
+        if(ext == simd_extension::AVX2 && nids>=7)
+        {
+            //AVX2 requires OS support for the YMM registers
+            __cpuid(info,1);
+            bool osxsave = (info[2] & (1<<27)) != 0;
+            if(!osxsave || (_xgetbv(0) & 6) != 6) return false;
+            __cpuidex(info,7,0);
+            return (info[1] & (1<<5)) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        if(ext == simd_extension::SSE2)
+            return __builtin_cpu_supports("sse2");
+        if(ext == simd_extension::SSSE3)
+            return __builtin_cpu_supports("ssse3");
+        if(ext == simd_extension::AVX2)
+            return __builtin_cpu_supports("avx2");
+#endif
+#endif
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \brief runtime dispatch of a kernel
+    //!
+    //! Holds the scalar implementation of a kernel and its SIMD variants,
+    //! ordered from the most to the least preferable one. The best variant 
+    //! supported by the CPU is selected on construction. Instances are 
+    //! typically function local statics.
+    //!
+    //! \tparam KERNEL function pointer type of the kernel
+    //!
+    template<typename KERNEL> class simd_dispatch
+    {
+        public:
+            //! SIMD variant of the kernel
+            struct variant
+            {
+                simd_extension extension; //!< extension used by the kernel
+                KERNEL kernel;            //!< the kernel
+            };
+
+        private:
+            KERNEL _scalar;                 //!< scalar implementation
+            std::vector<variant> _variants; //!< SIMD variants, best first
+            simd_extension _best;           //!< best supported extension
+            KERNEL _best_kernel;            //!< kernel for _best
+
+        public:
+            //!
+            //! \brief constructor
+            //!
+            //! \param scalar the scalar implementation
+            //! \param variants SIMD variants, the most preferable first
+            //!
+            simd_dispatch(KERNEL scalar,std::initializer_list<variant> variants):
+                _scalar(scalar),
+                _variants(variants),
+                _best(simd_extension::NONE),
+                _best_kernel(scalar)
+            {
+                for(const auto &v: _variants)
+                    if(cpu_supports(v.extension))
+                    {
+                        _best = v.extension;
+                        _best_kernel = v.kernel;
+                        break;
+                    }
+            }
+
+            //-----------------------------------------------------------------
+            //! get the best extension supported by the CPU
+            simd_extension best() const { return _best; }
+
+            //-----------------------------------------------------------------
+            //! get the kernel for the best supported extension
+            KERNEL kernel() const { return _best_kernel; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check if the kernel can use an extension
+            //!
+            //! \param ext the extension to check
+            //! \return true if a variant for ext exists and the CPU 
+            //! supports ext, always true for NONE
+            //!
+            bool supported(simd_extension ext) const
+            {
+                if(ext == simd_extension::NONE) return true;
+                for(const auto &v: _variants)
+                    if(v.extension == ext) return cpu_supports(ext);
+                return false;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get the kernel for an extension
+            //!
+            //! \throws not_implemented_error if the extension is not 
+            //! supported
+            //! \param ext the requested extension
+            //! \return kernel for ext
+            //!
+            KERNEL kernel(simd_extension ext) const
+            {
+                if(ext == simd_extension::NONE) return _scalar;
+                for(const auto &v: _variants)
+                    if(v.extension == ext && cpu_supports(ext)) 
+                        return v.kernel;
+
+                throw pni::core::not_implemented_error(EXCEPTION_RECORD,
+                        "SIMD extension not supported by this CPU!");
+            }
+    };
+
+//end of namespace
+}
+}
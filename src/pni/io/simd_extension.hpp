@@ -0,0 +1,41 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+namespace pni{
+namespace io{
+
+    //!
+    //! \ingroup general_io
+    //! \brief SIMD instruction set extensions
+    //!
+    //! Identifies the implementation of a kernel with several SIMD 
+    //! variants like the CBF byte offset decoder or the TIFF byte swapping
+    //! kernels. NONE denotes the portable scalar implementation. Not every
+    //! kernel is available for every extension.
+    //!
+    enum class simd_extension { NONE, SSE2, SSSE3, AVX2 };
+
+//end of namespace
+}
+}
@@ -58,7 +58,11 @@ column_info spreadsheet_reader::_get_column(const pni::core::string &n) const
 
 //============constructors and destructor==================================
 //default constructor implementation
-spreadsheet_reader::spreadsheet_reader():data_reader(){}
+spreadsheet_reader::spreadsheet_reader():
+            data_reader(),
+            _columns_info(),
+            _nrec(0)
+{}
 
 //-------------------------------------------------------------------------
 //move constructor implementation
@@ -73,7 +77,9 @@ spreadsheet_reader::spreadsheet_reader(spreadsheet_reader &&o):
 //-------------------------------------------------------------------------
 //standard constructor implementation
 spreadsheet_reader::spreadsheet_reader(const pni::core::string &n):
-            data_reader(n)
+            data_reader(n),
+            _columns_info(),
+            _nrec(0)
 {}
 
 //-------------------------------------------------------------------------
@@ -111,6 +117,15 @@ bool spreadsheet_reader::has_column(const pni::core::string &name) const
     return false;
   }
 
+  //-------------------------------------------------------------------------
+  std::vector<column_buffer> 
+  spreadsheet_reader::_get_column_buffers(const std::vector<size_t> &) const
+  {
+    using namespace pni::core;
+    throw not_implemented_error(EXCEPTION_RECORD,
+        "Reader for file ["+filename()+"] does not support column views!");
+  }
+
   //-------------------------------------------------------------------------
   size_t spreadsheet_reader::column_index(const pni::core::string &name) const
   {
@@ -124,7 +139,8 @@ bool spreadsheet_reader::has_column(const pni::core::string &name) const
       for(auto ci: *this)
       {
 #endif
-        if(ci.name() == name) return index++;
+        if(ci.name() == name) return index;
+        index++;
       }
 
       //throw exception if the column name does not exist
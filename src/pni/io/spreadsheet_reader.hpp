@@ -29,6 +29,7 @@
 #include <pni/core/error.hpp>
 #include <pni/io/data_reader.hpp>
 #include <pni/io/column_info.hpp>
+#include <pni/io/column_view.hpp>
 #include <pni/io/windows.hpp>
 
 namespace pni{
@@ -113,6 +114,23 @@ class PNIIO_EXPORT spreadsheet_reader:public data_reader
     //!
     void _nrecords(size_t n) { _nrec = n; }
 
+    //-----------------------------------------------------------------
+    //!
+    //! \brief get column buffers
+    //!
+    //! Child classes which keep their columns in memory return a 
+    //! description of the buffer of every requested column. The buffers
+    //! must remain valid until the columns are modified. The default 
+    //! implementation throws not_implemented_error.
+    //!
+    //! \throws not_implemented_error if the reader does not keep its 
+    //! columns in memory
+    //! \param indices column indices
+    //! \return one buffer for each index
+    //!
+    virtual std::vector<column_buffer> 
+    _get_column_buffers(const std::vector<size_t> &indices) const;
+
 
   public:
     //========================public type==============================
@@ -213,6 +231,54 @@ class PNIIO_EXPORT spreadsheet_reader:public data_reader
     //!
     size_t column_index(const pni::core::string &name) const;
 
+    //-----------------------------------------------------------------
+    //!
+    //! \brief get a view on a column
+    //!
+    //! Returns a view on the data of a column kept in memory by the 
+    //! reader. No data is copied. If T is not the type in which the 
+    //! values are stored they are converted on access.
+    //!
+    //! \throws key_error if the column does not exist
+    //! \throws not_implemented_error if the reader does not support views
+    //! \throws type_error if the values cannot be converted to T
+    //! \tparam T value type
+    //! \param name name of the column
+    //! \return view on the column
+    //!
+    template<typename T>
+    column_view<T> view(const pni::core::string &name) const
+    {
+      return column_view<T>(_get_column_buffers({column_index(name)}).front());
+    }
+
+    //-----------------------------------------------------------------
+    //!
+    //! \brief iterate over records
+    //!
+    //! Returns a range over all records where each record provides the
+    //! values of the requested columns in the order of their names.
+    //!
+    //! \throws key_error if one of the columns does not exist
+    //! \throws not_implemented_error if the reader does not support views
+    //! \throws type_error if the values cannot be converted to T
+    //! \tparam T value type
+    //! \param names names of the columns
+    //! \return range of records
+    //!
+    template<typename T>
+    record_range<T> records(const std::vector<pni::core::string> &names) const
+    {
+      std::vector<size_t> indices;
+      for(const auto &name: names) indices.push_back(column_index(name));
+
+      std::vector<column_view<T>> columns;
+      for(const auto &buffer: _get_column_buffers(indices))
+        columns.push_back(column_view<T>(buffer));
+
+      return record_range<T>(std::move(columns),nrecords());
+    }
+
 };
 
 
@@ -0,0 +1,200 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <sstream>
+#include <pni/core/error.hpp>
+#include <pni/io/tiff/byte_swap.hpp>
+#include <pni/io/simd.hpp>
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    using namespace pni::core;
+
+    namespace{
+
+        //---------------------------------------------------------------------
+        // scalar byte swapping - compilers emit a single bswap or rotate
+        // instruction for these
+        //---------------------------------------------------------------------
+        inline uint16 bswap(uint16 v)
+        {
+            return static_cast<uint16>((v<<8)|(v>>8));
+        }
+
+        inline uint32 bswap(uint32 v)
+        {
+            return (v<<24) | ((v<<8)&0x00FF0000u) | ((v>>8)&0x0000FF00u) |
+                   (v>>24);
+        }
+
+        inline uint64 bswap(uint64 v)
+        {
+            return (static_cast<uint64>(bswap(static_cast<uint32>(v)))<<32) |
+                   bswap(static_cast<uint32>(v>>32));
+        }
+
+        //---------------------------------------------------------------------
+        template<typename T> void swap_scalar(char *data,size_t n)
+        {
+            T value;
+            for(size_t i=0;i<n;++i,data+=sizeof(T))
+            {
+                std::memcpy(&value,data,sizeof(T));
+                value = bswap(value);
+                std::memcpy(data,&value,sizeof(T));
+            }
+        }
+
+        //---------------------------------------------------------------------
+        void swap_scalar(char *data,size_t n,size_t size)
+        {
+            switch(size)
+            {
+                case 2: swap_scalar<uint16>(data,n); break;
+                case 4: swap_scalar<uint32>(data,n); break;
+                case 8: swap_scalar<uint64>(data,n); break;
+            }
+        }
+
+#ifdef PNIIO_SIMD_X86
+        //---------------------------------------------------------------------
+        //shuffle control reversing every group of size bytes in 16 bytes
+        void shuffle_mask(char *mask,size_t size)
+        {
+            for(size_t j=0;j<16;++j)
+                mask[j] = static_cast<char>((j/size)*size+size-1-j%size);
+        }
+
+        //---------------------------------------------------------------------
+        //
+        // SSSE3 kernel. Every 16 byte block is permuted with a single
+        // pshufb. Remaining samples are swapped with scalar code.
+        //
+        PNIIO_TARGET_SSSE3
+        void swap_ssse3(char *data,size_t n,size_t size)
+        {
+            char control[16];
+            shuffle_mask(control,size);
+            const __m128i mask = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(control));
+
+            size_t nblocks = n*size/16;
+            for(size_t i=0;i<nblocks;++i,data+=16)
+            {
+                __m128i *p = reinterpret_cast<__m128i*>(data);
+                _mm_storeu_si128(p,_mm_shuffle_epi8(_mm_loadu_si128(p),mask));
+            }
+
+            swap_scalar(data,n-nblocks*16/size,size);
+        }
+
+        //---------------------------------------------------------------------
+        //
+        // AVX2 kernel. vpshufb permutes within the two 128Bit lanes which
+        // is sufficient as samples never cross a lane boundary. Two
+        // registers are processed per iteration.
+        //
+        PNIIO_TARGET_AVX2
+        void swap_avx2(char *data,size_t n,size_t size)
+        {
+            char control[32];
+            shuffle_mask(control,size);
+            shuffle_mask(control+16,size);
+            const __m256i mask = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(control));
+
+            size_t nblocks = n*size/64;
+            for(size_t i=0;i<nblocks;++i,data+=64)
+            {
+                __m256i *p = reinterpret_cast<__m256i*>(data);
+                __m256i a = _mm256_loadu_si256(p);
+                __m256i b = _mm256_loadu_si256(p+1);
+                _mm256_storeu_si256(p,_mm256_shuffle_epi8(a,mask));
+                _mm256_storeu_si256(p+1,_mm256_shuffle_epi8(b,mask));
+            }
+
+            swap_scalar(data,n-nblocks*64/size,size);
+        }
+#endif
+
+        //---------------------------------------------------------------------
+        typedef void (*kernel_type)(char *,size_t,size_t);
+
+        //---------------------------------------------------------------------
+        const simd_dispatch<kernel_type> &dispatch()
+        {
+            static const simd_dispatch<kernel_type> kernels(swap_scalar,{
+#ifdef PNIIO_SIMD_X86
+                    {simd_extension::AVX2,swap_avx2},
+                    {simd_extension::SSSE3,swap_ssse3}
+#endif
+                    });
+            return kernels;
+        }
+
+        //---------------------------------------------------------------------
+        void run_kernel(kernel_type kernel,char *data,size_t n,size_t size)
+        {
+            if(size!=1 && size!=2 && size!=4 && size!=8)
+            {
+                std::stringstream ss;
+                ss<<"Cannot swap bytes of samples with "<<size<<" bytes!";
+                throw value_error(EXCEPTION_RECORD,ss.str());
+            }
+
+            if(size>1 && n) kernel(data,n,size);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    simd_extension byte_swap_simd_extension()
+    {
+        return dispatch().best();
+    }
+
+    //-------------------------------------------------------------------------
+    bool byte_swap_simd_supported(simd_extension ext)
+    {
+        return dispatch().supported(ext);
+    }
+
+    //-------------------------------------------------------------------------
+    void swap_bytes(char *data,size_t n,size_t size)
+    {
+        static const kernel_type kernel = dispatch().kernel();
+
+        run_kernel(kernel,data,n,size);
+    }
+
+    //-------------------------------------------------------------------------
+    void swap_bytes(simd_extension ext,char *data,size_t n,size_t size)
+    {
+        run_kernel(dispatch().kernel(ext),data,n,size);
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,129 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <pni/core/types.hpp>
+#include <pni/io/simd_extension.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //! SIMD extensions - the byte swapping kernels support SSSE3 and AVX2
+    using pni::io::simd_extension;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief check the byte order of the host
+    //!
+    //! \return true if the host stores data as little endian
+    //!
+    inline bool host_is_little_endian()
+    {
+        const pni::core::uint16 value = 1;
+        return *reinterpret_cast<const unsigned char*>(&value) == 1;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief reverse the bytes of a single value
+    //!
+    //! \tparam T type of the value
+    //! \param value the original value
+    //! \return value with reversed byte order
+    //!
+    template<typename T> T swap_value(T value)
+    {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes,&value,sizeof(T));
+        std::reverse(bytes,bytes+sizeof(T));
+        std::memcpy(&value,bytes,sizeof(T));
+        return value;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief get the SIMD extension used for byte swapping
+    //!
+    //! The implementation is selected once at runtime according to the
+    //! capabilities of the CPU.
+    //!
+    //! \return best SIMD extension supported by the CPU and the build
+    //!
+    PNIIO_EXPORT simd_extension byte_swap_simd_extension();
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief check if a SIMD extension can be used
+    //!
+    //! \param ext the extension to check
+    //! \return true if the byte swapping kernels can use ext
+    //!
+    PNIIO_EXPORT bool byte_swap_simd_supported(simd_extension ext);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief swap the bytes of samples in place
+    //!
+    //! Reverses the byte order of n consecutive samples of 1, 2, 4 or 8
+    //! bytes. Whole registers of samples are permuted with a single
+    //! shuffle instruction on CPUs with SSSE3 or AVX2.
+    //!
+    //! \throws value_error if the sample size is not 1, 2, 4 or 8
+    //! \param data pointer to the first sample
+    //! \param n number of samples
+    //! \param size size of a sample in bytes
+    //!
+    PNIIO_EXPORT void swap_bytes(char *data,size_t n,size_t size);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief swap bytes with a particular implementation
+    //!
+    //! Like the above function but with an explicitly selected
+    //! implementation. This is mainly used to check the SIMD
+    //! implementations against the scalar one.
+    //!
+    //! \throws value_error if the sample size is not 1, 2, 4 or 8
+    //! \throws not_implemented_error if ext is not supported
+    //! \param ext SIMD extension to use
+    //! \param data pointer to the first sample
+    //! \param n number of samples
+    //! \param size size of a sample in bytes
+    //!
+    PNIIO_EXPORT void swap_bytes(simd_extension ext,char *data,size_t n,
+                                 size_t size);
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,600 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+#include <zlib.h>
+#include <pni/core/error.hpp>
+#include <pni/io/tiff/byte_swap.hpp>
+#include <pni/io/tiff/compression.hpp>
+
+using namespace pni::core;
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    namespace
+    {
+        //---------------------------------------------------------------------
+        //undo horizontal differencing for a single row of n samples
+        template<typename T>
+        void horizontal_accumulate(char *row,size_t n,size_t stride)
+        {
+            T previous,current;
+            if(stride == 1 && n)
+            {
+                //keep the running sum in a register
+                std::memcpy(&previous,row,sizeof(T));
+                for(size_t i=1;i<n;++i)
+                {
+                    std::memcpy(&current,row+i*sizeof(T),sizeof(T));
+                    previous = T(previous+current);
+                    std::memcpy(row+i*sizeof(T),&previous,sizeof(T));
+                }
+                return;
+            }
+
+            for(size_t i=stride;i<n;++i)
+            {
+                std::memcpy(&previous,row+(i-stride)*sizeof(T),sizeof(T));
+                std::memcpy(&current,row+i*sizeof(T),sizeof(T));
+                current = T(current+previous);
+                std::memcpy(row+i*sizeof(T),&current,sizeof(T));
+            }
+        }
+
+        //---------------------------------------------------------------------
+        //undo the floating point predictor for a single row. The row holds
+        //the byte planes of the samples starting with the most significant
+        //byte independent of the byte order of the file. The samples are 
+        //written back in the byte order of the host.
+        void floating_point_accumulate(char *row,size_t size,size_t stride,
+                                       size_t sample_size,char *buffer)
+        {
+            static const bool little_endian = host_is_little_endian();
+            unsigned char *bytes = reinterpret_cast<unsigned char*>(row);
+            for(size_t i=stride;i<size;++i)
+                bytes[i] = static_cast<unsigned char>(bytes[i]+bytes[i-stride]);
+
+            size_t n = size/sample_size;
+            for(size_t k=0;k<sample_size;++k)
+            {
+                size_t byte = little_endian ? sample_size-1-k : k;
+                const char *plane = row+byte*n;
+                char *out = buffer+k;
+                for(size_t s=0;s<n;++s,out+=sample_size) *out = plane[s];
+            }
+            std::memcpy(row,buffer,size);
+        }
+
+        //---------------------------------------------------------------------
+        //copy a string which may overlap with its destination
+        void copy_string(char *dest,const char *src,size_t n)
+        {
+            if(src+n<=dest)
+                std::memcpy(dest,src,n);
+            else
+                for(size_t i=0;i<n;++i) dest[i] = src[i];
+        }
+    }
+
+    //=========================tag conversion==================================
+    compression to_compression(size_t value)
+    {
+        switch(value)
+        {
+            case 1:     return compression::NONE;
+            case 5:     return compression::LZW;
+            case 8:     return compression::DEFLATE;
+            case 32773: return compression::PACKBITS;
+            case 32946: return compression::DEFLATE_OLD;
+            default:
+            {
+                std::stringstream ss;
+                ss<<"TIFF compression scheme "<<value<<" is not supported!";
+                throw not_implemented_error(EXCEPTION_RECORD,ss.str());
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    predictor to_predictor(size_t value)
+    {
+        switch(value)
+        {
+            case 1: return predictor::NONE;
+            case 2: return predictor::HORIZONTAL;
+            case 3: return predictor::FLOATING_POINT;
+            default:
+            {
+                std::stringstream ss;
+                ss<<"TIFF predictor "<<value<<" is not supported!";
+                throw not_implemented_error(EXCEPTION_RECORD,ss.str());
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    std::ostream &operator<<(std::ostream &o,const compression &c)
+    {
+        switch(c)
+        {
+            case compression::NONE:        return o<<"none";
+            case compression::LZW:         return o<<"LZW";
+            case compression::DEFLATE:
+            case compression::DEFLATE_OLD: return o<<"Deflate";
+            case compression::PACKBITS:    return o<<"PackBits";
+        }
+        return o;
+    }
+
+    //-------------------------------------------------------------------------
+    std::ostream &operator<<(std::ostream &o,const predictor &p)
+    {
+        switch(p)
+        {
+            case predictor::NONE:           return o<<"none";
+            case predictor::HORIZONTAL:     return o<<"horizontal";
+            case predictor::FLOATING_POINT: return o<<"floating point";
+        }
+        return o;
+    }
+
+    //=====================implementation of the zlib deleter==================
+    void strip_decoder::zlib_deleter::operator()(z_stream_s *stream) const
+    {
+        inflateEnd(stream);
+        delete stream;
+    }
+
+    //================implementation of constructors and destructor============
+    strip_decoder::strip_decoder():
+        _compression(compression::NONE),
+        _predictor(predictor::NONE),
+        _samples_per_pixel(1),
+        _sample_size(0),
+        _row_size(0),
+        _strip_size(0),
+        _swap(false)
+    { }
+
+    //-------------------------------------------------------------------------
+    strip_decoder::strip_decoder(compression c,predictor p,
+                                 size_t samples_per_pixel,size_t sample_size,
+                                 size_t row_size,size_t strip_size,
+                                 bool swap):
+        _compression(c),
+        _predictor(p),
+        _samples_per_pixel(samples_per_pixel),
+        _sample_size(sample_size),
+        _row_size(row_size),
+        _strip_size(strip_size),
+        _swap(swap && _sample_size!=1)
+    {
+        if(_swap && _sample_size!=2 && _sample_size!=4 && _sample_size!=8)
+            throw not_implemented_error(EXCEPTION_RECORD,
+                    "Byte swapping is only supported for samples of equal "
+                    "size with 1, 2, 4 or 8 bytes!");
+
+        if(_predictor == predictor::NONE) return;
+
+        bool valid = _row_size && (_sample_size==1 || _sample_size==2 ||
+                                   _sample_size==4 || _sample_size==8);
+        if(_predictor == predictor::FLOATING_POINT && _sample_size==1)
+            valid = false;
+
+        if(!valid || _row_size%(_sample_size*_samples_per_pixel))
+        {
+            std::stringstream ss;
+            ss<<"Cannot apply "<<_predictor<<" predictor to samples of ";
+            ss<<_sample_size<<" bytes!";
+            throw value_error(EXCEPTION_RECORD,ss.str());
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    strip_decoder::strip_decoder(const strip_decoder &d):
+        _compression(d._compression),
+        _predictor(d._predictor),
+        _samples_per_pixel(d._samples_per_pixel),
+        _sample_size(d._sample_size),
+        _row_size(d._row_size),
+        _strip_size(d._strip_size),
+        _swap(d._swap)
+    { }
+
+    //-------------------------------------------------------------------------
+    strip_decoder::strip_decoder(strip_decoder &&d) noexcept:
+        _compression(d._compression),
+        _predictor(d._predictor),
+        _samples_per_pixel(d._samples_per_pixel),
+        _sample_size(d._sample_size),
+        _row_size(d._row_size),
+        _strip_size(d._strip_size),
+        _swap(d._swap),
+        _input(std::move(d._input)),
+        _output(std::move(d._output)),
+        _row(std::move(d._row)),
+        _lzw_table(std::move(d._lzw_table)),
+        _zstream(std::move(d._zstream))
+    { }
+
+    //-------------------------------------------------------------------------
+    strip_decoder::~strip_decoder()
+    { }
+
+    //====================implementation of assignment operators===============
+    strip_decoder &strip_decoder::operator=(const strip_decoder &d)
+    {
+        if(this == &d) return *this;
+
+        _compression = d._compression;
+        _predictor = d._predictor;
+        _samples_per_pixel = d._samples_per_pixel;
+        _sample_size = d._sample_size;
+        _row_size = d._row_size;
+        _strip_size = d._strip_size;
+        _swap = d._swap;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    strip_decoder &strip_decoder::operator=(strip_decoder &&d) noexcept
+    {
+        if(this == &d) return *this;
+
+        _compression = d._compression;
+        _predictor = d._predictor;
+        _samples_per_pixel = d._samples_per_pixel;
+        _sample_size = d._sample_size;
+        _row_size = d._row_size;
+        _strip_size = d._strip_size;
+        _swap = d._swap;
+        _input = std::move(d._input);
+        _output = std::move(d._output);
+        _row = std::move(d._row);
+        _lzw_table = std::move(d._lzw_table);
+        _zstream = std::move(d._zstream);
+        return *this;
+    }
+
+    //================implementation of static public methods==================
+    strip_decoder strip_decoder::create(std::ifstream &stream,
+                                        const ifd &image_dir,
+                                        const image_info &info,
+                                        size_t width,size_t rows)
+    {
+        auto bits_per_channel = info.bits_per_channel();
+        size_t pixel_size = std::accumulate(bits_per_channel.begin(),
+                                            bits_per_channel.end(),0)/8;
+        size_t row_size = width*pixel_size;
+
+        //all channels must have the same size for the predictor
+        size_t sample_size = bits_per_channel[0]/8;
+        for(auto bits: bits_per_channel)
+            if(bits != bits_per_channel[0]) sample_size = 0;
+
+        return strip_decoder(
+                to_compression(image_dir.value(stream,"Compression",1)),
+                to_predictor(image_dir.value(stream,"Predictor",1)),
+                bits_per_channel.size(),sample_size,row_size,rows*row_size,
+                image_dir.format().swap());
+    }
+
+    //=====================implementation of private methods===================
+    size_t strip_decoder::_decode_lzw(const unsigned char *src,size_t size)
+    {
+        static const size_t clear_code = 256;
+        static const size_t eoi_code   = 257;
+        static const size_t first_code = 258;
+        static const size_t max_codes  = 4096;
+
+        //old style codes are stored LSB first and start with a clear code
+        if(size>=2 && src[0]==0 && (src[1]&0x1))
+            throw file_error(EXCEPTION_RECORD,
+                    "Old style LZW compression is not supported!");
+
+        //A string in the table is the previous string followed by the first
+        //character of the next one. As all strings are written to the
+        //output one after the other, every string can be found in the
+        //output and the table only stores offset and length.
+        _lzw_table.resize(2*max_codes);
+        size_t *offsets = _lzw_table.data();
+        size_t *lengths = offsets+max_codes;
+
+        char *out = _output.data();
+        const size_t capacity = _output.size();
+        const unsigned char *end = src+size;
+
+        uint32 bits = 0;         //bit buffer
+        size_t nbits = 0;        //number of valid bits in the buffer
+        size_t code_size = 9;    //current code size in bits
+        size_t next_code = first_code;
+        bool   has_previous = false;
+        size_t previous_offset = 0,previous_length = 0;
+        size_t pos = 0;
+
+        while(pos<capacity)
+        {
+            //codes are stored MSB first
+            while(nbits<code_size && src<end)
+            {
+                bits = (bits<<8)|*src++;
+                nbits += 8;
+            }
+            if(nbits<code_size)
+                throw file_error(EXCEPTION_RECORD,"LZW data is truncated!");
+
+            nbits -= code_size;
+            size_t code = (bits>>nbits)&((1u<<code_size)-1);
+            bits &= (1u<<nbits)-1;
+
+            if(code == eoi_code) break;
+            if(code == clear_code)
+            {
+                code_size = 9;
+                next_code = first_code;
+                has_previous = false;
+                continue;
+            }
+
+            size_t length = 1;
+            size_t n = 1;
+            if(code<256)
+                out[pos] = static_cast<char>(code);
+            else if(code<next_code)
+            {
+                length = lengths[code];
+                n = std::min(length,capacity-pos);
+                copy_string(out+pos,out+offsets[code],n);
+            }
+            else if(code == next_code && has_previous)
+            {
+                //the string is the previous one plus its first character
+                length = previous_length+1;
+                n = std::min(length,capacity-pos);
+                copy_string(out+pos,out+previous_offset,n);
+            }
+            else
+                throw file_error(EXCEPTION_RECORD,"Corrupt LZW data!");
+
+            if(has_previous && next_code<max_codes)
+            {
+                offsets[next_code] = previous_offset;
+                lengths[next_code] = previous_length+1;
+                //early change - the code size increases one code too early
+                if(++next_code+1>=(size_t(1)<<code_size) && code_size<12)
+                    ++code_size;
+            }
+
+            has_previous = true;
+            previous_offset = pos;
+            previous_length = length;
+            pos += n;
+        }
+
+        return pos;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t strip_decoder::_decode_deflate(const unsigned char *src,size_t size)
+    {
+        if(!_zstream)
+        {
+            std::unique_ptr<z_stream> stream(new z_stream);
+            std::memset(stream.get(),0,sizeof(z_stream));
+            if(inflateInit(stream.get()) != Z_OK)
+                throw memory_allocation_error(EXCEPTION_RECORD,
+                        "Cannot initialize zlib stream!");
+            _zstream.reset(stream.release());
+        }
+        else
+            inflateReset(_zstream.get());
+
+        z_stream *stream = _zstream.get();
+        stream->next_in   = const_cast<Bytef*>(src);
+        stream->avail_in  = static_cast<uInt>(size);
+        stream->next_out  = reinterpret_cast<Bytef*>(_output.data());
+        stream->avail_out = static_cast<uInt>(_output.size());
+
+        int status = inflate(stream,Z_FINISH);
+        //the strip is complete if the stream ended or the output is full -
+        //otherwise the input ended before the stream
+        if(status == Z_OK || status == Z_BUF_ERROR)
+        {
+            if(stream->avail_out)
+                throw file_error(EXCEPTION_RECORD,
+                        "Deflate data is truncated!");
+        }
+        else if(status != Z_STREAM_END)
+        {
+            std::stringstream ss;
+            ss<<"Corrupt Deflate data";
+            if(stream->msg) ss<<" ("<<stream->msg<<")";
+            ss<<"!";
+            throw file_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        return _output.size()-stream->avail_out;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t strip_decoder::_decode_packbits(const unsigned char *src,
+                                           size_t size)
+    {
+        char *out = _output.data();
+        const size_t capacity = _output.size();
+        const unsigned char *end = src+size;
+        size_t pos = 0;
+
+        while(src<end && pos<capacity)
+        {
+            int header = static_cast<signed char>(*src++);
+            if(header>=0)
+            {
+                //literal run
+                size_t count = header+1;
+                if(count>size_t(end-src))
+                    throw file_error(EXCEPTION_RECORD,
+                            "PackBits data is truncated!");
+                size_t n = std::min(count,capacity-pos);
+                std::memcpy(out+pos,src,n);
+                src += count;
+                pos += n;
+            }
+            else if(header != -128)
+            {
+                //replicate the next byte
+                if(src == end)
+                    throw file_error(EXCEPTION_RECORD,
+                            "PackBits data is truncated!");
+                size_t n = std::min<size_t>(1-header,capacity-pos);
+                std::memset(out+pos,*src++,n);
+                pos += n;
+            }
+        }
+
+        return pos;
+    }
+
+    //-------------------------------------------------------------------------
+    void strip_decoder::_undo_predictor(size_t nrows)
+    {
+        char *row = _output.data();
+        size_t nsamples = _row_size/_sample_size;
+
+        if(_predictor == predictor::HORIZONTAL)
+        {
+            for(size_t i=0;i<nrows;++i,row+=_row_size)
+            {
+                switch(_sample_size)
+                {
+                    case 1: horizontal_accumulate<uint8>(row,nsamples,
+                                    _samples_per_pixel); break;
+                    case 2: horizontal_accumulate<uint16>(row,nsamples,
+                                    _samples_per_pixel); break;
+                    case 4: horizontal_accumulate<uint32>(row,nsamples,
+                                    _samples_per_pixel); break;
+                    case 8: horizontal_accumulate<uint64>(row,nsamples,
+                                    _samples_per_pixel); break;
+                }
+            }
+        }
+        else if(_predictor == predictor::FLOATING_POINT)
+        {
+            _row.resize(_row_size);
+            for(size_t i=0;i<nrows;++i,row+=_row_size)
+                floating_point_accumulate(row,_row_size,_samples_per_pixel,
+                                          _sample_size,_row.data());
+        }
+    }
+
+    //=====================implementation of public methods====================
+    bool strip_decoder::same_parameters(const strip_decoder &d) const
+    {
+        return _compression == d._compression && 
+               _predictor == d._predictor &&
+               _samples_per_pixel == d._samples_per_pixel &&
+               _sample_size == d._sample_size &&
+               _row_size == d._row_size && 
+               _strip_size == d._strip_size && 
+               _swap == d._swap;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t strip_decoder::decode(const char *data,size_t size)
+    {
+        _output.resize(_strip_size);
+        const unsigned char *src = reinterpret_cast<const unsigned char*>(data);
+
+        size_t n = 0;
+        switch(_compression)
+        {
+            case compression::NONE:
+                n = std::min(size,_output.size());
+                std::memcpy(_output.data(),data,n);
+                break;
+            case compression::LZW:
+                n = _decode_lzw(src,size); break;
+            case compression::DEFLATE:
+            case compression::DEFLATE_OLD:
+                n = _decode_deflate(src,size); break;
+            case compression::PACKBITS:
+                n = _decode_packbits(src,size); break;
+        }
+
+        //the floating point predictor yields the byte order of the host
+        if(_swap && _predictor != predictor::FLOATING_POINT)
+            swap_bytes(_output.data(),n/_sample_size,_sample_size);
+
+        if(_predictor != predictor::NONE) _undo_predictor(n/_row_size);
+        return n;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t strip_decoder::decode(const char *buffer,size_t size,size_t offset,
+                                 size_t count)
+    {
+        return decode(fetch(buffer,size,offset,count),count);
+    }
+
+    //-------------------------------------------------------------------------
+    size_t strip_decoder::decode(std::ifstream &stream,size_t offset,
+                                 size_t count)
+    {
+        return decode(fetch(stream,offset,count),count);
+    }
+
+    //-------------------------------------------------------------------------
+    const char *strip_decoder::fetch(const char *buffer,size_t size,
+                                     size_t offset,size_t count)
+    {
+        if(offset>size || count>size-offset)
+            throw file_error(EXCEPTION_RECORD,
+                    "Strip exceeds the size of the file!");
+
+        return buffer+offset;
+    }
+
+    //-------------------------------------------------------------------------
+    const char *strip_decoder::fetch(std::ifstream &stream,size_t offset,
+                                     size_t count)
+    {
+        _input.resize(count);
+
+        stream.clear();
+        stream.seekg(offset,std::ios::beg);
+        if(!stream.read(_input.data(),static_cast<std::streamsize>(count)))
+            throw file_error(EXCEPTION_RECORD,
+                    "Error reading strip from TIFF file!");
+
+        return _input.data();
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,357 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <pni/core/types.hpp>
+#include <pni/io/image_info.hpp>
+#include <pni/io/tiff/ifd.hpp>
+#include <pni/io/windows.hpp>
+
+//forward declaration of the zlib stream state
+struct z_stream_s;
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief compression schemes
+    //!
+    //! Values of the Compression tag supported by the strip decoder.
+    //!
+    enum class compression
+    {
+        NONE          = 1,     //!< uncompressed data
+        LZW           = 5,     //!< Lempel-Ziv-Welch
+        DEFLATE       = 8,     //!< zlib (Adobe style)
+        PACKBITS      = 32773, //!< Macintosh run length encoding
+        DEFLATE_OLD   = 32946  //!< zlib (obsolete code)
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief predictor schemes
+    //!
+    //! Values of the Predictor tag.
+    //!
+    enum class predictor
+    {
+        NONE           = 1, //!< no prediction
+        HORIZONTAL     = 2, //!< horizontal differencing of samples
+        FLOATING_POINT = 3  //!< byte-wise differencing of floating point data
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief convert a Compression tag value
+    //!
+    //! \throws not_implemented_error if the compression scheme is not
+    //! supported
+    //! \param value value of the Compression tag
+    //! \return compression scheme
+    //!
+    PNIIO_EXPORT compression to_compression(size_t value);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief convert a Predictor tag value
+    //!
+    //! \throws not_implemented_error if the predictor is not supported
+    //! \param value value of the Predictor tag
+    //! \return predictor
+    //!
+    PNIIO_EXPORT predictor to_predictor(size_t value);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief output operator for compression
+    //!
+    PNIIO_EXPORT std::ostream &operator<<(std::ostream &o,const compression &c);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief output operator for predictor
+    //!
+    PNIIO_EXPORT std::ostream &operator<<(std::ostream &o,const predictor &p);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief decoder for compressed strips
+    //!
+    //! Decompresses a single strip, converts the samples to the byte order
+    //! of the host and undoes the predictor. The decoded strip is stored in
+    //! an internal buffer which is reused for the next strip. The same holds
+    //! for the buffer with the compressed data, the LZW string table and the
+    //! zlib state. Thus, once the first strip has been decoded, decoding
+    //! further strips of the same size does not allocate memory.
+    //!
+    //! Copying a decoder copies its parameters but not its buffers. Moving
+    //! a decoder moves its buffers. tiff_reader uses this to hand the
+    //! buffers of one image to the decoder of the next one if both have
+    //! the same parameters (see same_parameters()). A decoder must not be
+    //! used by several threads at the same time.
+    //!
+    class PNIIO_EXPORT strip_decoder
+    {
+        public:
+            //! deleter for the zlib stream
+            struct zlib_deleter
+            {
+                //! release the zlib stream
+                void operator()(z_stream_s *stream) const;
+            };
+        private:
+            compression _compression; //!< compression scheme
+            predictor   _predictor;   //!< predictor
+            size_t _samples_per_pixel; //!< number of samples per pixel
+            size_t _sample_size; //!< size of a sample in bytes
+            size_t _row_size;    //!< size of an image row in bytes
+            size_t _strip_size;  //!< size of a decoded strip in bytes
+            bool   _swap;        //!< true if sample bytes must be swapped
+#ifdef _MSC_VER
+#pragma warning(disable:4251)
+#endif
+            std::vector<char> _input;  //!< buffer for compressed data
+            std::vector<char> _output; //!< buffer for the decoded strip
+            std::vector<char> _row;    //!< row buffer for the FP predictor
+            std::vector<size_t> _lzw_table; //!< LZW string offsets and lengths
+            std::unique_ptr<z_stream_s,zlib_deleter> _zstream; //!< zlib state
+#ifdef _MSC_VER
+#pragma warning(default:4251)
+#endif
+
+            //! decode LZW data, returns number of decoded bytes
+            size_t _decode_lzw(const unsigned char *src,size_t size);
+
+            //! decode Deflate data, returns number of decoded bytes
+            size_t _decode_deflate(const unsigned char *src,size_t size);
+
+            //! decode PackBits data, returns number of decoded bytes
+            size_t _decode_packbits(const unsigned char *src,size_t size);
+
+            //! undo the predictor for the first nrows rows of the output
+            void _undo_predictor(size_t nrows);
+
+        public:
+            //=================constructors and destructor=====================
+            //! default constructor - no compression
+            strip_decoder();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \throws value_error if the predictor cannot be applied to the
+            //! sample layout
+            //! \throws not_implemented_error if bytes must be swapped for 
+            //! samples of different or unsupported size
+            //! \param c compression scheme
+            //! \param p predictor
+            //! \param samples_per_pixel number of samples per pixel
+            //! \param sample_size size of a single sample in bytes
+            //! \param row_size size of a decoded image row in bytes
+            //! \param strip_size size of a decoded strip in bytes
+            //! \param swap true if the byte order of the file differs from
+            //! the one of the host
+            //!
+            strip_decoder(compression c,predictor p,size_t samples_per_pixel,
+                          size_t sample_size,size_t row_size,
+                          size_t strip_size,bool swap = false);
+
+            //-----------------------------------------------------------------
+            //! copy constructor - copies only the parameters
+            strip_decoder(const strip_decoder &d);
+
+            //-----------------------------------------------------------------
+            //! move constructor
+            strip_decoder(strip_decoder &&d) noexcept;
+
+            //-----------------------------------------------------------------
+            //! destructor
+            ~strip_decoder();
+
+            //================assignment operators=============================
+            //! copy assignment - copies only the parameters
+            strip_decoder &operator=(const strip_decoder &d);
+
+            //-----------------------------------------------------------------
+            //! move assignment
+            strip_decoder &operator=(strip_decoder &&d) noexcept;
+
+            //================static public member functions====================
+            //!
+            //! \brief create a decoder for an image
+            //!
+            //! Creates a decoder from the Compression and Predictor entries
+            //! and the byte order of an IFD for blocks (strips or tiles) of 
+            //! rows x width pixels.
+            //!
+            //! \throws not_implemented_error if the compression scheme or 
+            //! predictor is not supported
+            //! \throws value_error if the predictor does not fit the sample
+            //! layout
+            //! \param stream input stream from which to read data
+            //! \param image_dir IFD of the image
+            //! \param info image information
+            //! \param width number of pixels in a row of a block
+            //! \param rows number of rows in a block
+            //! \return decoder instance
+            //!
+            static strip_decoder create(std::ifstream &stream,
+                                        const ifd &image_dir,
+                                        const image_info &info,
+                                        size_t width,size_t rows);
+
+            //=================public member functions=========================
+            //! get compression scheme
+            compression compression_scheme() const { return _compression; }
+
+            //-----------------------------------------------------------------
+            //! get predictor
+            predictor prediction() const { return _predictor; }
+
+            //-----------------------------------------------------------------
+            //! get size of a decoded strip in bytes
+            size_t strip_size() const { return _strip_size; }
+
+            //-----------------------------------------------------------------
+            //! get size of a decoded row in bytes
+            size_t row_size() const { return _row_size; }
+
+            //-----------------------------------------------------------------
+            //! true if the bytes of the samples are swapped
+            bool swaps_bytes() const { return _swap; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief true if d decodes with the same parameters
+            //!
+            //! A decoder with the same parameters can take over the 
+            //! buffers of d by move assignment. This is how readers reuse
+            //! the buffers of one image for the next one.
+            //!
+            bool same_parameters(const strip_decoder &d) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief true if strips must be decoded
+            //!
+            //! Returns false for uncompressed data without predictor in the
+            //! byte order of the host. Such strips can be used as they are 
+            //! stored in the file.
+            //!
+            bool is_active() const
+            {
+                return _compression != compression::NONE ||
+                       _predictor != predictor::NONE || _swap;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief decode a strip from memory
+            //!
+            //! \throws file_error if the data is corrupt or truncated
+            //! \param data pointer to the encoded strip
+            //! \param size size of the encoded strip in bytes
+            //! \return number of decoded bytes available via data()
+            //!
+            size_t decode(const char *data,size_t size);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief decode a strip from a buffer holding the entire file
+            //!
+            //! \throws file_error if the strip exceeds the buffer or the data
+            //! is corrupt or truncated
+            //! \param buffer pointer to the first byte of the file
+            //! \param size size of the buffer
+            //! \param offset offset of the strip
+            //! \param count size of the encoded strip in bytes
+            //! \return number of decoded bytes available via data()
+            //!
+            size_t decode(const char *buffer,size_t size,size_t offset,
+                          size_t count);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief decode a strip from a stream
+            //!
+            //! \throws file_error if reading fails or the data is corrupt or
+            //! truncated
+            //! \param stream input stream
+            //! \param offset offset of the strip
+            //! \param count size of the encoded strip in bytes
+            //! \return number of decoded bytes available via data()
+            //!
+            size_t decode(std::ifstream &stream,size_t offset,size_t count);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get raw bytes from a buffer holding the entire file
+            //!
+            //! \throws file_error if the range exceeds the buffer
+            //! \param buffer pointer to the first byte of the file
+            //! \param size size of the buffer
+            //! \param offset offset of the first byte
+            //! \param count number of bytes
+            //! \return pointer to the first byte
+            //!
+            const char *fetch(const char *buffer,size_t size,size_t offset,
+                              size_t count);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read raw bytes from a stream
+            //!
+            //! The bytes are read into the input buffer of the decoder which
+            //! is overwritten by the next call to fetch() or decode().
+            //!
+            //! \throws file_error if reading fails
+            //! \param stream input stream
+            //! \param offset offset of the first byte
+            //! \param count number of bytes
+            //! \return pointer to the first byte
+            //!
+            const char *fetch(std::ifstream &stream,size_t offset,size_t count);
+
+            //-----------------------------------------------------------------
+            //! get pointer to the decoded strip
+            const char *data() const { return _output.data(); }
+    };
+
+//end of namespace
+}
+}
+}
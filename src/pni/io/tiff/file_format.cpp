@@ -0,0 +1,76 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <pni/core/error.hpp>
+#include <pni/io/tiff/file_format.hpp>
+
+using namespace pni::core;
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //=================implementation of static public methods=================
+    file_format file_format::read(std::istream &stream)
+    {
+        stream.clear();
+        stream.seekg(0,std::ios::beg);
+
+        //byte order mark
+        char order[2] = {0,0};
+        stream.read(order,2);
+        if(!stream || order[0]!=order[1] || (order[0]!='I' && order[0]!='M'))
+            throw file_error(EXCEPTION_RECORD,"Not a TIFF file!");
+
+        file_format format(order[0]=='I',false);
+        uint16 version = format.read<uint16>(stream);
+        if(version == 42) return format;
+
+        //BigTIFF - the version is followed by the size of an offset and a
+        //reserved field which must be 0
+        if(version == 43)
+        {
+            uint16 offset_size = format.read<uint16>(stream);
+            uint16 reserved = format.read<uint16>(stream);
+            if(stream && offset_size == 8 && reserved == 0)
+                return file_format(format.little_endian(),true);
+
+            throw file_error(EXCEPTION_RECORD,
+                    "Unsupported offset size in BigTIFF file!");
+        }
+
+        throw file_error(EXCEPTION_RECORD,"Not a TIFF file!");
+    }
+
+    //=================implementation of friend operators======================
+    std::ostream &operator<<(std::ostream &o,const file_format &f)
+    {
+        o<<(f.big_tiff() ? "BigTIFF" : "TIFF")<<" (";
+        o<<(f.little_endian() ? "little" : "big")<<" endian)";
+        return o;
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,180 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <cstring>
+#include <iostream>
+#include <pni/core/types.hpp>
+#include <pni/io/tiff/byte_swap.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief TIFF file format
+    //!
+    //! Describes how the binary data of a TIFF file is laid out: the byte
+    //! order ("II" or "MM") and whether the file is a classic TIFF file
+    //! with 32Bit offsets or a BigTIFF file with 64Bit offsets. All
+    //! integers in the IFDs are read through an instance of this class.
+    //!
+    class PNIIO_EXPORT file_format
+    {
+        private:
+            bool _little_endian; //!< true if data is stored as little endian
+            bool _big_tiff;      //!< true for BigTIFF files
+        public:
+            //!
+            //! \brief default constructor
+            //!
+            //! Classic little endian TIFF.
+            //!
+            file_format():
+                _little_endian(true),
+                _big_tiff(false)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param little_endian true if data is stored as little endian
+            //! \param big_tiff true for a BigTIFF file
+            //!
+            file_format(bool little_endian,bool big_tiff):
+                _little_endian(little_endian),
+                _big_tiff(big_tiff)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read the file header
+            //!
+            //! Reads the byte order and the version from the header at the
+            //! beginning of the file. Afterwards the stream points to the
+            //! offset of the first IFD.
+            //!
+            //! \throws file_error if the stream is not a TIFF file
+            //! \param stream input stream from which to read data
+            //! \return format of the file
+            //!
+            static file_format read(std::istream &stream);
+
+            //-----------------------------------------------------------------
+            //! true if data is stored as little endian
+            bool little_endian() const { return _little_endian; }
+
+            //-----------------------------------------------------------------
+            //! true for BigTIFF files
+            bool big_tiff() const { return _big_tiff; }
+
+            //-----------------------------------------------------------------
+            //! true if the byte order differs from the one of the host
+            bool swap() const { return _little_endian != host_is_little_endian(); }
+
+            //-----------------------------------------------------------------
+            //! size of an offset (and of the value field of an IFD entry)
+            size_t offset_size() const { return _big_tiff ? 8 : 4; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief decode a value from memory
+            //!
+            //! \tparam T integer or floating point type of the value
+            //! \param data pointer to the first byte of the value
+            //! \return value in host byte order
+            //!
+            template<typename T> T value(const char *data) const
+            {
+                T v;
+                std::memcpy(&v,data,sizeof(T));
+                return swap() ? swap_value(v) : v;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a value from a stream
+            //!
+            //! \tparam T integer or floating point type of the value
+            //! \param stream input stream from which to read data
+            //! \return value in host byte order
+            //!
+            template<typename T> T read(std::istream &stream) const
+            {
+                char buffer[sizeof(T)] = {0};
+                stream.read(buffer,sizeof(T));
+                return value<T>(buffer);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read an offset
+            //!
+            //! \param stream input stream from which to read data
+            //! \return offset with 32 or 64 Bit according to the format
+            //!
+            pni::core::uint64 read_offset(std::istream &stream) const
+            {
+                if(_big_tiff) return read<pni::core::uint64>(stream);
+                return read<pni::core::uint32>(stream);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief decode an offset from memory
+            //!
+            //! \param data pointer to the first byte of the offset
+            //! \return offset with 32 or 64 Bit according to the format
+            //!
+            pni::core::uint64 offset(const char *data) const
+            {
+                if(_big_tiff) return value<pni::core::uint64>(data);
+                return value<pni::core::uint32>(data);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read the number of entries of an IFD
+            //!
+            //! \param stream input stream from which to read data
+            //! \return number of IFD entries
+            //!
+            pni::core::uint64 read_ifd_size(std::istream &stream) const
+            {
+                if(_big_tiff) return read<pni::core::uint64>(stream);
+                return read<pni::core::uint16>(stream);
+            }
+
+            //-----------------------------------------------------------------
+            //! output operator
+            friend PNIIO_EXPORT std::ostream &operator<<(std::ostream &o,
+                                                         const file_format &f);
+    };
+
+//end of namespace
+}
+}
+}
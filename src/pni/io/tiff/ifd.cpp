@@ -22,6 +22,8 @@
 //
 //
 
+#include <algorithm>
+#include <pni/core/error.hpp>
 #include <pni/io/tiff/ifd.hpp>
 #include <pni/io/tiff/ifd_entry.hpp>
 
@@ -41,19 +43,24 @@ namespace tiff{
     //-------------------------------------------------------------------------
     //implementation of the copy constructor
     ifd::ifd(const ifd &ifd):
-        _entries(ifd._entries)
+        _entries(ifd._entries),
+        _format(ifd._format),
+        _values(ifd._values)
     { }
 
     //-------------------------------------------------------------------------
     //implementation fo the move constructor
     ifd::ifd(ifd &&ifd):
-        _entries(std::move(ifd._entries))
+        _entries(std::move(ifd._entries)),
+        _format(ifd._format),
+        _values(std::move(ifd._values))
     {}
 
     //-------------------------------------------------------------------------
     //implementation of the standard constructor
-    ifd::ifd(size_t size):
-        _entries(size)
+    ifd::ifd(size_t size,const file_format &format):
+        _entries(size),
+        _format(format)
     { }
 
     //------------------------------------------------------------------------------
@@ -68,7 +75,11 @@ namespace tiff{
     ifd &ifd::operator=(const ifd &o)
     {
         if(this != &o)
+        {
             _entries = o._entries;
+            _format = o._format;
+            _values = o._values;
+        }
 
         return *this;
     }
@@ -77,10 +88,87 @@ namespace tiff{
     //implementation of the move assignment operator
     ifd &ifd::operator=(ifd &&o)
     {
-        if(this != &o) _entries = std::move(o._entries);
+        if(this != &o) 
+        {
+            _entries = std::move(o._entries);
+            _format = o._format;
+            _values = std::move(o._values);
+        }
         return *this;
     }
 
+    //==================implementation of static methods=======================
+    ifd ifd::read(std::ifstream &stream,const file_format &format)
+    {
+        //data of different entries is read with a single call if there are
+        //less than max_gap bytes between them - entries with more than 
+        //max_size bytes are not loaded
+        static const uint64 max_gap  = 4096;
+        static const uint64 max_size = 16*1024*1024;
+
+        ifd image_dir(format.read_ifd_size(stream),format);
+        size_t entry_size = 4+2*format.offset_size();
+
+        //read the entry table
+        std::streampos table_pos = stream.tellg();
+        std::vector<char> table(image_dir.size()*entry_size);
+        stream.read(table.data(),table.size());
+        if(!stream) return image_dir;
+
+        //offsets of the data which does not fit into the value fields
+        std::vector<std::pair<uint64,size_t> > data_offsets;
+        for(size_t i=0;i<image_dir.size();++i)
+        {
+            const char *record = table.data()+i*entry_size;
+            std::streamoff value_offset = i*entry_size+4+format.offset_size();
+            ifd_entry &entry = image_dir._entries[i];
+            entry = ifd_entry::create_from_memory(record,table_pos+value_offset,
+                                                  format);
+            if(!entry.is_loaded() && entry.data_size()<=max_size)
+                data_offsets.push_back(std::make_pair(
+                            format.offset(record+4+format.offset_size()),i));
+        }
+
+        //read blocks of adjacent data 
+        std::sort(data_offsets.begin(),data_offsets.end());
+        std::vector<char> block;
+        for(size_t first=0;first<data_offsets.size();)
+        {
+            uint64 begin = data_offsets[first].first;
+            uint64 end   = begin;
+            size_t last  = first;
+            for(;last<data_offsets.size();++last)
+            {
+                const auto &d = data_offsets[last];
+                if(last!=first && d.first>end+max_gap) break;
+                end = std::max(end,
+                               d.first+image_dir._entries[d.second].data_size());
+            }
+
+            block.resize(end-begin);
+            stream.seekg(begin,std::ios::beg);
+            stream.read(block.data(),block.size());
+            if(!stream) return image_dir;
+
+            for(;first<last;++first)
+            {
+                const auto &d = data_offsets[first];
+                image_dir._entries[d.second].load(block.data()+(d.first-begin));
+            }
+        }
+
+        return image_dir;
+    }
+
+    //===============implementation of private member methods==================
+    const ifd_entry *ifd::_find(const string &n) const
+    {
+        for(const auto &entry: _entries)
+            if(entry.name() == n) return &entry;
+
+        return nullptr;
+    }
+
     //===============implementation of public member methods===================
     //implementation of the index access operator 
     ifd_entry ifd::operator[](const size_t i) const
@@ -92,19 +180,48 @@ namespace tiff{
     ifd_entry ifd::operator[](const string &n) const
     {
         using namespace pni::core;
-        for(auto entry: *this)
-        {
-            if(entry.name() == n) return entry;
-        }
+        if(const ifd_entry *entry = _find(n)) return *entry;
 
         throw key_error(EXCEPTION_RECORD,"IFD entry key ["+n+"] not found in IFD!");
     }
 
+    //------------------------------------------------------------------------------
+    bool ifd::has(const string &n) const
+    {
+        return _find(n) != nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    const std::vector<size_t> &ifd::values(std::ifstream &stream,
+                                           const string &n) const
+    {
+        using namespace pni::core;
+        auto iter = _values.find(n);
+        if(iter != _values.end()) return iter->second;
+
+        const ifd_entry *entry = _find(n);
+        if(!entry)
+            throw key_error(EXCEPTION_RECORD,"IFD entry key ["+n+"] not found "
+                    "in IFD!");
+
+        return _values[n] = entry->value<size_t>(stream);
+    }
+
+    //------------------------------------------------------------------------------
+    size_t ifd::value(std::ifstream &stream,const string &n,
+                      size_t default_value) const
+    {
+        if(!_values.count(n) && !has(n)) return default_value;
+
+        const auto &v = values(stream,n);
+        return v.empty() ? default_value : v[0];
+    }
+
     //==================implementation of friend operators=====================
     std::ostream &operator<<(std::ostream &o,const ifd &image_dir)
     {
         o<<"IFD content ("<<image_dir.size()<<" entries):"<<std::endl;
-        for(auto entry: image_dir)
+        for(const auto &entry: image_dir)
         {
             o<<entry<<std::endl;
         }
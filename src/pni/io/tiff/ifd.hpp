@@ -23,6 +23,7 @@
 //
 #pragma once
 
+#include <map>
 #include <memory>
 #include <vector>
 #include <fstream>
@@ -30,6 +31,7 @@
 
 #include <pni/core/types.hpp>
 
+#include <pni/io/tiff/file_format.hpp>
 #include <pni/io/tiff/ifd_entry.hpp>
 
 namespace pni{
@@ -54,10 +56,22 @@ namespace tiff{
     //! The IFD class behaves like a C++ container providing iterators to 
     //! run over all entries stored in the IFD.  
     //!
+    //! An IFD created with read() holds the data of all its entries. 
+    //! Integer values obtained with values() are decoded once and cached, 
+    //! thus repeated access to the strip offsets or the image size does 
+    //! neither read from the file nor decode data again. The cache is not 
+    //! protected against concurrent access.
+    //!
     class ifd 
     {
         protected:
             std::vector<ifd_entry> _entries; //!< list of IFD entries
+            file_format _format; //!< byte order and offset size of the file
+            //! integer values decoded so far
+            mutable std::map<pni::core::string,std::vector<size_t> > _values;
+
+            //! get an entry by name or nullptr if it does not exist
+            const ifd_entry *_find(const pni::core::string &n) const;
         public:
             //===============public data types=================================
             //some data types that can be useful for IFDs
@@ -85,8 +99,9 @@ namespace tiff{
             //! read the offset and proceed with the next IFD.
             //!
             //! \param size number of elements in the entry
+            //! \param format byte order and offset size of the file
             //!
-            explicit ifd(size_t size);
+            explicit ifd(size_t size,const file_format &format = file_format());
 
             //-----------------------------------------------------------------
             //! move constructor
@@ -96,6 +111,23 @@ namespace tiff{
             //! destructor
             ~ifd();
 
+            //===================static methods================================
+            //!
+            //! \brief read an IFD 
+            //!
+            //! Reads the entry table of the IFD with a single call. The data
+            //! of entries which does not fit into their value field is read
+            //! in blocks of adjacent data, usually one block for the entire
+            //! IFD, and stored with the entries. Errors are reported by the 
+            //! state of the stream. 
+            //!
+            //! \param stream input stream pointing to the number of entries
+            //! \param format byte order and offset size of the file
+            //! \return IFD with loaded entries
+            //!
+            static ifd read(std::ifstream &stream,
+                            const file_format &format = file_format());
+
             //===================assignment operator===========================
             //! copy assignment operator
             ifd &operator = (const ifd &o);
@@ -113,6 +145,14 @@ namespace tiff{
             //!
             size_t size() const { return _entries.size(); }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get the file format
+            //!
+            //! \return byte order and offset size of the file
+            //!
+            const file_format &format() const { return _format; }
+
             //-----------------------------------------------------------------
             //!
             //! \brief operator to obtain an entry by index
@@ -140,6 +180,47 @@ namespace tiff{
             //!
             ifd_entry operator[](const pni::core::string &n) const;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check for an entry
+            //!
+            //! \param n name of the entry
+            //! \return true if the IFD holds an entry of this name
+            //!
+            bool has(const pni::core::string &n) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get integer values of an entry
+            //!
+            //! The values are decoded on first access and cached. The 
+            //! reference stays valid as long as the IFD exists.
+            //!
+            //! \throws key_error if the entry does not exist
+            //! \throws type_error if the entry is not an integer entry
+            //! \param stream input stream from which to read data if the 
+            //! entry is not loaded
+            //! \param n name of the entry
+            //! \return values of the entry
+            //!
+            const std::vector<size_t> &values(std::ifstream &stream,
+                                              const pni::core::string &n) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read an optional entry
+            //!
+            //! Returns the first value of an entry with a single integer 
+            //! value, for instance Compression or RowsPerStrip. 
+            //!
+            //! \param stream input stream from which to read data
+            //! \param n name of the entry
+            //! \param default_value value if the entry does not exist
+            //! \return value of the entry or the default value
+            //!
+            size_t value(std::ifstream &stream,const pni::core::string &n,
+                         size_t default_value) const;
+
             //-----------------------------------------------------------------
             //!
             //! \brief get first iterator
@@ -0,0 +1,110 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <pni/io/tiff/ifd_cache.hpp>
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //================implementation of constructors and destructor============
+    ifd_cache::ifd_cache(size_t capacity):
+        _capacity(capacity)
+    { }
+
+    //-------------------------------------------------------------------------
+    //list iterators stay valid when the list is moved
+    ifd_cache::ifd_cache(ifd_cache &&c):
+        _capacity(c._capacity),
+        _items(std::move(c._items)),
+        _index(std::move(c._index))
+    {
+        c._items.clear();
+        c._index.clear();
+    }
+
+    //====================implementation of assignment operators===============
+    ifd_cache &ifd_cache::operator=(ifd_cache &&c)
+    {
+        if(this == &c) return *this;
+
+        _capacity = c._capacity;
+        _items = std::move(c._items);
+        _index = std::move(c._index);
+        c._items.clear();
+        c._index.clear();
+        return *this;
+    }
+
+    //=====================implementation of private methods===================
+    void ifd_cache::_shrink()
+    {
+        if(!_capacity) return;
+
+        while(_items.size()>_capacity)
+        {
+            _index.erase(_items.back().first);
+            _items.pop_back();
+        }
+    }
+
+    //=====================implementation of public methods====================
+    void ifd_cache::capacity(size_t n)
+    {
+        _capacity = n;
+        _shrink();
+    }
+
+    //-------------------------------------------------------------------------
+    const ifd *ifd_cache::find(size_t i)
+    {
+        auto iter = _index.find(i);
+        if(iter == _index.end()) return nullptr;
+
+        //move the IFD to the front - splicing keeps all iterators valid
+        _items.splice(_items.begin(),_items,iter->second);
+        return &iter->second->second;
+    }
+
+    //-------------------------------------------------------------------------
+    const ifd &ifd_cache::insert(size_t i,ifd &&image_dir)
+    {
+        if(const ifd *cached = find(i)) return *cached;
+
+        _items.emplace_front(i,std::move(image_dir));
+        _index[i] = _items.begin();
+        _shrink();
+        return _items.front().second;
+    }
+
+    //-------------------------------------------------------------------------
+    void ifd_cache::clear()
+    {
+        _items.clear();
+        _index.clear();
+    }
+
+//end of namespace
+}
+}
+}
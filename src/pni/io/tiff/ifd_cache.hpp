@@ -0,0 +1,141 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include <pni/io/tiff/ifd.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief LRU cache for parsed IFDs
+    //!
+    //! Holds the IFDs of a file which have already been parsed, indexed by
+    //! the number of the image. Once the cache is full the least recently
+    //! used IFD is dropped when a new one is inserted.
+    //!
+    //! A reference returned by find() or insert() stays valid until the
+    //! IFD is dropped from the cache, thus at least until the next insert.
+    //!
+    class PNIIO_EXPORT ifd_cache
+    {
+        private:
+            //! IFDs in the order of their use - most recent first
+            typedef std::list<std::pair<size_t,ifd> > list_type;
+
+            size_t _capacity; //!< maximum number of IFDs, 0 for unlimited
+#ifdef _MSC_VER
+#pragma warning(disable:4251)
+#endif
+            list_type _items; //!< cached IFDs
+            //! position of an IFD in the list
+            std::unordered_map<size_t,list_type::iterator> _index;
+#ifdef _MSC_VER
+#pragma warning(default:4251)
+#endif
+
+            //! drop the least recently used IFDs exceeding the capacity
+            void _shrink();
+
+        public:
+            //================constructors and destructor======================
+            //!
+            //! \brief constructor
+            //!
+            //! \param capacity maximum number of IFDs, 0 for no limit
+            //!
+            explicit ifd_cache(size_t capacity=0);
+
+            //-----------------------------------------------------------------
+            //! copy constructor - deleted
+            ifd_cache(const ifd_cache &c) = delete;
+
+            //-----------------------------------------------------------------
+            //! move constructor
+            ifd_cache(ifd_cache &&c);
+
+            //================assignment operators=============================
+            //! copy assignment - deleted
+            ifd_cache &operator=(const ifd_cache &c) = delete;
+
+            //-----------------------------------------------------------------
+            //! move assignment
+            ifd_cache &operator=(ifd_cache &&c);
+
+            //=================public member functions=========================
+            //! get the maximum number of IFDs
+            size_t capacity() const { return _capacity; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief set the maximum number of IFDs
+            //!
+            //! If the cache holds more IFDs the least recently used ones are
+            //! dropped.
+            //!
+            //! \param n maximum number of IFDs, 0 for no limit
+            //!
+            void capacity(size_t n);
+
+            //-----------------------------------------------------------------
+            //! get the number of cached IFDs
+            size_t size() const { return _items.size(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief look up an IFD
+            //!
+            //! If the IFD is in the cache it becomes the most recently used
+            //! one.
+            //!
+            //! \param i number of the image
+            //! \return pointer to the IFD or nullptr if it is not cached
+            //!
+            const ifd *find(size_t i);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief insert an IFD
+            //!
+            //! \param i number of the image
+            //! \param image_dir the parsed IFD
+            //! \return reference to the cached IFD
+            //!
+            const ifd &insert(size_t i,ifd &&image_dir);
+
+            //-----------------------------------------------------------------
+            //! remove all IFDs
+            void clear();
+    };
+
+//end of namespace
+}
+}
+}
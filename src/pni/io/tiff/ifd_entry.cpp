@@ -73,7 +73,11 @@ namespace tiff{
                                {9,ifd_entry_type_id::SLONG},
                                {10,ifd_entry_type_id::SRATIONAL},
                                {11,ifd_entry_type_id::FLOAT},
-                               {12,ifd_entry_type_id::DOUBLE}};
+                               {12,ifd_entry_type_id::DOUBLE},
+                               {13,ifd_entry_type_id::IFD},
+                               {16,ifd_entry_type_id::LONG8},
+                               {17,ifd_entry_type_id::SLONG8},
+                               {18,ifd_entry_type_id::IFD8}};
 
     //map object associating IDFEntryTypeIds to PNI TypeIDs
     std::map<ifd_entry_type_id,type_id_t> entry_type_to_type_id = 
@@ -88,7 +92,11 @@ namespace tiff{
                           {ifd_entry_type_id::SLONG,pni::core::type_id_t::INT32},
                           {ifd_entry_type_id::SRATIONAL,pni::core::type_id_t::FLOAT64},
                           {ifd_entry_type_id::FLOAT,pni::core::type_id_t::FLOAT32},
-                          {ifd_entry_type_id::DOUBLE,pni::core::type_id_t::FLOAT64}};
+                          {ifd_entry_type_id::DOUBLE,pni::core::type_id_t::FLOAT64},
+                          {ifd_entry_type_id::IFD,pni::core::type_id_t::UINT32},
+                          {ifd_entry_type_id::LONG8,pni::core::type_id_t::UINT64},
+                          {ifd_entry_type_id::SLONG8,pni::core::type_id_t::INT64},
+                          {ifd_entry_type_id::IFD8,pni::core::type_id_t::UINT64}};
 
 
     //==================constructors and destructor========================
@@ -97,7 +105,8 @@ namespace tiff{
         _tag(0),
         _tid(ifd_entry_type_id::UNDEFINED),
         _size(0),
-        _data(0)
+        _data(0),
+        _loaded(false)
     {}
 
     //---------------------------------------------------------------------
@@ -106,7 +115,10 @@ namespace tiff{
         _tag(e._tag),
         _tid(e._tid),
         _size(e._size),
-        _data(e._data)
+        _data(e._data),
+        _format(e._format),
+        _loaded(e._loaded),
+        _values(e._values)
     {}
 
     //---------------------------------------------------------------------
@@ -115,17 +127,22 @@ namespace tiff{
         _tag(std::move(e._tag)),
         _tid(std::move(e._tid)),
         _size(std::move(e._size)),
-        _data(std::move(e._data))
+        _data(std::move(e._data)),
+        _format(e._format),
+        _loaded(e._loaded),
+        _values(std::move(e._values))
     {}
 
     //---------------------------------------------------------------------
     //implementation of the standard constructor
     ifd_entry::ifd_entry(pni::core::uint16 tag,ifd_entry_type_id tid,size_t size, 
-                      std::streampos data):
+                      std::streampos data,const file_format &format):
         _tag(tag),
         _tid(tid),
         _size(size),
-        _data(data)
+        _data(data),
+        _format(format),
+        _loaded(false)
     { }
 
     //---------------------------------------------------------------------
@@ -143,6 +160,9 @@ namespace tiff{
         _tid = e._tid;
         _size = e._size;
         _data = e._data;
+        _format = e._format;
+        _loaded = e._loaded;
+        _values = e._values;
         return *this;
     }
 
@@ -155,28 +175,48 @@ namespace tiff{
         _tid = std::move(e._tid);
         _size = std::move(e._size);
         _data = std::move(e._data);
+        _format = e._format;
+        _loaded = e._loaded;
+        _values = std::move(e._values);
         return *this;
     }
 
     //===========implementation of static methods==========================
-    ifd_entry ifd_entry::create_from_stream(std::ifstream &stream)
+    ifd_entry ifd_entry::create_from_stream(std::ifstream &stream,
+                                            const file_format &format)
     {
-        pni::core::uint16 tag = 0;
-        stream.read(reinterpret_cast<char*>(&tag),2);
-        
-        pni::core::uint16 tid = 0;
-        stream.read(reinterpret_cast<char*>(&tid),2);
+        pni::core::uint16 tag = format.read<pni::core::uint16>(stream);
+        pni::core::uint16 tid = format.read<pni::core::uint16>(stream);
+
+        //the number of values has the size of an offset
+        size_t count = format.read_offset(stream);
 
-        pni::core::uint32 count = 0;
-        stream.read(reinterpret_cast<char*>(&count),4);
+        ifd_entry e(tag,type_tag_to_entry_type_id[tid],count,stream.tellg(),
+                    format);
 
-        ifd_entry e(tag,type_tag_to_entry_type_id[tid],count,stream.tellg());
-        //add additional for byte 
-        stream.seekg(4,std::ios::cur);
+        //read the value field - data which fits into it is loaded
+        char value[8];
+        stream.read(value,format.offset_size());
+        if(stream && e.data_size()<=format.offset_size()) e.load(value);
         return e;
     
     }
 
+    //-------------------------------------------------------------------------
+    ifd_entry ifd_entry::create_from_memory(const char *data,
+                                            std::streampos value_pos,
+                                            const file_format &format)
+    {
+        pni::core::uint16 tag = format.value<pni::core::uint16>(data);
+        pni::core::uint16 tid = format.value<pni::core::uint16>(data+2);
+        size_t count = format.offset(data+4);
+
+        ifd_entry e(tag,type_tag_to_entry_type_id[tid],count,value_pos,format);
+        if(e.data_size()<=format.offset_size()) 
+            e.load(data+4+format.offset_size());
+        return e;
+    }
+
     //=======================class methods=================================
     //implementation of nelements
     size_t ifd_entry::size() const
@@ -200,15 +240,63 @@ namespace tiff{
         return entry_type_to_type_id[_tid];
     }
 
+    //-----------------------------------------------------------------------
+    size_t ifd_entry::data_size() const
+    {
+        switch(_tid)
+        {
+            case ifd_entry_type_id::SHORT:
+            case ifd_entry_type_id::SSHORT:    return 2*_size;
+            case ifd_entry_type_id::LONG:
+            case ifd_entry_type_id::SLONG:
+            case ifd_entry_type_id::FLOAT:
+            case ifd_entry_type_id::IFD:       return 4*_size;
+            case ifd_entry_type_id::RATIONAL:
+            case ifd_entry_type_id::SRATIONAL:
+            case ifd_entry_type_id::DOUBLE:
+            case ifd_entry_type_id::LONG8:
+            case ifd_entry_type_id::SLONG8:
+            case ifd_entry_type_id::IFD8:      return 8*_size;
+            default:                           return _size;
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    void ifd_entry::load(const char *data)
+    {
+        _values.assign(data,data+data_size());
+        _loaded = true;
+    }
+
+    //-----------------------------------------------------------------------
+    void ifd_entry::_read_values(std::ifstream &stream,
+                                 std::vector<char> &buffer) const
+    {
+        //save the original stream position
+        std::streampos orig_stream_pos = stream.tellg();
+
+        //if the data does not fit into the value field it holds the offset
+        //of the data
+        buffer.resize(data_size());
+        stream.seekg(_data,std::ios::beg);
+        if(buffer.size()>_format.offset_size())
+            stream.seekg(_format.read_offset(stream),std::ios::beg);
+
+        stream.read(buffer.data(),buffer.size());
+
+        //reset stream to its original position
+        stream.seekg(orig_stream_pos,std::ios::beg);
+    }
+
     //-----------------------------------------------------------------------
     void ifd_entry::_read_entry_data(std::vector<pni::core::string> &r,
-                                     std::ifstream &stream)
+                                     const char *data) const
     {
         using namespace pni::core;
         //now we have to walk through all types available in TIFF - not very
         //nice but we have no other choice at runtime
         if(this->_tid == ifd_entry_type_id::ASCII)
-            ifd_entry_reader<string,string>::read(r,stream);
+            ifd_entry_reader<string,string>::decode(r,data,_format);
         else
             throw type_error(EXCEPTION_RECORD,
             "IFD entry is of unknown or incompatible type!");
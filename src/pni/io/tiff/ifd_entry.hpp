@@ -26,10 +26,12 @@
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <vector>
 #include <boost/current_function.hpp>
 
 #include <pni/core/types.hpp>
 #include <pni/core/error.hpp>
+#include <pni/io/tiff/file_format.hpp>
 #include <pni/io/tiff/rational.hpp>
 #include <pni/io/tiff/ifd_entry_reader.hpp>
 
@@ -51,7 +53,11 @@ namespace tiff{
         SLONG,     //!< 32Bit signed integer
         SRATIONAL, //!< like RATIONAL but signed
         FLOAT,     //!< 4Byte IEEE float
-        DOUBLE     //!< 8Byte IEEE float
+        DOUBLE,    //!< 8Byte IEEE float
+        IFD,       //!< 32Bit offset of an IFD
+        LONG8,     //!< 64Bit unsigned integer (BigTIFF)
+        SLONG8,    //!< 64Bit signed integer (BigTIFF)
+        IFD8       //!< 64Bit offset of an IFD (BigTIFF)
     };
 
 #ifdef ENUMBUG
@@ -67,6 +73,11 @@ namespace tiff{
     //!
     //! This class can manage the content of a single IFDEntry. 
     //!
+    //! The data of an entry is either read from the stream whenever its 
+    //! value is requested or, once the entry is loaded, decoded from a copy 
+    //! of the data held by the entry. Values which fit into the value 
+    //! field of the entry are always loaded.
+    //!
     class ifd_entry
     {
         private:
@@ -74,36 +85,47 @@ namespace tiff{
             ifd_entry_type_id _tid;   //!< type id of the entry
             size_t _size;          //!< number of elements of the entry
             std::streampos _data;  //!< marks data position
+            file_format _format;   //!< byte order and offset size
+            bool _loaded;          //!< true if the data is held in _values
+            std::vector<char> _values; //!< data as stored in the file
 
             //===============private methods===================================
             //!
-            //! \brief read entry data from stream
+            //! \brief decode entry data
             //!
-            //! Reads the entrys data from an input stream. This method 
-            //! assumes that the input stream points to the first element of 
-            //! the entry. The position of the stream is altered. It is the 
-            //! responsibility of the calling method to take care about the 
-            //! position of the stream.
+            //! Decodes the data of the entry from memory. The conversion 
+            //! from the entry type to T is selected at runtime.
             //!
+            //! \throws type_error if the entry type cannot be converted to T
             //! \param r vector where to store the data
-            //! \param stream input stream from which to read
+            //! \param data pointer to the data as stored in the file
             //! 
             template<typename T> 
-            void _read_entry_data(std::vector<T> &r,std::ifstream &stream);
+            void _read_entry_data(std::vector<T> &r,const char *data) const;
 
             //----------------------------------------------------------------
             //!
-            //! \brief read string entry from stream
-            //!
-            //! Reads a string entry from the stream. The stream position 
-            //! will be altered by this method. Thus the calling method must 
-            //! take care about this.
+            //! \brief decode string entry
             //!
+            //! \throws type_error if the entry is not of type ASCII
             //! \param r vector where to store data
-            //! \param stream input stream from which to read
+            //! \param data pointer to the data as stored in the file
             //!
             void _read_entry_data(std::vector<pni::core::string> &r,
-                                  std::ifstream &stream);
+                                  const char *data) const;
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief read entry data from the stream
+            //!
+            //! Reads the data of an entry which is not loaded. The position 
+            //! of the stream is restored afterwards.
+            //!
+            //! \param stream input stream from which to read
+            //! \param buffer buffer for the data
+            //!
+            void _read_values(std::ifstream &stream,
+                              std::vector<char> &buffer) const;
             
         public:
             //=============constructors and destructor=========================
@@ -128,9 +150,11 @@ namespace tiff{
             //! \param tid type ID of the entry
             //! \param size number of elements stored in this entry
             //! \param data starting position of data in the stream
+            //! \param format byte order and offset size of the file
             //!
             ifd_entry(pni::core::uint16 tag,ifd_entry_type_id tid,size_t size,
-                      std::streampos data);
+                      std::streampos data,
+                      const file_format &format = file_format());
 
             //-----------------------------------------------------------------
             //! destructor
@@ -151,11 +175,34 @@ namespace tiff{
             //! from a stream.
             //!
             //! \param stream input stream from which to read data
+            //! \param format byte order and offset size of the file
+            //! \return instance of IFDEntry
+            //!
+            static ifd_entry create_from_stream(std::ifstream &stream,
+                                    const file_format &format = file_format());
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create entry from memory
+            //!
+            //! Creates an entry from its record in the entry table of an 
+            //! IFD. If the data fits into the value field the entry is 
+            //! loaded.
+            //!
+            //! \param data pointer to the record of the entry
+            //! \param value_pos position of the value field in the file
+            //! \param format byte order and offset size of the file
             //! \return instance of IFDEntry
             //!
-            static ifd_entry create_from_stream(std::ifstream &stream);
+            static ifd_entry create_from_memory(const char *data,
+                                                std::streampos value_pos,
+                                    const file_format &format = file_format());
 
             //==================class methods==================================
+            //! get the TIFF tag of the entry
+            pni::core::uint16 tag() const { return _tag; }
+
+            //-----------------------------------------------------------------
             //!
             //! \brief number of elements
             //!
@@ -182,6 +229,33 @@ namespace tiff{
             //!
             pni::core::type_id_t type_id() const;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief size of the data
+            //!
+            //! \return number of bytes occupied by the data in the file
+            //!
+            size_t data_size() const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check if the data is loaded
+            //!
+            //! \return true if values are decoded without reading the stream
+            //!
+            bool is_loaded() const { return _loaded; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief load the data
+            //!
+            //! Stores a copy of the data of the entry. Afterwards value() 
+            //! does not access the stream anymore.
+            //!
+            //! \param data pointer to data_size() bytes as stored in the file
+            //!
+            void load(const char *data);
+
             //-----------------------------------------------------------------
             //!
             //! \brief get entry value
@@ -192,11 +266,13 @@ namespace tiff{
             //! represent each entry.
             //!
             //! The method makes no assumption about the position of the stream
-            //! pointer neither does it alter its state. 
+            //! pointer neither does it alter its state. If the entry is 
+            //! loaded the stream is not used at all.
             //! \param stream input stream from which data will be read
             //! \return entry as vector
             //!
-            template<typename T> std::vector<T> value(std::ifstream &stream);
+            template<typename T> 
+            std::vector<T> value(std::ifstream &stream) const;
 
             //-----------------------------------------------------------------
             //! output operator
@@ -206,17 +282,22 @@ namespace tiff{
 
 
     //==============implementation of public template methods===================
-    template<typename T> std::vector<T> ifd_entry::value(std::ifstream &stream)
+    template<typename T> 
+    std::vector<T> ifd_entry::value(std::ifstream &stream) const
     {
         using namespace pni::core;
 
         //create a vector of appropriate length
         std::vector<T> result(this->size());
-        //save the original stream position
-        std::streampos orig_stream_pos = stream.tellg();
 
-        //set the stream to the begining of the data section
-        stream.seekg(this->_data,std::ios::beg);
+        //get the data from the stream if it is not loaded
+        std::vector<char> buffer;
+        const char *data = _values.data();
+        if(!_loaded)
+        {
+            _read_values(stream,buffer);
+            data = buffer.data();
+        }
 
         //here comes the tricky part. Though the user defines the type T he
         //wants to have the IFD entry not all entry types can be converted to T
@@ -227,49 +308,50 @@ namespace tiff{
         //This operation is carried out by the next function which cann choose
         //the proper version by argument type deduction.
         try{
-            this->_read_entry_data(result,stream);
+            this->_read_entry_data(result,data);
         }
         catch(type_error &e)
         {
             e.append(EXCEPTION_RECORD);
-            //reset the stream to its original position
-            stream.seekg(orig_stream_pos,std::ios::beg);
             throw e;
         }
-            
-       
-        //reset stream to its original position
-        stream.seekg(orig_stream_pos,std::ios::beg);
 
         return result;
     }
 
     //--------------------------------------------------------------------------
     template<typename T> void ifd_entry:: 
-        _read_entry_data(std::vector<T> &r,std::ifstream &stream)
+        _read_entry_data(std::vector<T> &r,const char *data) const
     {
         using namespace pni::core;
 
+        const file_format &f = this->_format;
         if(this->_tid == ifd_entry_type_id::BYTE) 
-            ifd_entry_reader<T,uint8>::read(r,stream);
+            ifd_entry_reader<T,uint8>::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::SHORT)
-            ifd_entry_reader<T,uint16>::read(r,stream);
-        else if(this->_tid == ifd_entry_type_id::LONG)
-            ifd_entry_reader<T,uint32>::read(r,stream);
+            ifd_entry_reader<T,uint16>::decode(r,data,f);
+        else if(this->_tid == ifd_entry_type_id::LONG ||
+                this->_tid == ifd_entry_type_id::IFD)
+            ifd_entry_reader<T,uint32>::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::RATIONAL)
-            ifd_entry_reader<T,rational<uint16> >::read(r,stream);
+            ifd_entry_reader<T,rational<uint32> >::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::SBYTE)
-            ifd_entry_reader<T,int8>::read(r,stream);
+            ifd_entry_reader<T,int8>::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::SSHORT)
-            ifd_entry_reader<T,int16>::read(r,stream);
+            ifd_entry_reader<T,int16>::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::SLONG)
-            ifd_entry_reader<T,int32>::read(r,stream);
+            ifd_entry_reader<T,int32>::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::SRATIONAL)
-            ifd_entry_reader<T,rational<int32> >::read(r,stream);
+            ifd_entry_reader<T,rational<int32> >::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::FLOAT)
-            ifd_entry_reader<T,float32>::read(r,stream);
+            ifd_entry_reader<T,float32>::decode(r,data,f);
         else if(this->_tid == ifd_entry_type_id::DOUBLE)
-            ifd_entry_reader<T,float64>::read(r,stream);
+            ifd_entry_reader<T,float64>::decode(r,data,f);
+        else if(this->_tid == ifd_entry_type_id::LONG8 ||
+                this->_tid == ifd_entry_type_id::IFD8)
+            ifd_entry_reader<T,uint64>::decode(r,data,f);
+        else if(this->_tid == ifd_entry_type_id::SLONG8)
+            ifd_entry_reader<T,int64>::decode(r,data,f);
         else
             //reset stream position
             throw type_error(EXCEPTION_RECORD,"IFD entry ["+this->name()+
@@ -30,36 +30,44 @@ namespace tiff{
 
     void
     ifd_entry_reader<pni::core::string,pni::core::string>::read(std::vector<pni::core::string> &r,
-                                          std::ifstream &stream)
+                                          std::ifstream &stream,
+                                          const file_format &format)
     {
         //in the special case of strings the size of the vector comming from the
-        //calling method is the number of bytes all strings stored occupy. We
-        //can use this and reset the vector as it will hold only entire string
+        //calling method is the number of bytes all strings stored occupy. 
+        //decode() resets the vector as it will hold only entire string
         //objects not individual characters.
         size_t size = r.size(); 
-        r.clear();
 
-        //check wether or not all the data fits into the first 4 Bytes
-        if (sizeof(char) * size > 4) 
+        //check wether or not all the data fits into the value field
+        if (sizeof(char) * size > format.offset_size()) 
         {
-            //if data does not fit we interpret the 4 Bytes as offset and jump
-            //to this position
-            pni::core::int32 offset = 0;
-            stream.read((char *) (&offset), 4);
-            stream.seekg(offset, std::ios::beg);
+            //if data does not fit we interpret the value field as offset and
+            //jump to this position
+            stream.seekg(format.read_offset(stream), std::ios::beg);
         }
 
-        //start reading data
-        std::vector<pni::core::string> result(0);
-        char buffer;
-        pni::core::string s;
+        //read the data with a single call
+        std::vector<char> buffer(size);
+        stream.read(buffer.data(),size);
+
+        decode(r,buffer.data(),format);
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    ifd_entry_reader<pni::core::string,pni::core::string>::decode(std::vector<pni::core::string> &r,
+                                          const char *data,
+                                          const file_format &)
+    {
+        //as for read the size of the vector is the number of bytes
+        size_t size = r.size();
+        r.clear();
 
+        pni::core::string s;
         for (size_t i = 0; i < size; i++) 
         {
-            //read a character from the stream
-            stream.read((char *) (&buffer), sizeof(char));
-
-            if (buffer == '\0') 
+            if (data[i] == '\0') 
             {
                 //if the end of a string was reached we store the string in the
                 //vector and reset the string object.
@@ -69,7 +77,7 @@ namespace tiff{
             else
             {
                 //add the character to the existing string
-                s += buffer;
+                s += data[i];
             }
         }
     }
@@ -28,12 +28,55 @@
 #include<vector>
 
 #include <pni/core/types.hpp>
+#include <pni/io/tiff/file_format.hpp>
+#include <pni/io/tiff/rational.hpp>
 
 
 namespace pni{
 namespace io{
 namespace tiff{
 
+    //!
+    //! \ingroup io_classes
+    //! \brief decode a single IFD entry element
+    //!
+    //! Provides the size of an element in the file and decodes it from 
+    //! memory using the byte order of the file.
+    //!
+    template<typename ETYPE> struct ifd_entry_element
+    {
+        //! size of the element in the file
+        static const size_t size = sizeof(ETYPE);
+
+        //! decode the element
+        static ETYPE decode(const char *data,const file_format &format)
+        {
+            return format.value<ETYPE>(data);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup io_classes
+    //! \brief decode a rational IFD entry element
+    //!
+    //! Rationals are stored as two integers each of which is stored in 
+    //! the byte order of the file.
+    //!
+    template<typename T> struct ifd_entry_element<rational<T> >
+    {
+        //! size of the element in the file
+        static const size_t size = 2*sizeof(T);
+
+        //! decode the element
+        static rational<T> decode(const char *data,const file_format &format)
+        {
+            return rational<T>(format.value<T>(data),
+                               format.value<T>(data+sizeof(T)));
+        }
+    };
+
+    //-------------------------------------------------------------------------
     //!
     //! \ingroup io_classes
     //! \brief IFD entry reader template
@@ -54,32 +97,61 @@ namespace tiff{
             //! done by the calling function or method.
             //! \param r number of elements to read
             //! \param stream input stream from which to read data
+            //! \param format byte order and offset size of the file
             //! \return vector of RTYPE values holding the result
             //!
-            static void read(std::vector<RTYPE> &r,std::ifstream &stream);
+            static void read(std::vector<RTYPE> &r,std::ifstream &stream,
+                             const file_format &format = file_format());
+
+            //!
+            //! \brief decode entry data
+            //!
+            //! Decodes r.size() elements from memory holding the data of 
+            //! the entry as it is stored in the file.
+            //!
+            //! \param r vector where to store the result
+            //! \param data pointer to the first element
+            //! \param format byte order and offset size of the file
+            //!
+            static void decode(std::vector<RTYPE> &r,const char *data,
+                               const file_format &format = file_format());
     };
 
     //-------------------------------------------------------------------------
     template<typename RTYPE,typename ETYPE> void ifd_entry_reader<RTYPE,ETYPE>::
-        read(std::vector<RTYPE> &r,std::ifstream &stream)
+        read(std::vector<RTYPE> &r,std::ifstream &stream,
+             const file_format &format)
     {
-
-        ETYPE buffer;
+        typedef ifd_entry_element<ETYPE> element_type;
 
         //check size of entire entry data
-        if(sizeof(ETYPE)*r.size()>4){
-            //if the data does not fit into 4 Byte we interpret data as an
-            //offset and move the stream pointer to this new position
-            pni::core::int32 offset;
-            stream.read((char *)(&offset),4);
-            stream.seekg(offset,std::ios::beg);
+        size_t size = element_type::size*r.size();
+        if(size>format.offset_size()){
+            //if the data does not fit into the value field we interpret 
+            //data as an offset and move the stream pointer to this new 
+            //position
+            stream.seekg(format.read_offset(stream),std::ios::beg);
         }
 
-        //read the data
+        //read the data with a single call
+        std::vector<char> buffer(size);
+        stream.read(buffer.data(),size);
+
+        decode(r,buffer.data(),format);
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename RTYPE,typename ETYPE> void ifd_entry_reader<RTYPE,ETYPE>::
+        decode(std::vector<RTYPE> &r,const char *data,
+               const file_format &format)
+    {
+        typedef ifd_entry_element<ETYPE> element_type;
+
+        const char *ptr = data;
         for(RTYPE &value: r)
         {
-            stream.read((char*)(&buffer),sizeof(ETYPE));
-            value = (RTYPE)(buffer);
+            value = (RTYPE)(element_type::decode(ptr,format));
+            ptr += element_type::size;
         }
 
     }
@@ -97,7 +169,13 @@ namespace tiff{
     {
         public:
             //! read string entry 
-            static void read(std::vector<pni::core::string> &r,std::ifstream &stream);
+            static void read(std::vector<pni::core::string> &r,std::ifstream &stream,
+                             const file_format &format = file_format());
+
+            //! decode string entry from memory
+            static void decode(std::vector<pni::core::string> &r,
+                               const char *data,
+                               const file_format &format = file_format());
     };
 
 
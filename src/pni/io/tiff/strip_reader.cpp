@@ -22,6 +22,8 @@
 //
 //
 
+#include <algorithm>
+#include <numeric>
 #include <pni/core/error.hpp>
 #include <pni/io/tiff/strip_reader.hpp>
 
@@ -40,7 +42,8 @@ namespace tiff {
         _offsets(o._offsets),
         _byte_cnts(o._byte_cnts),
         _bits_per_channel(o._bits_per_channel),
-        _channel_types(o._channel_types)
+        _channel_types(o._channel_types),
+        _decoder(o._decoder)
     { }
 
     //-------------------------------------------------------------------------
@@ -49,7 +52,8 @@ namespace tiff {
         _offsets(std::move(o._offsets)),
         _byte_cnts(std::move(o._byte_cnts)),
         _bits_per_channel(std::move(o._bits_per_channel)),
-        _channel_types(std::move(o._channel_types))
+        _channel_types(std::move(o._channel_types)),
+        _decoder(std::move(o._decoder))
     { }
 
     //------------------------------------------------------------------------
@@ -57,11 +61,13 @@ namespace tiff {
     strip_reader::strip_reader(const std::vector<size_t> &offsets,
                              const std::vector<size_t> &byte_counts,
                              const std::vector<size_t> &bits_per_channel,
-                             const std::vector<type_id_t> &channel_types):
+                             const std::vector<type_id_t> &channel_types,
+                             const strip_decoder &decoder):
         _offsets(offsets),
         _byte_cnts(byte_counts),
         _bits_per_channel(bits_per_channel),
-        _channel_types(channel_types)
+        _channel_types(channel_types),
+        _decoder(decoder)
     { }
 
     //-------------------------------------------------------------------------
@@ -79,6 +85,7 @@ namespace tiff {
         _byte_cnts = o._byte_cnts;
         _bits_per_channel = o._bits_per_channel;
         _channel_types = o._channel_types;
+        _decoder = o._decoder;
         return *this;
     }
 
@@ -92,6 +99,7 @@ namespace tiff {
         _byte_cnts = std::move(o._byte_cnts);
         _bits_per_channel = std::move(o._bits_per_channel);
         _channel_types = std::move(o._channel_types);
+        _decoder = std::move(o._decoder);
         return *this;
     }
 
@@ -99,13 +107,64 @@ namespace tiff {
     strip_reader strip_reader::create(std::ifstream &stream,const ifd &image_dir,
                                     const image_info &info)
     {
-       return strip_reader(image_dir["StripOffsets"].value<size_t>(stream),
-                           image_dir["StripByteCounts"].value<size_t>(stream),
-                           info.bits_per_channel(),
-                           info.types_per_channel());
+        size_t rows_per_strip = std::min(image_dir.value(stream,
+                                                         "RowsPerStrip",
+                                                         info.nx()),
+                                         info.nx());
+
+        return strip_reader(image_dir.values(stream,"StripOffsets"),
+                            image_dir.values(stream,"StripByteCounts"),
+                            info.bits_per_channel(),
+                            info.types_per_channel(),
+                            strip_decoder::create(stream,image_dir,info,
+                                                  info.ny(),rows_per_strip));
+    }
+
+
+    //-------------------------------------------------------------------------
+    size_t strip_reader::npixels() const
+    {
+        size_t pixel_size = std::accumulate(_bits_per_channel.begin(),
+                                            _bits_per_channel.end(),0)/8;
+        if(_decoder.is_active())
+            return _offsets.size()*(_decoder.strip_size()/pixel_size);
+
+        size_t n = 0;
+        for(auto count: _byte_cnts) n += count/pixel_size;
+        return n;
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<strip_reader> strip_reader::split(size_t n) const
+    {
+        n = std::max<size_t>(std::min(n,_offsets.size()),1);
+
+        size_t total = std::accumulate(_byte_cnts.begin(),_byte_cnts.end(),
+                                       size_t(0));
+        std::vector<strip_reader> groups;
+        size_t first = 0,bytes = 0;
+        for(size_t group=0;group<n;++group)
+        {
+            //take strips until the group holds its share of the data
+            size_t limit = total*(group+1)/n;
+            size_t last  = first;
+            while(last<_offsets.size() && 
+                  (bytes+_byte_cnts[last]<=limit || last==first || 
+                   group+1==n))
+                bytes += _byte_cnts[last++];
+
+            if(last == first) break;
+            groups.push_back(strip_reader(
+                    std::vector<size_t>(_offsets.begin()+first,
+                                        _offsets.begin()+last),
+                    std::vector<size_t>(_byte_cnts.begin()+first,
+                                        _byte_cnts.begin()+last),
+                    _bits_per_channel,_channel_types,_decoder));
+            first = last;
+        }
+        return groups;
     }
 
-   
     //-------------------------------------------------------------------------
     //output operator
     std::ostream &operator<<(std::ostream &o,const strip_reader &r)
@@ -116,6 +175,8 @@ namespace tiff {
             o<<" with "<<r._bits_per_channel[i]<<" bits"<<std::endl;
         }
 
+        o<<"Compression: "<<r._decoder.compression_scheme();
+        o<<" (predictor: "<<r._decoder.prediction()<<")"<<std::endl;
         o<<"Total number of strip: "<<r._offsets.size()<<std::endl;
         for(size_t i=0;i<r._offsets.size();i++)
         {
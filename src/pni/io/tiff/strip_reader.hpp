@@ -23,11 +23,15 @@
 //
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <numeric>
 #include <vector>
 
 #include <pni/io/tiff/ifd.hpp>
+#include <pni/io/tiff/compression.hpp>
 #include <pni/io/image_info.hpp>
 
 #include <pni/core/types.hpp>
@@ -40,6 +44,92 @@ namespace pni {
 namespace io {
 namespace tiff {    
 
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief contiguous range of a container
+    //!
+    //! Provides the container interface used by strip_reader for a part of
+    //! a larger container. This allows several readers to fill disjoint 
+    //! parts of the same container.
+    //!
+    //! \tparam CTYPE container type
+    //!
+    template<typename CTYPE> class container_range
+    {
+        public:
+            typedef typename CTYPE::value_type value_type;
+            typedef typename CTYPE::iterator iterator;
+        private:
+            iterator _begin;
+            size_t _size;
+        public:
+            //!
+            //! \brief constructor
+            //!
+            //! \param begin iterator to the first element of the range
+            //! \param size number of elements
+            //!
+            container_range(iterator begin,size_t size):
+                _begin(begin),
+                _size(size)
+            {}
+
+            //! iterator to the first element
+            iterator begin() const { return _begin; }
+
+            //! iterator to the element after the last
+            iterator end() const { return _begin+_size; }
+
+            //! number of elements
+            size_t size() const { return _size; }
+    };
+
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief convert samples 
+    //!
+    //! Converts n samples of type IT, stored stride bytes apart, to the 
+    //! value type of the target container. The contiguous case (stride 
+    //! equals the sample size) is a plain loop the compiler can vectorize.
+    //!
+    //! \tparam IT data type used in the image file
+    //! \tparam VT value type of the target container
+    //! \tparam ITER output iterator type
+    //! \param src pointer to the first sample
+    //! \param n number of samples
+    //! \param stride distance between two samples in bytes
+    //! \param out output iterator
+    //! \return output iterator after the last converted sample
+    //!
+    template<
+             typename IT,
+             typename VT,
+             typename ITER
+            >
+    ITER convert_samples(const char *src,size_t n,size_t stride,ITER out)
+    {
+        IT sample;
+        if(stride == sizeof(IT))
+        {
+            for(size_t i=0;i<n;++i,++out,src+=sizeof(IT))
+            {
+                std::memcpy(&sample,src,sizeof(IT));
+                *out = VT(sample);
+            }
+        }
+        else
+        {
+            for(size_t i=0;i<n;++i,++out,src+=stride)
+            {
+                std::memcpy(&sample,src,sizeof(IT));
+                *out = VT(sample);
+            }
+        }
+        return out;
+    }
+
     //! \ingroup image_io_tiff
     //! \brief reader for strip data in a TIFF file
     class PNIIO_EXPORT strip_reader 
@@ -55,6 +145,7 @@ namespace tiff {
 #ifdef _MSC_VER
 #pragma warning(default:4251)
 #endif
+            mutable strip_decoder _decoder; //!< decoder for compressed strips
 
             //-----------------------------------------------------------------
             //!
@@ -79,6 +170,88 @@ namespace tiff {
             void _read_interlace(size_t c,std::ifstream &stream,
                                  CTYPE &data) const;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read contiguous single channel data
+            //!
+            //! Fast path for images with a single channel. Every strip is 
+            //! read with a single call into a buffer and converted from 
+            //! there.
+            //!
+            //! \throws file_error if reading a strip fails
+            //! \tparam IT data type used in the image file
+            //! \tparam CTYPE container type where the data shoule be stored
+            //! \param stream input stream from which to read data
+            //! \param data target container where to store the data
+            //!
+            template<
+                     typename IT,
+                     typename CTYPE
+                    > 
+            void _read_contiguous(std::ifstream &stream,CTYPE &data) const;
+
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief template to read interlace data from memory
+            //!
+            //! Same as the stream version but the strips are read from a 
+            //! buffer holding the entire file.
+            //!
+            //! \throws file_error if a strip exceeds the buffer or is truncated
+            //! \tparam IT data type used in the image file
+            //! \tparam CTYPE container type where the data shoule be stored
+            //! \param c number of the channel to read
+            //! \param buffer pointer to the first byte of the file
+            //! \param size size of the buffer
+            //! \param data target container where to store the data
+            //!
+            template<
+                     typename IT,
+                     typename CTYPE
+                    > 
+            void _read_interlace(size_t c,const char *buffer,size_t size,
+                                 CTYPE &data) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read compressed data
+            //!
+            //! Every strip is decoded into the buffer of the strip decoder
+            //! and the samples of the requested channel are converted from
+            //! there.
+            //!
+            //! \throws file_error if reading or decoding a strip fails
+            //! \tparam IT data type used in the image file
+            //! \tparam CTYPE container type where the data shoule be stored
+            //! \tparam ARGS source of the data (stream or buffer and size)
+            //! \param c number of the channel to read
+            //! \param data target container where to store the data
+            //! \param args data source
+            //!
+            template<
+                     typename IT,
+                     typename CTYPE,
+                     typename ...ARGS
+                    >
+            void _read_decoded(size_t c,CTYPE &data,ARGS &&...args) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief dispatch on the channel type
+            //!
+            //! Calls _read_interlace with the data type of channel c. 
+            //!
+            //! \throws type_error if the image data type is unkown
+            //! \tparam CTYPE container type where the data shoule be stored
+            //! \tparam ARGS source of the data (stream or buffer and size)
+            //! \param c number of the channel to read
+            //! \param data target container where to store the data
+            //! \param args data source
+            //!
+            template<typename CTYPE,typename ...ARGS>
+            void _dispatch(size_t c,CTYPE &data,ARGS &&...args) const;
+
         public:
             //====================constructors and destructor==================
             //! default constructor
@@ -102,11 +275,13 @@ namespace tiff {
             //! \param byte_counts vector with byte counts for every strip
             //! \param bits_per_channel vector with number of pits per channel
             //! \param channel_types vector with TypeIDs for each channel
+            //! \param decoder decoder for compressed strips
             //!
             strip_reader(const std::vector<size_t> &offsets,
                          const std::vector<size_t> &byte_counts,
                          const std::vector<size_t> &bits_per_channel,
-                         const std::vector<pni::core::type_id_t> &channel_types);
+                         const std::vector<pni::core::type_id_t> &channel_types,
+                         const strip_decoder &decoder = strip_decoder());
 
             //------------------------------------------------------------------
             //! destructor
@@ -124,9 +299,15 @@ namespace tiff {
             //!
             //! \brief create StripReader instance
             //!
-            //! This static factory method creates a StripReader object from 
-            //! the IFD of an image and its ImageInfo structure. 
+            //! This static factory method creates a StripReader object from
+            //! the IFD of an image and its ImageInfo structure. The
+            //! Compression, Predictor and RowsPerStrip entries determine how
+            //! strips are decoded.
             //!
+            //! \throws not_implemented_error if the compression scheme or
+            //! predictor is not supported
+            //! \throws value_error if the predictor does not fit the
+            //! sample layout
             //! \param stream input stream from which to read data
             //! \param image_dir IFD of the image for which the reader should 
             //! be created
@@ -138,6 +319,41 @@ namespace tiff {
                                        const image_info &info);
 
             //=====================public member methods========================
+            //! get number of strips
+            size_t nstrips() const { return _offsets.size(); }
+
+            //-----------------------------------------------------------------
+            //! get the decoder for compressed strips
+            strip_decoder &decoder() { return _decoder; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get number of pixels
+            //!
+            //! Returns the number of pixels stored in all strips. This may 
+            //! be larger than the number of pixels in the image as the last
+            //! strip can be padded. For compressed strips the decoded size
+            //! of a full strip is assumed for every strip.
+            //!
+            //! \return number of pixels
+            //!
+            size_t npixels() const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief split the reader
+            //!
+            //! Splits the strips into at most n groups of consecutive strips
+            //! with roughly equal size. Each group is returned as a separate
+            //! reader. Reading all groups into consecutive parts of a 
+            //! container yields the same result as reading with this 
+            //! instance.
+            //!
+            //! \param n maximum number of groups
+            //! \return readers for the groups
+            //!
+            std::vector<strip_reader> split(size_t n) const;
+
             //! 
             //! \brief template to read image data of various type
             //!
@@ -154,32 +370,28 @@ namespace tiff {
             template<typename CTYPE> 
                 void read(size_t c,std::ifstream &stream,CTYPE &data) 
             {
-                using namespace pni::core;
-                //first we need to determine the datatype of the
-
-                if(this->_channel_types[c] == type_id_t::UINT8)
-                    this->_read_interlace<uint8>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::INT8)
-                    this->_read_interlace<int8>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::UINT16)
-                    this->_read_interlace<uint16>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::INT16)
-                    this->_read_interlace<int16>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::UINT32)
-                    this->_read_interlace<uint32>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::INT32)
-                    this->_read_interlace<int32>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::UINT64)
-                    this->_read_interlace<uint64>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::INT64)
-                    this->_read_interlace<int64>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::FLOAT32)
-                    this->_read_interlace<float32>(c,stream,data);
-                else if(this->_channel_types[c] == type_id_t::FLOAT64)
-                    this->_read_interlace<float64>(c,stream,data);
-                else
-                    throw type_error(EXCEPTION_RECORD,
-                          "StripReader cannot handle channel type!");
+                _dispatch(c,data,stream);
+            }
+
+            //-----------------------------------------------------------------
+            //! 
+            //! \brief read image data from memory
+            //!
+            //! Reads the strips from a buffer holding the entire file, 
+            //! typically a memory map. 
+            //!
+            //! \throws type_error if the image data type is unkown
+            //! \throws file_error if a strip exceeds the buffer or is truncated
+            //! \param c number of the channel to read
+            //! \param buffer pointer to the first byte of the file
+            //! \param size size of the buffer in bytes
+            //! \param data reference to the container where to store the data
+            //!
+            template<typename CTYPE> 
+                void read(size_t c,const char *buffer,size_t size,
+                          CTYPE &data) 
+            {
+                _dispatch(c,data,buffer,size);
             }
 
             //=====================output operator==============================
@@ -188,11 +400,86 @@ namespace tiff {
                                             const strip_reader &r);
         };
 
+    //-------------------------------------------------------------------------
+    template<typename CTYPE,typename ...ARGS>
+        void strip_reader::_dispatch(size_t c,CTYPE &data,ARGS &&...args) const
+    {
+        using namespace pni::core;
+        //first we need to determine the datatype of the
+
+        if(this->_channel_types[c] == type_id_t::UINT8)
+            this->_read_interlace<uint8>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::INT8)
+            this->_read_interlace<int8>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::UINT16)
+            this->_read_interlace<uint16>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::INT16)
+            this->_read_interlace<int16>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::UINT32)
+            this->_read_interlace<uint32>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::INT32)
+            this->_read_interlace<int32>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::UINT64)
+            this->_read_interlace<uint64>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::INT64)
+            this->_read_interlace<int64>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::FLOAT32)
+            this->_read_interlace<float32>(c,args...,data);
+        else if(this->_channel_types[c] == type_id_t::FLOAT64)
+            this->_read_interlace<float64>(c,args...,data);
+        else
+            throw type_error(EXCEPTION_RECORD,
+                  "StripReader cannot handle channel type!");
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename IT,typename CTYPE> 
+        void strip_reader::_read_contiguous(std::ifstream &stream,
+                                            CTYPE &data) const
+    {
+        using namespace pni::core;
+        typedef typename CTYPE::value_type value_type;
+
+        std::vector<char> buffer;
+        size_t remaining = data.size();
+        typename CTYPE::iterator piter = data.begin(); //pixel iterator
+
+        for(size_t strip=0;strip<_offsets.size() && remaining;strip++)
+        {
+            size_t npixels = std::min(_byte_cnts[strip]/sizeof(IT),remaining);
+            size_t nbytes  = npixels*sizeof(IT);
+            buffer.resize(nbytes);
+
+            stream.clear();
+            stream.seekg(_offsets[strip],std::ios::beg);
+            if(!stream.read(buffer.data(),static_cast<std::streamsize>(nbytes)))
+                throw file_error(EXCEPTION_RECORD,
+                        "Error reading strip from TIFF file!");
+
+            piter = convert_samples<IT,value_type>(buffer.data(),npixels,
+                                                   sizeof(IT),piter);
+            remaining -= npixels;
+        }
+    }
+
     //-------------------------------------------------------------------------
     template<typename IT,typename CTYPE> 
         void strip_reader::_read_interlace(size_t channel,
                 std::ifstream &stream,CTYPE &data) const
     {
+        if(_decoder.is_active())
+        {
+            _read_decoded<IT>(channel,data,stream);
+            return;
+        }
+
+        //single channel data is contiguous and can be read strip by strip
+        if(_bits_per_channel.size() == 1)
+        {
+            _read_contiguous<IT>(stream,data);
+            return;
+        }
+
         typedef typename CTYPE::value_type value_type;
         //compute the size of a pixel in bytes
         size_t pixel_size = std::accumulate(_bits_per_channel.begin(),
@@ -210,27 +497,97 @@ namespace tiff {
         IT sample_buffer; 
 
         typename CTYPE::iterator piter = data.begin(); //pixel iterator
-        while(piter != data.end())
+        //loop over all strips
+        for(size_t strip=0;strip<_offsets.size() && piter!=data.end();strip++)
         {
-            //loop over all strips
-            for(size_t strip=0;strip<_offsets.size();strip++)
+            size_t npixels = _byte_cnts[strip]/pixel_size;
+
+            //set the stream to the offset of the actual strip
+            stream.seekg(_offsets[strip]+sample_offset,std::ios::beg);
+
+            //loop over all pixels in the strip
+            for(size_t i=0;i<npixels && piter!=data.end(); ++i)
             {
-                size_t npixels = _byte_cnts[strip]/pixel_size;
-
-                //set the stream to the offset of the actual strip
-                stream.seekg(_offsets[strip]+sample_offset,std::ios::beg);
-
-                //loop over all pixels in the strip
-                for(size_t i=0;i<npixels; ++i)
-                {
-                    stream.read(reinterpret_cast<char*>(&sample_buffer),sample_size);
-                    stream.seekg(pixel_size-sample_size,std::ios::cur);
-                    *piter++ = value_type(sample_buffer);
-                }
+                stream.read(reinterpret_cast<char*>(&sample_buffer),sample_size);
+                stream.seekg(pixel_size-sample_size,std::ios::cur);
+                *piter++ = value_type(sample_buffer);
             }
         }
     }
 
+    //-------------------------------------------------------------------------
+    template<typename IT,typename CTYPE> 
+        void strip_reader::_read_interlace(size_t channel,const char *buffer,
+                size_t size,CTYPE &data) const
+    {
+        using namespace pni::core;
+        typedef typename CTYPE::value_type value_type;
+
+        if(_decoder.is_active())
+        {
+            _read_decoded<IT>(channel,data,buffer,size);
+            return;
+        }
+
+        //compute the size of a pixel in bytes
+        size_t pixel_size = std::accumulate(_bits_per_channel.begin(),
+                                            _bits_per_channel.end(),0)/8;
+       
+        //compute the offset from the begining of a pixel to the requested
+        //sample. The offset is given in bytes
+        size_t sample_offset = std::accumulate(_bits_per_channel.begin(),
+                                               _bits_per_channel.begin()+channel,
+                                               0)/8;
+
+        size_t remaining = data.size();
+        typename CTYPE::iterator piter = data.begin(); //pixel iterator
+        for(size_t strip=0;strip<_offsets.size() && remaining;strip++)
+        {
+            if(_offsets[strip]>size || _byte_cnts[strip]>size-_offsets[strip])
+                throw file_error(EXCEPTION_RECORD,
+                        "Strip exceeds the size of the file!");
+
+            size_t npixels = std::min(_byte_cnts[strip]/pixel_size,remaining);
+
+            //decode straight from the buffer
+            piter = convert_samples<IT,value_type>(
+                    buffer+_offsets[strip]+sample_offset,npixels,pixel_size,
+                    piter);
+            remaining -= npixels;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename IT,typename CTYPE,typename ...ARGS> 
+        void strip_reader::_read_decoded(size_t channel,CTYPE &data,
+                                         ARGS &&...args) const
+    {
+        using namespace pni::core;
+        typedef typename CTYPE::value_type value_type;
+        size_t pixel_size = std::accumulate(_bits_per_channel.begin(),
+                                            _bits_per_channel.end(),0)/8;
+        size_t sample_offset = std::accumulate(_bits_per_channel.begin(),
+                                               _bits_per_channel.begin()+channel,
+                                               0)/8;
+
+        size_t remaining = data.size();
+        typename CTYPE::iterator piter = data.begin(); //pixel iterator
+        for(size_t strip=0;strip<_offsets.size() && remaining;strip++)
+        {
+            size_t nbytes = _decoder.decode(args...,_offsets[strip],
+                                            _byte_cnts[strip]);
+            //only the last strip of an image may be shorter
+            size_t npixels = std::min(_decoder.strip_size()/pixel_size,
+                                      remaining);
+            if(nbytes<npixels*pixel_size)
+                throw file_error(EXCEPTION_RECORD,
+                        "Decoded strip is too small!");
+
+            piter = convert_samples<IT,value_type>(
+                    _decoder.data()+sample_offset,npixels,pixel_size,piter);
+            remaining -= npixels;
+        }
+    }
 
 //end of namespace
 }
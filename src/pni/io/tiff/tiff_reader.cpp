@@ -24,6 +24,7 @@
 
 #include <numeric>
 #include <sstream>
+#include <unordered_set>
 
 #include <pni/core/error.hpp>
 #include <pni/core/types.hpp>
@@ -35,143 +36,125 @@ namespace pni{
 namespace io{
 
     //============implementation of private methods============================
-    //implementation of _set_endianess
-    bool tiff_reader::_is_little_endian(std::ifstream &stream)
-    {
-        std::streampos orig_pos = stream.tellg();
-
-        //set the stream to the very beginning of the file
-        stream.seekg(0,std::ios::beg);
-        //TIFF file and how it looks with endieness
-        char buffer[2];
-        stream.read(buffer,2);
-        //reset the stream to its original position
-        stream.seekg(orig_pos,std::ios::beg);
-
-        if((buffer[0]=='I')&&(buffer[1]=='I')) return true;
-        if((buffer[0]=='M')&&(buffer[1]=='M')) return false;
-
-        return false; //just to avoid compiler warnings
-    }
-
-    //-------------------------------------------------------------------------
-    //implementation of check tiff
-    void tiff_reader::_check_if_tiff(std::ifstream &stream)
-    {
-        using namespace pni::core;
-        std::streampos orig_pos = stream.tellg();
-
-        //set stream to the correct position in the TIFF file
-        stream.seekg(2,std::ios::beg);
-
-        //read the magic number
-        uint16 magic;
-        stream.read(reinterpret_cast<char*>(&magic),2);
-            
-        //reset stream position
-        stream.seekg(orig_pos,std::ios::beg);
-        if(magic!=42)
-            throw file_error(EXCEPTION_RECORD,"Not a TIFF file!");
-        
-    }
-    
-    //--------------------------------------------------------------------------
     //implementation of read IFD offset
-    pni::core::uint32 tiff_reader::_read_ifd_offset(std::ifstream &stream)
+    pni::core::uint64 tiff_reader::_read_ifd_offset(std::ifstream &stream) const
     {
-        //no we need to read the IFD entries read the first IFD offset
-        pni::core::uint32 offset = 0;
-        stream.read(reinterpret_cast<char*>(&offset),4);
-        return offset;
+        return _format.read_offset(stream);
     }
     
     //-------------------------------------------------------------------------
-    size_t tiff_reader::_read_ifd_size(std::ifstream &stream)
+    size_t tiff_reader::_read_ifd_size(std::ifstream &stream) const
     {
-        size_t size = 0;
-        stream.read(reinterpret_cast<char*>(&size),2);
-        return size;
+        return _format.read_ifd_size(stream);
     }
 
     //-------------------------------------------------------------------------
-    //implementation of _read_image_info
+    //implementation of _read_ifds
     void tiff_reader::_read_ifds()
     {
         using namespace pni::core;
         //obtain stream
         std::ifstream &stream = _get_stream();
+        _ifd_offsets.clear();
+        _ifd_cache.clear();
 
-        //check endianess of the data - we need to do this before all other
-        //things in order to interpret binary data correctly
-        _little_endian = tiff_reader::_is_little_endian(stream);
-        
-        //now we check if the file is really a TIFF file
-        tiff_reader::_check_if_tiff(stream);
+        //check endianess and version of the file - we need to do this before
+        //all other things in order to interpret binary data correctly. 
+        //Afterwards the stream points to the offset of the first IFD.
+        _format = tiff::file_format::read(stream);
 
-
-        //set the stream to the position of the first IFD offse
-        stream.seekg(4,std::ios::beg);
         //no we need to read the IFD entries read the first IFD offset
-        uint32 ifd_offset = _read_ifd_offset(stream);
+        uint64 ifd_offset = _read_ifd_offset(stream);
         if(ifd_offset == 0)
             throw file_error(EXCEPTION_RECORD,"File "+filename()+" does not "
                     "contain an IDF entry!");
 
-        //read IFDs from the file
+        //an entry consists of the tag, the type, the number of values and 
+        //the value field
+        uint64 entry_size = 4+2*_format.offset_size();
+        std::unordered_set<uint64> visited;
+
+        //follow the chain of IFDs - the entries are skipped
         do{
-            //move the stream to the staring position of the IDF
-            stream.seekg(ifd_offset, std::ios::beg);
+            if(!visited.insert(ifd_offset).second)
+                throw file_error(EXCEPTION_RECORD,"IFDs of file "+filename()+
+                        " form a loop!");
 
-            //create the IDF from the stream - here we assume that the IFD
-            //constructor returns the stream at the position where the offset of
-            //the next IFD is stored.
-            tiff::ifd ifd(_read_ifd_size(stream));
+            stream.seekg(ifd_offset, std::ios::beg);
+            uint64 nentries = _read_ifd_size(stream);
+            stream.seekg(std::streamoff(nentries*entry_size),std::ios::cur);
+            uint64 next_offset = _read_ifd_offset(stream);
 
-            for(tiff::ifd_entry &entry: ifd) 
-            {
-                entry = std::move(tiff::ifd_entry::create_from_stream(stream));
-            }
+            if(!stream)
+                throw file_error(EXCEPTION_RECORD,"Error reading IFD from "
+                        "file "+filename()+"!");
             
-            //store the IFD
-            _ifds.push_back(ifd);
-
-            //read next IFD offset
-            ifd_offset = _read_ifd_offset(stream);
+            _ifd_offsets.push_back(ifd_offset);
+            ifd_offset = next_offset;
         }while(ifd_offset);
     }
 
     //-------------------------------------------------------------------------
-    std::vector<size_t> tiff_reader::
-        _get_bits_per_sample(std::ifstream &stream,const tiff::ifd &ifd) 
+    const tiff::ifd &tiff_reader::_get_ifd(size_t i) const
     {
-        std::vector<size_t> bits_per_sample(1);
-        try
-        {
-            bits_per_sample =
-                ifd["BitsPerSample"].value<size_t>(stream);
-        }catch(...)
+        using namespace pni::core;
+        if(i>=_ifd_offsets.size())
         {
-            //ok - a bilevel image has only one bit per sample and only one
-            //sample per pixel 
-            bits_per_sample[0] = 1; 
+            std::stringstream ss;
+            ss<<"Image index "<<i<<" exceeds number of images (";
+            ss<<_ifd_offsets.size()<<")!";
+            throw index_error(EXCEPTION_RECORD,ss.str());
         }
-        return bits_per_sample;
+
+        if(const tiff::ifd *cached = _ifd_cache.find(i)) return *cached;
+
+        std::ifstream &stream = _get_stream();
+        stream.clear();
+        stream.seekg(_ifd_offsets[i],std::ios::beg);
+
+        //the IFD is read with its data - afterwards no metadata of the 
+        //image has to be read from the file
+        tiff::ifd image_dir(tiff::ifd::read(stream,_format));
+
+        if(!stream)
+            throw file_error(EXCEPTION_RECORD,"Error reading IFD from "
+                    "file "+filename()+"!");
+
+        return _ifd_cache.insert(i,std::move(image_dir));
+    }
+
+    //-------------------------------------------------------------------------
+    void tiff_reader::_acquire_decoder(size_t w,tiff::strip_decoder &decoder)
+    {
+        if(decoder.is_active() && decoder.same_parameters(_decoders[w]))
+            decoder = std::move(_decoders[w]);
+    }
+
+    //-------------------------------------------------------------------------
+    void tiff_reader::_release_decoder(size_t w,tiff::strip_decoder &decoder)
+    {
+        if(decoder.is_active()) _decoders[w] = std::move(decoder);
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<size_t> tiff_reader::
+        _get_bits_per_sample(std::ifstream &stream,const tiff::ifd &ifd) 
+    {
+        //a bilevel image has only one bit per sample and only one sample 
+        //per pixel 
+        if(!ifd.has("BitsPerSample")) return std::vector<size_t>(1,1);
+
+        return ifd.values(stream,"BitsPerSample");
     }
 
     //-------------------------------------------------------------------------
     std::vector<size_t> tiff_reader::
         _get_sample_format(std::ifstream &stream,const tiff::ifd &ifd)
     {
-        std::vector<size_t> sample_format(1);
-        try
-        {
-            sample_format = ifd["SampleFormat"].value<size_t>(stream);
-        }
-        catch(...)
-        {
-            sample_format[0] = 1;
-        }
-        return sample_format;
+        //unsigned integer data by default
+        if(!ifd.has("SampleFormat")) return std::vector<size_t>(1,1);
+
+        return ifd.values(stream,"SampleFormat");
     }
 
     //---------------------------------------------------------------------
@@ -235,7 +218,11 @@ namespace io{
 
     //=============implementation of constructors and destructor===========
     //implementation of the default constructor
-    tiff_reader::tiff_reader():image_reader()
+    tiff_reader::tiff_reader():
+        image_reader(),
+        _format(),
+        _nthreads(1),
+        _ifd_cache(1024)
     { 
         //set the stream format to binary
         data_reader::_set_binary();
@@ -245,13 +232,20 @@ namespace io{
     //implementation of the move constructor
     tiff_reader::tiff_reader(tiff_reader &&r):
         image_reader(std::move(r)),
-        _little_endian(std::move(r._little_endian)),
-        _ifds(std::move(r._ifds))
+        _format(r._format),
+        _nthreads(r._nthreads),
+        _ifd_cache(std::move(r._ifd_cache)),
+        _ifd_offsets(std::move(r._ifd_offsets)),
+        _decoders(std::move(r._decoders))
     {}
 
     //---------------------------------------------------------------------
     //implementation of the standard constructor
-    tiff_reader::tiff_reader(const string &fname):image_reader(fname,true)
+    tiff_reader::tiff_reader(const string &fname):
+        image_reader(fname,true),
+        _format(),
+        _nthreads(1),
+        _ifd_cache(1024)
     { 
         _read_ifds(); 
     }
@@ -266,7 +260,11 @@ namespace io{
     {
         if(this == &r) return *this;
         image_reader::operator=(std::move(r));
-        _ifds = std::move(r._ifds);
+        _format = r._format;
+        _nthreads = r._nthreads;
+        _ifd_cache = std::move(r._ifd_cache);
+        _ifd_offsets = std::move(r._ifd_offsets);
+        _decoders = std::move(r._decoders);
 
         return *this;
     }
@@ -275,21 +273,21 @@ namespace io{
 
     size_t tiff_reader::nimages() const
     {
-        return _ifds.size();
+        return _ifd_offsets.size();
     }
 
     //-------------------------------------------------------------------------
     image_info tiff_reader::info(size_t i) const 
     {
         //get the right ifd
-        const tiff::ifd &ifd = _ifds[i];
+        const tiff::ifd &ifd = _get_ifd(i);
 
         //the number of pixels in x-direction is associated with the image width
         //in TIFF
-        size_t nx = ifd["ImageLength"].value<size_t>(_get_stream())[0];
+        size_t nx = ifd.values(_get_stream(),"ImageLength").at(0);
         //the number of pixels in y-direction is associated with the image
         //length in TIFF
-        size_t ny = ifd["ImageWidth"].value<size_t>(_get_stream())[0];
+        size_t ny = ifd.values(_get_stream(),"ImageWidth").at(0);
 
         
         //need to obtain the number of bits per sample. From this field we can
@@ -331,7 +329,9 @@ namespace io{
     void tiff_reader::close()
     {
         data_reader::close();
-        _ifds.clear();
+        _ifd_offsets.clear();
+        _ifd_cache.clear();
+        _decoders.clear();
     }
 
     //=====================implementation of friend functions and operators====
@@ -340,7 +340,7 @@ namespace io{
         o<<"TIFFReader for file: "<<r.filename()<<std::endl;
         o<<"File contains: "<<r.nimages()<<" images"<<std::endl; 
 
-        for(auto ifd: r._ifds) o<<ifd;
+        for(size_t i=0;i<r.nimages();++i) o<<r._get_ifd(i);
         
         return o;
     }
@@ -30,8 +30,13 @@
 #include <pni/io/image_reader.hpp>
 #include <pni/io/image_info.hpp>
 #include <pni/io/tiff/ifd.hpp>
+#include <pni/io/tiff/ifd_cache.hpp>
 #include <pni/io/tiff/ifd_entry.hpp>
+#include <pni/io/tiff/file_format.hpp>
 #include <pni/io/tiff/strip_reader.hpp>
+#include <pni/io/tiff/tile_reader.hpp>
+#include <pni/io/image_roi.hpp>
+#include <pni/io/parallel_for.hpp>
 #include <pni/io/windows.hpp>
 
 
@@ -43,64 +48,56 @@ namespace io{
     //! \brief TIFF file reader
     //!
     //! TIFFReader is an implementation of the Reader class for reading 
-    //! TIFF image files. Actually only uncompressed TIFF images are 
-    //! supported.  The copy constructor and the copy assignment operator 
-    //! are deleted to prevent copy construction of this object. 
+    //! TIFF image files stored in strips or tiles. A region of interest
+    //! can be read without reading the entire image. The copy constructor
+    //! and the copy assignment operator are deleted to prevent copy 
+    //! construction of this object. 
     //!
     class PNIIO_EXPORT tiff_reader:public image_reader 
     {
         private:
-            bool _little_endian;  //!< true if data is stored as little endian
+            //!
+            //! \brief part of the data decoded by a single job
+            //!
+            //! Either a group of strips read with a strip reader or a band 
+            //! of rows read with a tile reader.
+            //!
+            struct read_job
+            {
+                bool tiled;                 //!< true if tiles is used
+                tiff::strip_reader strips;  //!< reader for a group of strips
+                tiff::tile_reader tiles;    //!< reader for a band of rows
+                image_roi roi;              //!< band read with tiles
+                size_t offset;              //!< offset in the container
+                size_t size;                //!< number of pixels
+            };
+
+            tiff::file_format _format; //!< byte order and offset size
+            size_t _nthreads;     //!< number of threads used for decoding
+            mutable tiff::ifd_cache _ifd_cache; //!< IFDs parsed so far
 #ifdef _MSC_VER
 #pragma warning(disable:4251)
 #endif
-            std::vector<tiff::ifd> _ifds; //!< IFD list
+            //! offsets of the IFDs in the file
+            std::vector<pni::core::uint64> _ifd_offsets;
+            //! decoders of the worker threads - keep their buffers between
+            //! images
+            std::vector<tiff::strip_decoder> _decoders;
 #ifdef _MSC_VER
 #pragma warning(default:4251)
 #endif
             //=====================private methods=============================
             //!
-            //! \brief check binary encoding
-            //!
-            //! This private method checks if the image is encoded as TIFF or 
-            //! not.  The method makes no assumption about the position of 
-            //! the stream pointer. It moves it automatically to the 
-            //! correction position and reads the data from there. Afterwards 
-            //! the stream will be reset to the position where it originally 
-            //! was.  True is returned when the TIFF file contains little 
-            //! endian encoded data and false otherwise.
-            //!
-            //! \param stream input stream from which to read data
-            //! \return true file data is encoded as little endian
-            //!
-            static bool _is_little_endian(std::ifstream &stream);
-
-            //-----------------------------------------------------------------
-            //!
-            //! \brief check if image is TIFF
-            //!
-            //! Checks if the stream belongs to a TIFF image. If the file is 
-            //! not a TIFF file an exception will be thrown. No assumption is 
-            //! made about the position of the stream. The methods adjusts 
-            //! the stream to the proper positions and resets it to its 
-            //! original position once finished.
-            //!
-            //! \param stream input stream from which to read data
-            //! \throw FileError if stream is not a TIFF file
-            //!
-            static void _check_if_tiff(std::ifstream &stream);
-
-            //------------------------------------------------------------------
-            //!
             //! \brief read IFD offset
             //!
             //! Method obtains the offset for an IFD from the actual stream
-            //! position.
+            //! position. The offset has 32Bit for classic TIFF files and 
+            //! 64Bit for BigTIFF files.
             //!
             //! \param stream input stream from which to read data
             //! \return IFD offset
             //!
-            static pni::core::uint32 _read_ifd_offset(std::ifstream &stream);
+            pni::core::uint64 _read_ifd_offset(std::ifstream &stream) const;
 
             //-----------------------------------------------------------------
             //!
@@ -112,7 +109,7 @@ namespace io{
             //! \param stream input stream from which to read data
             //! \return number of IFD entries
             //!
-            static size_t _read_ifd_size(std::ifstream &stream);
+            size_t _read_ifd_size(std::ifstream &stream) const;
 
             //-----------------------------------------------------------------
             //!
@@ -163,13 +160,56 @@ namespace io{
            
             //-----------------------------------------------------------------
             //!
-            //! \brief read IDF data from the file
+            //! \brief locate the IFDs in the file
             //!
-            //! Read all the IDF data from the file and store them in the 
-            //! _idfs private member variable.
+            //! Reads the file header and follows the chain of next-IFD 
+            //! offsets. Only the number of entries and the offset of the 
+            //! next IFD are read for every IFD - the entries themselves 
+            //! are parsed on first access by _get_ifd(). The offsets are 
+            //! stored in _ifd_offsets.
+            //!
+            //! \throws file_error if the file contains no IFD, the chain of
+            //! offsets contains a loop or reading fails
             //!
             void _read_ifds(); 
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get an IFD
+            //!
+            //! Returns the IFD of image i from the cache. If it is not 
+            //! cached the IFD is parsed from the file. The reference stays 
+            //! valid until the IFD of another image is parsed.
+            //!
+            //! \throws index_error if i exceeds the number of images
+            //! \throws file_error if the IFD cannot be read
+            //! \param i index of the image
+            //! \return reference to the IFD
+            //!
+            const tiff::ifd &_get_ifd(size_t i) const;
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief take over the buffers of a cached decoder
+            //!
+            //! If the cached decoder of worker w decodes with the same 
+            //! parameters, decoder takes over its buffers. Otherwise decoder
+            //! is left untouched and allocates its buffers on first use.
+            //!
+            //! \param w index of the worker
+            //! \param decoder decoder of a strip or tile reader
+            //!
+            void _acquire_decoder(size_t w,tiff::strip_decoder &decoder);
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief return a decoder to the cache of a worker
+            //!
+            //! \param w index of the worker
+            //! \param decoder decoder of a strip or tile reader
+            //!
+            void _release_decoder(size_t w,tiff::strip_decoder &decoder);
+
             //----------------------------------------------------------------
             //! 
             //! \brief read data from the file
@@ -184,6 +224,60 @@ namespace io{
             //!
             template<typename CTYPE> 
             void _read_data(size_t i,size_t c,CTYPE &data);
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief read several pages in parallel
+            //!
+            //! The strips of all pages in [first,last) are split into groups
+            //! which are decoded concurrently into consecutive parts of data.
+            //! Workers read from the memory map of the file. If the file 
+            //! is not mapped each worker uses its own stream so that no 
+            //! stream position is shared between threads.
+            //!
+            //! \tparam CTYPE container type where to store the data 
+            //! \param first index of the first page
+            //! \param last index of the page after the last one
+            //! \param c channel number 
+            //! \param data container for all pages
+            //!
+            template<typename CTYPE> 
+            void _read_pages(size_t first,size_t last,size_t c,CTYPE &data);
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief read a region of interest
+            //!
+            //! The region is split into bands of rows which are decoded in
+            //! parallel according to nthreads().
+            //!
+            //! \tparam CTYPE container type where to store the data 
+            //! \param i image number
+            //! \param c channel number 
+            //! \param roi region of interest
+            //! \param data container with roi.npixels() elements
+            //!
+            template<typename CTYPE> 
+            void _read_roi(size_t i,size_t c,const image_roi &roi,
+                           CTYPE &data);
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief run read jobs
+            //!
+            //! Workers read from the memory map of the file. If the file 
+            //! is not mapped each worker thread opens its own stream once,
+            //! on its first job, so that no stream position is shared 
+            //! between threads. The calling thread uses the stream of the
+            //! reader.
+            //!
+            //! \tparam CTYPE container type where to store the data 
+            //! \param jobs jobs to run
+            //! \param c channel number 
+            //! \param data container where to store the data
+            //!
+            template<typename CTYPE> 
+            void _run_jobs(std::vector<read_job> &jobs,size_t c,CTYPE &data);
         public:
             //==============constructors and destructor========================
             //! default constructor
@@ -244,6 +338,47 @@ namespace io{
             //! close the file
             virtual void close();
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief set number of decoding threads
+            //!
+            //! If larger than 1 the strips of an image, or the pages read 
+            //! with images(), are decoded in parallel. A value of 0 uses one 
+            //! thread per core. The default is 1.
+            //!
+            //! \param n number of threads
+            //!
+            void nthreads(size_t n) { _nthreads = n; }
+
+            //-----------------------------------------------------------------
+            //! get number of decoding threads
+            size_t nthreads() const { return _nthreads; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get the file format
+            //!
+            //! \return byte order and offset size of the file
+            //!
+            const tiff::file_format &format() const { return _format; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief set the size of the IFD cache
+            //!
+            //! IFDs are parsed when an image is accessed for the first time
+            //! and kept in a cache. If the cache is full the least recently
+            //! used IFD is dropped. A value of 0 keeps all IFDs. The 
+            //! default is 1024.
+            //!
+            //! \param n maximum number of cached IFDs
+            //!
+            void ifd_cache_size(size_t n) { _ifd_cache.capacity(n); }
+
+            //-----------------------------------------------------------------
+            //! get the size of the IFD cache
+            size_t ifd_cache_size() const { return _ifd_cache.capacity(); }
+
             //-----------------------------------------------------------------
             //!
             //! \brief read image data
@@ -307,6 +442,82 @@ namespace io{
                 //read data
                 _read_data(i,c,data);
             }
+
+            //----------------------------------------------------------------- 
+            //!
+            //! \brief read a region of interest
+            //!
+            //! Reads the pixels of a rectangular region of an image into a 
+            //! container with roi.npixels() elements. The data is stored 
+            //! row by row. Only the strips or tiles intersecting the region
+            //! are read.
+            //!
+            //! \throws index_error if the image does not exist or the 
+            //! region exceeds the image
+            //! \throws size_mismatch_error if the size of the container does 
+            //! not match the number of pixels in the region
+            //! \param data instance of CTYPE where data will be stored
+            //! \param i index of the image in the file
+            //! \param c index of the image channel to read
+            //! \param roi region of interest
+            //!
+            template<typename CTYPE> 
+            void image(CTYPE &data,size_t i,size_t c,const image_roi &roi);
+
+            //----------------------------------------------------------------- 
+            //!
+            //! \brief read a region of interest
+            //!
+            //! Allocates a container for the region and reads the data.
+            //!
+            //! \throws memory_allocation_error if allocation fails
+            //! \throws index_error if the region exceeds the image
+            //! \param i index of the image in the file
+            //! \param c index of the image channel to read
+            //! \param roi region of interest
+            //! \return instance of CTYPE with the data of the region
+            //!
+            template<typename CTYPE> 
+            CTYPE image(size_t i,size_t c,const image_roi &roi);
+
+            //----------------------------------------------------------------- 
+            //!
+            //! \brief read a stack of images
+            //!
+            //! Reads the pages [first,last) into a preallocated container,
+            //! for instance a 3-D array of shape (last-first,nx,ny). The 
+            //! pages are stored one after the other. All pages must have 
+            //! the same number of pixels. Pages are decoded in parallel 
+            //! according to nthreads().
+            //!
+            //! \throws index_error if the range exceeds the number of images
+            //! \throws size_mismatch_error if the container size does not 
+            //! match or the pages differ in size
+            //! \param data instance of CTYPE where data will be stored
+            //! \param first index of the first image
+            //! \param last index of the image after the last one
+            //! \param c index of the image channel to read
+            //!
+            template<typename CTYPE> 
+            void images(CTYPE &data,size_t first,size_t last,size_t c=0);
+
+            //----------------------------------------------------------------- 
+            //!
+            //! \brief read a stack of images
+            //!
+            //! Allocates a container for the pages [first,last) and reads 
+            //! the data. 
+            //!
+            //! \throws memory_allocation_error if allocation fails
+            //! \throws index_error if the range exceeds the number of images
+            //! \throws size_mismatch_error if the pages differ in size
+            //! \param first index of the first image
+            //! \param last index of the image after the last one
+            //! \param c index of the image channel to read
+            //! \return instance of CTYPE with the data of all pages
+            //!
+            template<typename CTYPE> 
+            CTYPE images(size_t first,size_t last,size_t c=0);
           
             //-----------------------------------------------------------------
             //! output operator of an TIFFReader object
@@ -319,15 +530,267 @@ namespace io{
         void tiff_reader::_read_data(size_t i,size_t c,CTYPE &data)
     {
         //obtain the proper IFD
-        tiff::ifd &ifd = this->_ifds.at(i);
+        const tiff::ifd &ifd = _get_ifd(i);
+
+        if(tiff::tile_reader::is_tiled(ifd))
+        {
+            image_info info = this->info(i);
+            _read_roi(i,c,image_roi(0,0,info.nx(),info.ny()),data);
+            return;
+        }
+
+        if(_nthreads != 1)
+        {
+            _read_pages(i,i+1,c,data);
+            return;
+        }
+
         std::ifstream &stream = this->_get_stream();
 
-        //assume here that the image is stored using strips
+        //the image is stored using strips
         tiff::strip_reader reader(tiff::strip_reader::create(stream,ifd,this->info(i)));
         //std::cout<<reader<<std::endl;
 
-        reader.read(c,stream,data);
-        
+        if(_decoders.empty()) _decoders.resize(1);
+        _acquire_decoder(0,reader.decoder());
+
+        if(const file_map *map = this->_get_map())
+            reader.read(c,map->data(),map->size(),data);
+        else
+            reader.read(c,stream,data);
+
+        _release_decoder(0,reader.decoder());
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        void tiff_reader::_read_pages(size_t first,size_t last,size_t c,
+                                      CTYPE &data)
+    {
+        using namespace pni::core;
+
+        std::ifstream &stream = this->_get_stream();
+        size_t nthreads = worker_threads(_nthreads);
+        size_t npages   = last-first;
+        //split each page only if there are fewer pages than threads
+        size_t ngroups  = (nthreads+npages-1)/npages;
+
+        //all metadata is read upfront by the calling thread
+        std::vector<read_job> jobs;
+        size_t page_offset = 0;
+        for(size_t i=first;i<last;++i)
+        {
+            image_info info = this->info(i);
+            const tiff::ifd &image_dir = _get_ifd(i);
+            size_t offset = page_offset;
+            size_t end    = page_offset+info.npixels();
+
+            if(tiff::tile_reader::is_tiled(image_dir))
+            {
+                tiff::tile_reader reader(tiff::tile_reader::create(stream,
+                                         image_dir,info));
+                image_roi roi(0,0,info.nx(),info.ny());
+                for(auto &band: reader.split(roi,ngroups))
+                    jobs.push_back(read_job{true,tiff::strip_reader(),reader,
+                                            band,offset+band.x()*info.ny(),
+                                            band.npixels()});
+            }
+            else
+            {
+                tiff::strip_reader reader(tiff::strip_reader::create(stream,
+                                          image_dir,info));
+                for(auto &group: reader.split(ngroups))
+                {
+                    size_t size = std::min(group.npixels(),end-offset);
+                    if(!size) break;
+                    jobs.push_back(read_job{false,std::move(group),
+                                            tiff::tile_reader(),image_roi(),
+                                            offset,size});
+                    offset += size;
+                }
+            }
+            page_offset = end;
+        }
+
+        _run_jobs(jobs,c,data);
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        void tiff_reader::_read_roi(size_t i,size_t c,const image_roi &roi,
+                                    CTYPE &data)
+    {
+        std::ifstream &stream = this->_get_stream();
+        image_info info = this->info(i);
+        tiff::tile_reader reader(tiff::tile_reader::create(stream,_get_ifd(i),
+                                                           info));
+
+        std::vector<read_job> jobs;
+        for(auto &band: reader.split(roi,worker_threads(_nthreads)))
+            jobs.push_back(read_job{true,tiff::strip_reader(),reader,band,
+                                    (band.x()-roi.x())*roi.ny(),
+                                    band.npixels()});
+
+        _run_jobs(jobs,c,data);
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        void tiff_reader::_run_jobs(std::vector<read_job> &jobs,size_t c,
+                                    CTYPE &data)
+    {
+        using namespace pni::core;
+        typedef tiff::container_range<CTYPE> range_type;
+
+        std::ifstream &stream = this->_get_stream();
+        const file_map *map = this->_get_map();
+        string fname = this->filename();
+        size_t nthreads = std::min(worker_threads(_nthreads),jobs.size());
+
+        //without a memory map each worker reads through its own stream -
+        //the calling thread, worker 0, uses the stream of the reader
+        std::vector<std::ifstream> streams(map ? 0 : nthreads);
+        if(_decoders.size()<nthreads) _decoders.resize(nthreads);
+
+        parallel_for_worker(jobs.size(),nthreads,[&](size_t j,size_t w)
+        {
+            read_job &job = jobs[j];
+            range_type range(data.begin()+job.offset,job.size);
+            tiff::strip_decoder &decoder = job.tiled ? job.tiles.decoder() :
+                                                       job.strips.decoder();
+            _acquire_decoder(w,decoder);
+
+            if(map)
+            {
+                if(job.tiled)
+                    job.tiles.read(c,map->data(),map->size(),job.roi,range);
+                else
+                    job.strips.read(c,map->data(),map->size(),range);
+            }
+            else
+            {
+                std::ifstream *s = &stream;
+                if(w)
+                {
+                    s = &streams[w];
+                    if(!s->is_open())
+                    {
+                        s->open(fname.c_str(),std::ios::binary);
+                        if(!s->is_open())
+                            throw file_error(EXCEPTION_RECORD,
+                                    "Cannot open file ["+fname+"]!");
+                    }
+                }
+
+                if(job.tiled)
+                    job.tiles.read(c,*s,job.roi,range);
+                else
+                    job.strips.read(c,*s,range);
+            }
+
+            _release_decoder(w,decoder);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        void tiff_reader::images(CTYPE &data,size_t first,size_t last,size_t c)
+    {
+        using namespace pni::core;
+        if(first>last || last>nimages())
+        {
+            std::stringstream ss;
+            ss<<"Image range ["<<first<<","<<last<<") exceeds number of ";
+            ss<<"images ("<<nimages()<<")!";
+            throw index_error(EXCEPTION_RECORD,ss.str());
+        }
+        if(first == last) return;
+
+        size_t npixels = info(first).npixels();
+        for(size_t i=first+1;i<last;++i)
+            if(info(i).npixels() != npixels)
+                throw size_mismatch_error(EXCEPTION_RECORD,
+                        "Images in the range differ in size!");
+
+        if(data.size() != npixels*(last-first))
+        {
+            std::stringstream ss;
+            ss<<"Container size ("<<data.size()<<") does not match ";
+            ss<<"number of pixels ("<<npixels*(last-first)<<")!";
+            throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        _read_pages(first,last,c,data);
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        CTYPE tiff_reader::images(size_t first,size_t last,size_t c)
+    {
+        using namespace pni::core;
+        size_t npixels = first<last && last<=nimages() ? 
+                         info(first).npixels()*(last-first) : 0;
+        CTYPE data;
+        try { data = CTYPE(npixels); }
+        catch(...)
+        {
+            throw memory_allocation_error(EXCEPTION_RECORD,
+                    "Allocation of image data container failed!");
+        }
+
+        images(data,first,last,c);
+        return data;
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        void tiff_reader::image(CTYPE &data,size_t i,size_t c,
+                                const image_roi &roi)
+    {
+        using namespace pni::core;
+        if(i>=nimages())
+        {
+            std::stringstream ss;
+            ss<<"Image index "<<i<<" exceeds number of images (";
+            ss<<nimages()<<")!";
+            throw index_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        image_info info = this->info(i);
+        if(roi.x()+roi.nx()>info.nx() || roi.y()+roi.ny()>info.ny())
+        {
+            std::stringstream ss;
+            ss<<"Region "<<roi<<" exceeds image of "<<info.nx()<<"x";
+            ss<<info.ny()<<" pixels!";
+            throw index_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        if(data.size() != roi.npixels())
+        {
+            std::stringstream ss;
+            ss<<"Container size ("<<data.size()<<") does not match ";
+            ss<<"number of pixels in the region ("<<roi.npixels()<<")!";
+            throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        _read_roi(i,c,roi,data);
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE> 
+        CTYPE tiff_reader::image(size_t i,size_t c,const image_roi &roi)
+    {
+        using namespace pni::core;
+        CTYPE data;
+        try { data = CTYPE(roi.npixels()); }
+        catch(...)
+        {
+            throw memory_allocation_error(EXCEPTION_RECORD,
+                    "Allocation of image data container failed!");
+        }
+
+        image(data,i,c,roi);
+        return data;
     }
 //end of namespace
 }
@@ -0,0 +1,140 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+
+#include <algorithm>
+#include <pni/core/error.hpp>
+#include <pni/io/tiff/tile_reader.hpp>
+
+using namespace pni::core;
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //======================implementation of constructors=====================
+    tile_reader::tile_reader():
+        _nx(0),
+        _ny(0),
+        _tile_nx(1),
+        _tile_ny(1)
+    { }
+
+    //-------------------------------------------------------------------------
+    tile_reader::tile_reader(const std::vector<size_t> &offsets,
+                             const std::vector<size_t> &byte_counts,
+                             const std::vector<size_t> &bits_per_channel,
+                             const std::vector<type_id_t> &channel_types,
+                             size_t nx,size_t ny,size_t tile_nx,size_t tile_ny,
+                             const strip_decoder &decoder):
+        _offsets(offsets),
+        _byte_cnts(byte_counts),
+        _bits_per_channel(bits_per_channel),
+        _channel_types(channel_types),
+        _nx(nx),
+        _ny(ny),
+        _tile_nx(tile_nx),
+        _tile_ny(tile_ny),
+        _decoder(decoder)
+    { }
+
+    //=================implementation of static public methods=================
+    bool tile_reader::is_tiled(const ifd &image_dir)
+    {
+        return image_dir.has("TileOffsets");
+    }
+
+    //-------------------------------------------------------------------------
+    tile_reader tile_reader::create(std::ifstream &stream,const ifd &image_dir,
+                                    const image_info &info)
+    {
+        size_t tile_nx,tile_ny;
+        std::vector<size_t> offsets,byte_counts;
+
+        if(is_tiled(image_dir))
+        {
+            tile_nx = image_dir.value(stream,"TileLength",0);
+            tile_ny = image_dir.value(stream,"TileWidth",0);
+            offsets = image_dir.values(stream,"TileOffsets");
+            byte_counts = image_dir.values(stream,"TileByteCounts");
+        }
+        else
+        {
+            //strips are tiles with the width of the image
+            tile_nx = std::min(image_dir.value(stream,"RowsPerStrip",
+                                               info.nx()),
+                               info.nx());
+            tile_ny = info.ny();
+            offsets = image_dir.values(stream,"StripOffsets");
+            byte_counts = image_dir.values(stream,"StripByteCounts");
+        }
+
+        if(!tile_nx || !tile_ny)
+            throw file_error(EXCEPTION_RECORD,
+                    "Invalid tile or strip size in TIFF file!");
+
+        if(offsets.size() != byte_counts.size())
+            throw file_error(EXCEPTION_RECORD,
+                    "Number of tile offsets and byte counts differ!");
+
+        return tile_reader(offsets,byte_counts,info.bits_per_channel(),
+                           info.types_per_channel(),info.nx(),info.ny(),
+                           tile_nx,tile_ny,
+                           strip_decoder::create(stream,image_dir,info,
+                                                 tile_ny,tile_nx));
+    }
+
+    //=====================implementation of public methods====================
+    std::vector<image_roi> tile_reader::split(const image_roi &roi,
+                                              size_t n) const
+    {
+        std::vector<image_roi> bands;
+        if(!roi.npixels()) return bands;
+
+        size_t x1 = roi.x()+roi.nx();
+        size_t first = roi.x()/_tile_nx;
+        size_t ntiles = (x1-1)/_tile_nx+1-first;
+        n = std::max<size_t>(std::min(n,ntiles),1);
+
+        for(size_t band=0;band<n;++band)
+        {
+            size_t begin = std::max(roi.x(),(first+ntiles*band/n)*_tile_nx);
+            size_t end   = std::min(x1,(first+ntiles*(band+1)/n)*_tile_nx);
+            bands.push_back(image_roi(begin,roi.y(),end-begin,roi.ny()));
+        }
+        return bands;
+    }
+
+    //-------------------------------------------------------------------------
+    std::ostream &operator<<(std::ostream &o,const tile_reader &r)
+    {
+        o<<"Image of "<<r._nx<<"x"<<r._ny<<" pixels in "<<r.ntiles();
+        o<<" tiles of "<<r._tile_nx<<"x"<<r._tile_ny<<" pixels"<<std::endl;
+        o<<"Compression: "<<r._decoder.compression_scheme();
+        o<<" (predictor: "<<r._decoder.prediction()<<")"<<std::endl;
+        return o;
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,350 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/image_info.hpp>
+#include <pni/io/image_roi.hpp>
+#include <pni/io/tiff/ifd.hpp>
+#include <pni/io/tiff/compression.hpp>
+#include <pni/io/tiff/strip_reader.hpp>
+#include <pni/io/windows.hpp>
+
+namespace pni{
+namespace io{
+namespace tiff{
+
+    //!
+    //! \ingroup image_io_tiff
+    //! \brief reader for tiled image data
+    //!
+    //! Reads a region of interest from an image stored in tiles. Only the
+    //! tiles intersecting the region are read and decoded. Strips are
+    //! handled as tiles spanning the full width of the image, so this
+    //! class also reads regions of images stored in strips. For
+    //! uncompressed data only the rows of a strip or tile which are part
+    //! of the region are read.
+    //!
+    //! A reader must not be used by several threads at the same time.
+    //! Copies can be used concurrently.
+    //!
+    class PNIIO_EXPORT tile_reader
+    {
+        private:
+#ifdef _MSC_VER
+#pragma warning(disable:4251)
+#endif
+            std::vector<size_t> _offsets;   //!< file offsets of the tiles
+            std::vector<size_t> _byte_cnts; //!< byte counts of the tiles
+            std::vector<size_t> _bits_per_channel; //!< number of bits per channel
+            std::vector<pni::core::type_id_t> _channel_types; //!< type ids of channel data
+#ifdef _MSC_VER
+#pragma warning(default:4251)
+#endif
+            size_t _nx;      //!< number of rows of the image
+            size_t _ny;      //!< number of columns of the image
+            size_t _tile_nx; //!< number of rows of a tile
+            size_t _tile_ny; //!< number of columns of a tile
+            mutable strip_decoder _decoder; //!< decoder for compressed tiles
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a region of interest
+            //!
+            //! \throws file_error if reading or decoding a tile fails
+            //! \tparam IT data type used in the image file
+            //! \tparam CTYPE container type where the data should be stored
+            //! \tparam ARGS source of the data (stream or buffer and size)
+            //! \param c number of the channel to read
+            //! \param roi region of interest
+            //! \param data target container
+            //! \param args data source
+            //!
+            template<
+                     typename IT,
+                     typename CTYPE,
+                     typename ...ARGS
+                    >
+            void _read_roi(size_t c,const image_roi &roi,CTYPE &data,
+                           ARGS &&...args) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief dispatch on the channel type
+            //!
+            //! \throws type_error if the image data type is unkown
+            //! \tparam CTYPE container type where the data should be stored
+            //! \tparam ARGS source of the data (stream or buffer and size)
+            //! \param c number of the channel to read
+            //! \param roi region of interest
+            //! \param data target container
+            //! \param args data source
+            //!
+            template<typename CTYPE,typename ...ARGS>
+            void _dispatch(size_t c,const image_roi &roi,CTYPE &data,
+                           ARGS &&...args) const;
+
+        public:
+            //====================constructors and destructor==================
+            //! default constructor
+            tile_reader();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief standard constructor
+            //!
+            //! \param offsets file offsets of the tiles in row major order
+            //! \param byte_counts byte counts of the tiles
+            //! \param bits_per_channel number of bits per channel
+            //! \param channel_types type ids of the channels
+            //! \param nx number of rows of the image
+            //! \param ny number of columns of the image
+            //! \param tile_nx number of rows of a tile
+            //! \param tile_ny number of columns of a tile
+            //! \param decoder decoder for compressed tiles
+            //!
+            tile_reader(const std::vector<size_t> &offsets,
+                        const std::vector<size_t> &byte_counts,
+                        const std::vector<size_t> &bits_per_channel,
+                        const std::vector<pni::core::type_id_t> &channel_types,
+                        size_t nx,size_t ny,size_t tile_nx,size_t tile_ny,
+                        const strip_decoder &decoder = strip_decoder());
+
+            //===========static public member functions=========================
+            //!
+            //! \brief check for a tiled image
+            //!
+            //! \param image_dir IFD of the image
+            //! \return true if the image is stored in tiles
+            //!
+            static bool is_tiled(const ifd &image_dir);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create a reader
+            //!
+            //! Creates a reader from the IFD of an image. The TileWidth,
+            //! TileLength, TileOffsets and TileByteCounts entries are used
+            //! for tiled images, the RowsPerStrip, StripOffsets and
+            //! StripByteCounts entries otherwise.
+            //!
+            //! \throws not_implemented_error if the compression scheme or
+            //! predictor is not supported
+            //! \throws file_error if the layout entries are inconsistent
+            //! \param stream input stream from which to read data
+            //! \param image_dir IFD of the image
+            //! \param info image information
+            //! \return reader instance
+            //!
+            static tile_reader create(std::ifstream &stream,
+                                      const ifd &image_dir,
+                                      const image_info &info);
+
+            //=====================public member methods========================
+            //! get number of tiles
+            size_t ntiles() const { return _offsets.size(); }
+
+            //-----------------------------------------------------------------
+            //! get number of rows of a tile
+            size_t tile_nx() const { return _tile_nx; }
+
+            //-----------------------------------------------------------------
+            //! get number of columns of a tile
+            size_t tile_ny() const { return _tile_ny; }
+
+            //-----------------------------------------------------------------
+            //! get the decoder for compressed tiles
+            strip_decoder &decoder() { return _decoder; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief split a region of interest
+            //!
+            //! Splits a region into at most n bands of rows. Band borders
+            //! coincide with tile borders so that no tile has to be decoded
+            //! for two bands.
+            //!
+            //! \param roi region of interest
+            //! \param n maximum number of bands
+            //! \return bands in ascending order
+            //!
+            std::vector<image_roi> split(const image_roi &roi,size_t n) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a region of interest from a stream
+            //!
+            //! The data is stored row by row with roi.ny() pixels per row.
+            //! The region must be inside the image and the container must
+            //! hold roi.npixels() elements.
+            //!
+            //! \throws type_error if the image data type is unkown
+            //! \throws file_error if reading or decoding fails
+            //! \param c number of the channel to read
+            //! \param stream input stream from which to read data
+            //! \param roi region of interest
+            //! \param data container where to store the data
+            //!
+            template<typename CTYPE>
+            void read(size_t c,std::ifstream &stream,const image_roi &roi,
+                      CTYPE &data)
+            {
+                _dispatch(c,roi,data,stream);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief read a region of interest from memory
+            //!
+            //! \throws type_error if the image data type is unkown
+            //! \throws file_error if a tile exceeds the buffer or decoding
+            //! fails
+            //! \param c number of the channel to read
+            //! \param buffer pointer to the first byte of the file
+            //! \param size size of the buffer in bytes
+            //! \param roi region of interest
+            //! \param data container where to store the data
+            //!
+            template<typename CTYPE>
+            void read(size_t c,const char *buffer,size_t size,
+                      const image_roi &roi,CTYPE &data)
+            {
+                _dispatch(c,roi,data,buffer,size);
+            }
+
+            //=====================output operator==============================
+            //! output operator
+            friend PNIIO_EXPORT std::ostream &operator<<(std::ostream &o,
+                                                         const tile_reader &r);
+    };
+
+    //-------------------------------------------------------------------------
+    template<typename CTYPE,typename ...ARGS>
+        void tile_reader::_dispatch(size_t c,const image_roi &roi,CTYPE &data,
+                                    ARGS &&...args) const
+    {
+        using namespace pni::core;
+
+        if(_channel_types[c] == type_id_t::UINT8)
+            _read_roi<uint8>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::INT8)
+            _read_roi<int8>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::UINT16)
+            _read_roi<uint16>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::INT16)
+            _read_roi<int16>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::UINT32)
+            _read_roi<uint32>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::INT32)
+            _read_roi<int32>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::UINT64)
+            _read_roi<uint64>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::INT64)
+            _read_roi<int64>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::FLOAT32)
+            _read_roi<float32>(c,roi,data,args...);
+        else if(_channel_types[c] == type_id_t::FLOAT64)
+            _read_roi<float64>(c,roi,data,args...);
+        else
+            throw type_error(EXCEPTION_RECORD,
+                  "TileReader cannot handle channel type!");
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename IT,typename CTYPE,typename ...ARGS>
+        void tile_reader::_read_roi(size_t channel,const image_roi &roi,
+                                    CTYPE &data,ARGS &&...args) const
+    {
+        using namespace pni::core;
+        typedef typename CTYPE::value_type value_type;
+        if(!roi.npixels()) return;
+
+        size_t pixel_size = std::accumulate(_bits_per_channel.begin(),
+                                            _bits_per_channel.end(),0)/8;
+        size_t sample_offset = std::accumulate(_bits_per_channel.begin(),
+                                               _bits_per_channel.begin()+channel,
+                                               0)/8;
+        size_t row_size     = _tile_ny*pixel_size;
+        size_t tiles_across = (_ny+_tile_ny-1)/_tile_ny;
+
+        size_t roi_x1 = roi.x()+roi.nx();
+        size_t roi_y1 = roi.y()+roi.ny();
+        for(size_t tx=roi.x()/_tile_nx;tx<=(roi_x1-1)/_tile_nx;++tx)
+        {
+            for(size_t ty=roi.y()/_tile_ny;ty<=(roi_y1-1)/_tile_ny;++ty)
+            {
+                size_t tile = tx*tiles_across+ty;
+                if(tile>=_offsets.size())
+                    throw file_error(EXCEPTION_RECORD,
+                            "Tile is missing in TIFF file!");
+
+                //intersection of the tile with the region
+                size_t x0 = tx*_tile_nx, y0 = ty*_tile_ny;
+                size_t xb = std::max(roi.x(),x0);
+                size_t xe = std::min(roi_x1,x0+_tile_nx);
+                size_t yb = std::max(roi.y(),y0);
+                size_t n  = std::min(roi_y1,y0+_tile_ny)-yb;
+
+                //offsets of the first and after the last needed byte
+                size_t first = (xb-x0)*row_size+(yb-y0)*pixel_size;
+                size_t last  = (xe-1-x0)*row_size+(yb-y0+n)*pixel_size;
+
+                const char *src;
+                if(_decoder.is_active())
+                {
+                    size_t nbytes = _decoder.decode(args...,_offsets[tile],
+                                                    _byte_cnts[tile]);
+                    if(last>nbytes)
+                        throw file_error(EXCEPTION_RECORD,
+                                "Decoded tile is too small!");
+                    src = _decoder.data()+first;
+                }
+                else
+                {
+                    if(last>_byte_cnts[tile])
+                        throw file_error(EXCEPTION_RECORD,
+                                "Tile is too small for the image!");
+                    //only the rows needed are read
+                    src = _decoder.fetch(args...,_offsets[tile]+first,
+                                         last-first);
+                }
+
+                for(size_t x=xb;x<xe;++x)
+                    convert_samples<IT,value_type>(
+                            src+(x-xb)*row_size+sample_offset,n,pixel_size,
+                            data.begin()+((x-roi.x())*roi.ny()+yb-roi.y()));
+            }
+        }
+    }
+
+//end of namespace
+}
+}
+}
@@ -0,0 +1,89 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+//!
+//! \brief simple wall clock timer
+//!
+class benchmark_timer
+{
+    private:
+        typedef std::chrono::high_resolution_clock clock_type;
+        clock_type::time_point _start;
+    public:
+        benchmark_timer():_start(clock_type::now()) {}
+
+        //! restart the timer
+        void reset() { _start = clock_type::now(); }
+
+        //! return the time elapsed since construction or the last reset in s
+        double seconds() const
+        {
+            return std::chrono::duration<double>(clock_type::now()-_start).count();
+        }
+};
+
+//----------------------------------------------------------------------------
+//!
+//! \brief run a function n times and return the total time in seconds
+//!
+template<typename FUNC>
+double run_benchmark(size_t n,FUNC &&f)
+{
+    f(); //warm up caches and allocators
+
+    benchmark_timer timer;
+    for(size_t i=0;i<n;++i) f();
+    return timer.seconds();
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief print the header of a result table
+//!
+inline void print_header(const std::string &title)
+{
+    std::printf("\n%s\n",title.c_str());
+    std::printf("%-32s %12s %12s %12s\n","case","time [ms]","MB/s","items/s");
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief print a single result line
+//!
+//! \param name name of the benchmark case
+//! \param seconds total time for all repetitions
+//! \param nruns number of repetitions
+//! \param nbytes number of bytes processed per repetition
+//! \param nitems number of items (frames, records, ...) per repetition
+//!
+inline void print_result(const std::string &name,double seconds,size_t nruns,
+                         size_t nbytes,size_t nitems=1)
+{
+    double t = seconds/nruns;
+    std::printf("%-32s %12.3f %12.1f %12.1f\n",name.c_str(),t*1e3,
+                nbytes/t/1e6,nitems/t);
+}
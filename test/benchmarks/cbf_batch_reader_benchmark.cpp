@@ -0,0 +1,84 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark comparing a sequential loop over cbf_reader::image with the
+// parallel cbf_batch_reader. A scan of synthetic Pilatus 1M frames is
+// written to the current directory before the benchmark runs.
+//
+// usage: cbf_batch_reader_benchmark [nframes]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/cbf/cbf_batch_reader.hpp>
+
+#include "benchmark_utils.hpp"
+#include "cbf_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+typedef std::vector<int32> frame_type;
+
+static const size_t nx = 1043;
+static const size_t ny = 981;
+
+int main(int argc,char **argv)
+{
+    size_t nframes = argc>1 ? std::atoi(argv[1]) : 200;
+
+    auto files = cbf::file_sequence("cbf_batch_benchmark_%05d.cbf",0,nframes-1);
+    size_t nbytes = 0;
+    for(size_t i=0;i<files.size();++i)
+        nbytes += write_cbf_file(files[i],nx,ny,synthetic_frame(nx,ny,i));
+
+    print_header("reading "+std::to_string(nframes)+" frames (MB/s, frames/s)");
+
+    double t = run_benchmark(1,[&]()
+    {
+        frame_type frame(nx*ny);
+        for(const auto &file: files)
+        {
+            cbf_reader reader(file);
+            reader.image(frame,0);
+        }
+    });
+    print_result("sequential cbf_reader",t,1,nbytes,nframes);
+
+    size_t ncores = std::max(std::thread::hardware_concurrency(),1u);
+    for(size_t nthreads=1;nthreads<=ncores;nthreads*=2)
+    {
+        t = run_benchmark(1,[&]()
+        {
+            cbf_batch_reader<frame_type> reader(files,nthreads);
+            frame_type frame;
+            while(reader.next(frame));
+        });
+        print_result("cbf_batch_reader "+std::to_string(nthreads)+" threads",
+                     t,1,nbytes,nframes);
+    }
+
+    for(const auto &file: files) std::remove(file.c_str());
+    return 0;
+}
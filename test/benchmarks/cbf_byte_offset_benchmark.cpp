@@ -0,0 +1,108 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for the CBF byte offset decoder. A synthetic Pilatus 6M frame
+// is decoded from memory and read via cbf_reader for several container
+// types.
+//
+// usage: cbf_byte_offset_benchmark [nruns]
+//
+
+#include <cstdlib>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/cbf/cbf_reader.hpp>
+#include <pni/io/cbf/byte_offset.hpp>
+
+#include "benchmark_utils.hpp"
+#include "cbf_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nx = 2527;
+static const size_t ny = 2463;
+static const std::string fname = "cbf_byte_offset_benchmark.cbf";
+
+template<typename CTYPE>
+void benchmark_decoder(const std::string &name,const std::string &buffer,
+                       size_t nruns)
+{
+    CTYPE data(nx*ny);
+    double t = run_benchmark(nruns,[&]()
+    {
+        cbf::decode_byte_offset(buffer.data(),buffer.size(),data);
+    });
+    print_result(name,t,nruns,buffer.size());
+}
+
+void benchmark_kernel(const std::string &name,cbf::simd_extension ext,
+                      const std::string &buffer,size_t nruns)
+{
+    if(!cbf::byte_offset_simd_supported(ext)) return;
+
+    std::vector<int32> data(nx*ny);
+    double t = run_benchmark(nruns,[&]()
+    {
+        cbf::decode_byte_offset(ext,buffer.data(),buffer.size(),
+                                data.data(),data.size());
+    });
+    print_result(name,t,nruns,buffer.size());
+}
+
+template<typename CTYPE>
+void benchmark_reader(const std::string &name,size_t nbytes,size_t nruns)
+{
+    cbf_reader reader(fname);
+    CTYPE data(nx*ny);
+    double t = run_benchmark(nruns,[&]() { reader.image(data,0); });
+    print_result(name,t,nruns,nbytes);
+}
+
+int main(int argc,char **argv)
+{
+    size_t nruns = argc>1 ? std::atoi(argv[1]) : 20;
+
+    auto frame = synthetic_frame(nx,ny);
+    std::string buffer = encode_byte_offset(frame);
+    size_t nbytes = write_cbf_file(fname,nx,ny,frame);
+
+    print_header("decoder kernels (MB/s of compressed data, frames/s)");
+    benchmark_kernel("scalar",cbf::simd_extension::NONE,buffer,nruns);
+    benchmark_kernel("SSE2",cbf::simd_extension::SSE2,buffer,nruns);
+    benchmark_kernel("AVX2",cbf::simd_extension::AVX2,buffer,nruns);
+
+    print_header("decode from memory (MB/s of compressed data, frames/s)");
+    benchmark_decoder<std::vector<int32>>("std::vector<int32>",buffer,nruns);
+    benchmark_decoder<std::vector<uint32>>("std::vector<uint32>",buffer,nruns);
+    benchmark_decoder<std::vector<int64>>("std::vector<int64>",buffer,nruns);
+    benchmark_decoder<std::vector<float32>>("std::vector<float32>",buffer,nruns);
+    benchmark_decoder<std::vector<float64>>("std::vector<float64>",buffer,nruns);
+
+    print_header("cbf_reader::image (MB/s of compressed data, frames/s)");
+    benchmark_reader<std::vector<int32>>("std::vector<int32>",nbytes,nruns);
+    benchmark_reader<std::vector<uint32>>("std::vector<uint32>",nbytes,nruns);
+    benchmark_reader<std::vector<int64>>("std::vector<int64>",nbytes,nruns);
+    benchmark_reader<std::vector<float32>>("std::vector<float32>",nbytes,nruns);
+    benchmark_reader<std::vector<float64>>("std::vector<float64>",nbytes,nruns);
+
+    return 0;
+}
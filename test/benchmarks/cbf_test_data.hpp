@@ -0,0 +1,141 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+#pragma once
+
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <pni/core/types.hpp>
+
+//!
+//! \brief generate a synthetic detector frame
+//!
+//! The frame consists of a low background with Poisson noise and a few
+//! bright spots. Most differences between neighbouring pixels thus fit into
+//! a single byte while some require the 2Byte and 4Byte escapes.
+//!
+inline std::vector<pni::core::int32> synthetic_frame(size_t nx,size_t ny,
+                                                     unsigned seed=1)
+{
+    using namespace pni::core;
+    std::mt19937 engine(seed);
+    std::poisson_distribution<int32> background(20);
+    std::uniform_real_distribution<double> spot(0.0,1.0);
+
+    std::vector<int32> frame(nx*ny);
+    for(auto &p: frame)
+    {
+        p = background(engine);
+        double r = spot(engine);
+        if(r<0.001)       p += 100000;
+        else if(r<0.01)   p += 1000;
+    }
+    return frame;
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief byte offset compression
+//!
+//! Reference encoder for the CBF byte offset algorithm.
+//!
+inline std::string encode_byte_offset(const std::vector<pni::core::int32> &data)
+{
+    using namespace pni::core;
+    std::string buffer;
+    buffer.reserve(data.size());
+    int64 previous = 0;
+
+    auto append = [&buffer](int64 v,size_t n)
+    {
+        for(size_t i=0;i<n;++i)
+            buffer.push_back(static_cast<char>((static_cast<uint64>(v)>>(8*i))&0xFF));
+    };
+
+    for(auto p: data)
+    {
+        int64 delta = p-previous;
+        previous = p;
+
+        if(delta>-128 && delta<128) { append(delta,1); continue; }
+        buffer.push_back(static_cast<char>(0x80));
+        if(delta>-32768 && delta<32768) { append(delta,2); continue; }
+        append(-32768,2);
+        if(delta>-2147483647-1 && delta<=2147483647) { append(delta,4); continue; }
+        append(-2147483647-1,4);
+        append(delta,8);
+    }
+    return buffer;
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief write a minimal DECTRIS style CBF file
+//!
+//! \param fname name of the output file
+//! \param nx number of pixels along the slow dimension
+//! \param ny number of pixels along the fast dimension
+//! \param data uncompressed frame
+//! \return size of the binary section in bytes
+//!
+inline size_t write_cbf_file(const std::string &fname,size_t nx,size_t ny,
+                             const std::vector<pni::core::int32> &data)
+{
+    std::string binary = encode_byte_offset(data);
+
+    std::ofstream stream(fname.c_str(),std::ios::binary);
+    stream<<"###CBF: VERSION 1.5, CBFlib v0.7.8 - SLS/DECTRIS PILATUS detectors\r\n"
+          <<"\r\n"
+          <<"data_benchmark\r\n"
+          <<"\r\n"
+          <<"_array_data.header_convention \"SLS/DECTRIS_1.1\"\r\n"
+          <<"_array_data.header_contents\r\n"
+          <<";\r\n"
+          <<"# Detector: PILATUS 6M, S/N 60-0001\r\n"
+          <<"# 2026-Oct-17T12:00:00.000\r\n"
+          <<"# Exposure_time 0.0970000 s\r\n"
+          <<"# Exposure_period 0.1000000 s\r\n"
+          <<";\r\n"
+          <<"\r\n"
+          <<"_array_data.data\r\n"
+          <<";\r\n"
+          <<"--CIF-BINARY-FORMAT-SECTION--\r\n"
+          <<"Content-Type: application/octet-stream;\r\n"
+          <<"     conversions=\"x-CBF_BYTE_OFFSET\"\r\n"
+          <<"Content-Transfer-Encoding: BINARY\r\n"
+          <<"X-Binary-Size: "<<binary.size()<<"\r\n"
+          <<"X-Binary-ID: 1\r\n"
+          <<"X-Binary-Element-Type: \"signed 32-bit integer\"\r\n"
+          <<"X-Binary-Element-Byte-Order: LITTLE_ENDIAN\r\n"
+          <<"X-Binary-Number-of-Elements: "<<data.size()<<"\r\n"
+          <<"X-Binary-Size-Fastest-Dimension: "<<ny<<"\r\n"
+          <<"X-Binary-Size-Second-Dimension: "<<nx<<"\r\n"
+          <<"X-Binary-Size-Padding: 4095\r\n"
+          <<"\r\n"
+          <<"\x0c\x1a\x04\xd5";
+    stream.write(binary.data(),binary.size());
+    stream<<std::string(4095,'\0')
+          <<"\r\n--CIF-BINARY-FORMAT-SECTION----\r\n;\r\n\r\n";
+    return binary.size();
+}
@@ -0,0 +1,97 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark comparing the stream and the memory map backend of data_reader
+// for CBF and TIFF files. Each case is run once with a reader which is 
+// kept open and once opening a new reader for every image.
+//
+// usage: data_reader_backend_benchmark [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/cbf/cbf_reader.hpp>
+#include <pni/io/tiff/tiff_reader.hpp>
+
+#include "benchmark_utils.hpp"
+#include "cbf_test_data.hpp"
+#include "tiff_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nx = 2527;
+static const size_t ny = 2463;
+
+template<typename READER,typename CTYPE>
+void benchmark_backend(const std::string &name,const std::string &fname,
+                       bool mmap,size_t nruns,size_t nbytes)
+{
+    const char *backend = mmap ? " (mmap)" : " (stream)";
+    CTYPE data(nx*ny);
+
+    READER reader(fname);
+    reader.use_mmap(mmap);
+    double t = run_benchmark(nruns,[&]() { reader.image(data,0); });
+    print_result(name+backend,t,nruns,nbytes);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        READER r(fname);
+        r.use_mmap(mmap);
+        r.image(data,0);
+    });
+    print_result(name+" open"+backend,t,nruns,nbytes);
+}
+
+int main(int argc,char **argv)
+{
+    size_t nruns = argc>1 ? std::atoi(argv[1]) : 20;
+
+    std::vector<int32> frame = synthetic_frame(nx,ny);
+    size_t cbf_size = write_cbf_file("data_reader_benchmark.cbf",nx,ny,frame);
+
+    std::vector<uint16> frame16(frame.begin(),frame.end());
+    size_t tiff16_size = write_tiff_file("data_reader_benchmark_16.tiff",nx,ny,
+                                         frame16,16);
+    size_t tiff32_size = write_tiff_file("data_reader_benchmark_32.tiff",nx,ny,
+                                         frame,16);
+
+    print_header("data_reader backends");
+    for(bool mmap: {false,true})
+    {
+        benchmark_backend<cbf_reader,std::vector<int32>>(
+                "cbf int32","data_reader_benchmark.cbf",mmap,nruns,cbf_size);
+        benchmark_backend<tiff_reader,std::vector<uint16>>(
+                "tiff uint16","data_reader_benchmark_16.tiff",mmap,nruns,
+                tiff16_size);
+        benchmark_backend<tiff_reader,std::vector<int32>>(
+                "tiff int32","data_reader_benchmark_32.tiff",mmap,nruns,
+                tiff32_size);
+    }
+
+    std::remove("data_reader_benchmark.cbf");
+    std::remove("data_reader_benchmark_16.tiff");
+    std::remove("data_reader_benchmark_32.tiff");
+    return 0;
+}
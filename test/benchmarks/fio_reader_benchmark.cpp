@@ -0,0 +1,159 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for parsing large FIO files. A file with FLOAT and DOUBLE
+// columns, formatted like the files written by ONLINE, is generated and the
+// time to open (and thus parse) the file and to read a column is measured.
+// In lazy mode opening and reading two columns is measured. Parsing is 
+// measured with 1, 2, 4, ... threads up to the number of cores.
+//
+// usage: fio_reader_benchmark [size in MB] [nruns] [max. threads]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/fio/fio_reader.hpp>
+#include <pni/io/parallel_for.hpp>
+
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nfloat_columns  = 12;
+static const size_t ndouble_columns = 2;
+
+//----------------------------------------------------------------------------
+// write a FIO file of approximately size bytes and return the number of 
+// records
+size_t write_fio_file(const std::string &fname,size_t size)
+{
+    std::FILE *file = std::fopen(fname.c_str(),"w");
+    std::fprintf(file,"!\n! Comments\n!\n%%c\nbenchmark file\n!\n"
+                      "! Parameters\n!\n%%p\nsweepMotor=mot01\n"
+                      "sweepOffset=0.005\n!\n! Data\n!\n%%d\n");
+    for(size_t c=0;c<nfloat_columns;++c)
+        std::fprintf(file," Col %d counter_%02d FLOAT\n",int(c+1),int(c));
+    for(size_t c=0;c<ndouble_columns;++c)
+        std::fprintf(file," Col %d position_%02d DOUBLE\n",
+                     int(nfloat_columns+c+1),int(c));
+
+    size_t nrecords = 0;
+    long written = std::ftell(file);
+    while(size_t(written)<size)
+    {
+        for(size_t c=0;c<nfloat_columns;++c)
+            written += std::fprintf(file," %15.6g",
+                                    double((nrecords*7+c*13)%100000)*0.37);
+        for(size_t c=0;c<ndouble_columns;++c)
+            written += std::fprintf(file," %22.15g",
+                                    1e-3*double(nrecords)+c+1.0/3.0);
+        written += std::fprintf(file,"\n");
+        ++nrecords;
+    }
+
+    std::fclose(file);
+    return nrecords;
+}
+
+int main(int argc,char **argv)
+{
+    size_t size  = size_t(argc>1 ? std::atoi(argv[1]) : 1024)*1024*1024;
+    size_t nruns = argc>2 ? std::atoi(argv[2]) : 1;
+    size_t max_threads = worker_threads(argc>3 ? std::atoi(argv[3]) : 0);
+
+    std::string fname = "fio_reader_benchmark.fio";
+    size_t nrecords = write_fio_file(fname,size);
+
+    print_header("FIO file with "+std::to_string(nrecords)+" records");
+
+    double t = run_benchmark(nruns,[&]()
+    {
+        fio_reader reader(fname);
+        if(reader.nrecords()!=nrecords)
+            std::printf("wrong number of records %d!\n",int(reader.nrecords()));
+    });
+    print_result("open and parse",t,nruns,size,nrecords);
+
+    for(size_t nthreads=2;nthreads<=max_threads;nthreads*=2)
+    {
+        t = run_benchmark(nruns,[&]() { fio_reader reader(fname,false,nthreads); });
+        print_result("open and parse "+std::to_string(nthreads)+" threads",
+                     t,nruns,size,nrecords);
+    }
+
+    fio_reader reader(fname);
+    std::vector<float64> data;
+    for(std::string name: {"counter_00","position_00"})
+    {
+        t = run_benchmark(nruns,[&]() 
+        { 
+            data = reader.column<std::vector<float64>>(name); 
+        });
+        print_result("read column "+name,t,nruns,data.size()*sizeof(float64),
+                     nrecords);
+    }
+
+    //summing a column through a view does not allocate
+    volatile float64 sum = 0;
+    t = run_benchmark(nruns,[&]()
+    {
+        float64 s = 0;
+        for(auto value: reader.view<float32>("counter_00")) s += value;
+        sum = s;
+    });
+    print_result("sum view<float32> counter_00",t,nruns,
+                 nrecords*sizeof(float32),nrecords);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        float64 s = 0;
+        for(auto value: reader.view<float64>("counter_00")) s += value;
+        sum = s;
+    });
+    print_result("sum view<float64> counter_00",t,nruns,
+                 nrecords*sizeof(float32),nrecords);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        float64 s = 0;
+        for(auto record: reader.records<float64>({"position_00","counter_01"}))
+            s += record[0]*record[1];
+        sum = s;
+    });
+    print_result("records 2 columns",t,nruns,
+                 nrecords*(sizeof(float64)+sizeof(float32)),nrecords);
+
+    t = run_benchmark(nruns,[&]() { fio_reader lazy(fname,true); });
+    print_result("open lazy",t,nruns,size,nrecords);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        fio_reader lazy(fname,true);
+        lazy.columns<std::vector<float64>>({"position_00","counter_05"});
+    });
+    print_result("open lazy and read 2 columns",t,nruns,size,nrecords);
+
+    std::remove(fname.c_str());
+    return 0;
+}
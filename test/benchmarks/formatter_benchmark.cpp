@@ -0,0 +1,160 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Micro-benchmark for the formatters. A vector of random numbers is written
+// with boost::format and string concatenation (the former implementation of
+// format()), with format() and by appending to a reused string with
+// format_to(). Finally a float64 matrix is written with array_writer to a
+// stream discarding the output, with full and with reduced precision.
+//
+// usage: formatter_benchmark [number of values] [nruns]
+//
+
+#include <cstdlib>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/io/formatters.hpp>
+
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+//----------------------------------------------------------------------------
+// the former implementation of format for a vector
+template<typename T>
+string boost_format(const std::vector<T> &v,const char *format_string)
+{
+    string output;
+    for(const auto &value: v)
+    {
+        boost::format fmt(format_string);
+        fmt % value;
+        output += fmt.str()+string(1,' ');
+    }
+    return string(output.begin(),--output.end());
+}
+
+//----------------------------------------------------------------------------
+// stream buffer counting and discarding all characters
+class null_buffer : public std::streambuf
+{
+    public:
+        size_t count = 0;
+    protected:
+        std::streamsize xsputn(const char *,std::streamsize n) override
+        {
+            count += n;
+            return n;
+        }
+
+        int_type overflow(int_type c) override
+        {
+            ++count;
+            return c;
+        }
+};
+
+//----------------------------------------------------------------------------
+void run_writer(const std::string &name,const format_config &config,size_t n,
+                size_t nruns)
+{
+    typedef dynamic_array<float64> array_type;
+
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<float64> distribution(-1e6,1e6);
+    size_t ncolumns = 1000;
+    size_t nrows = n/ncolumns ? n/ncolumns : 1;
+    auto data = array_type::create(shape_t{nrows,ncolumns});
+    for(auto &value: data) value = distribution(generator);
+
+    null_buffer buffer;
+    std::ostream stream(&buffer);
+    double t = run_benchmark(nruns,[&]()
+    {
+        buffer.count = 0;
+        array_writer writer(stream,container_io_config(),config);
+        writer.write(data);
+        writer.flush();
+    });
+    print_result(name,t,nruns,buffer.count,data.size());
+}
+
+//----------------------------------------------------------------------------
+template<typename T,typename DIST>
+void run(const std::string &name,const char *format_string,DIST distribution,
+         size_t n,size_t nruns)
+{
+    std::mt19937_64 generator(1);
+    std::vector<T> input;
+    for(size_t i=0;i<n;++i) input.push_back(T(distribution(generator)));
+
+    size_t nbytes = format(input).size();
+
+    double t = run_benchmark(nruns,[&]()
+    {
+        volatile size_t size = boost_format(input,format_string).size();
+        (void)size;
+    });
+    print_result(name+" boost::format",t,nruns,nbytes,n);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        volatile size_t size = format(input).size();
+        (void)size;
+    });
+    print_result(name+" format",t,nruns,nbytes,n);
+
+    string output;
+    t = run_benchmark(nruns,[&]()
+    {
+        output.clear();
+        format_to(output,input);
+    });
+    print_result(name+" format_to",t,nruns,nbytes,n);
+}
+
+int main(int argc,char **argv)
+{
+    size_t n     = argc>1 ? std::atoi(argv[1]) : 1000000;
+    size_t nruns = argc>2 ? std::atoi(argv[2]) : 3;
+
+    print_header("formatting "+std::to_string(n)+" values");
+    run<int32>("int32","%|+|",
+               std::uniform_int_distribution<int32>(-1000000,1000000),
+               n,nruns);
+    run<uint64>("uint64","%|+|",std::uniform_int_distribution<uint64>(),
+                n,nruns);
+    run<float64>("float64","%|+.17e|",
+                 std::uniform_real_distribution<float64>(-1e6,1e6),
+                 n,nruns);
+
+    print_header("writing "+std::to_string(n)+" float64 values to a stream");
+    run_writer("array_writer full precision",format_config(),n,nruns);
+    run_writer("array_writer precision 6",format_config(6),n,nruns);
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for the lexical classification of mixed input as done by
+// parser<value>. Integers, floats, complex numbers, boolean values,
+// slices and invalid strings are classified with the default regular
+// expressions (the former implementation of parser<value> and of the
+// is_ functions in parsers/utils.hpp) and with classify(). The last case
+// includes the conversion of numbers as done by parser<value>.
+//
+// usage: lexical_classifier_benchmark [number of strings] [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/parsers/parser.hpp>
+#include <pni/io/parsers/utils.hpp>
+
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+//----------------------------------------------------------------------------
+// generate n strings of mixed type
+std::vector<std::string> make_input(size_t n)
+{
+    static const char *samples[] = {"12345","-42","+7","1.2345e+03","-0.5",
+                                    "3.14159","1.3+I3.4","-j3.9","1.+i4.",
+                                    "true","False","1:10:2","0:5","12a",
+                                    "1e5","hello"};
+    const size_t nsamples = sizeof(samples)/sizeof(samples[0]);
+
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<size_t> index(0,nsamples-1);
+
+    std::vector<std::string> input;
+    for(size_t i=0;i<n;++i) input.push_back(samples[index(generator)]);
+    return input;
+}
+
+int main(int argc,char **argv)
+{
+    size_t n     = argc>1 ? std::atoi(argv[1]) : 1000000;
+    size_t nruns = argc>2 ? std::atoi(argv[2]) : 3;
+
+    auto input = make_input(n);
+    size_t nbytes = 0;
+    for(const auto &s: input) nbytes += s.size();
+
+    print_header("classifying "+std::to_string(n)+" mixed values");
+    volatile size_t count = 0;
+
+    double t = run_benchmark(nruns,[&]()
+    {
+        size_t c = 0;
+        for(const auto &s: input)
+        {
+            if(boost::regex_match(s,default_int_regexp)) c += 1;
+            else if(boost::regex_match(s,default_float_regexp)) c += 2;
+            else if(boost::regex_match(s,default_complex_regexp)) c += 3;
+        }
+        count = c;
+    });
+    print_result("regex int/float/complex",t,nruns,nbytes,n);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        size_t c = 0;
+        for(const auto &s: input)
+        {
+            //the former is_boolean and is_slice compiled their expression
+            //on every call
+            boost::regex boolean("^T(rue|RUE)|true|1|F(alse|ALSE)|false|0$");
+            boost::regex slice("^\\d+:(\\d*(:\\d+)?)?$");
+            if(boost::regex_match(s,boolean)) c += 1;
+            else if(boost::regex_match(s,slice)) c += 2;
+        }
+        count = c;
+    });
+    print_result("regex boolean/slice",t,nruns,nbytes,n);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        size_t c = 0;
+        for(const auto &s: input)
+            c += classify(s.data(),s.data()+s.size()).classes;
+        count = c;
+    });
+    print_result("classify",t,nruns,nbytes,n);
+
+    parser<int64> int_parser;
+    parser<float64> float_parser;
+    t = run_benchmark(nruns,[&]()
+    {
+        float64 sum = 0;
+        for(const auto &s: input)
+        {
+            const char *first = s.data(), *last = first+s.size();
+            lexical_info info = classify(first,last);
+            if(info.is(lexical_class::INTEGER))
+            {
+                int64 v;
+                if(int_parser.parse(first,last,v)==std::errc()) sum += v;
+            }
+            else if(info.is(lexical_class::FLOAT))
+            {
+                float64 v;
+                if(float_parser.parse(first,last,v)==std::errc()) sum += v;
+            }
+            else if(info.is(lexical_class::COMPLEX))
+            {
+                float64 v;
+                if(float_parser.parse(info.imag_first,info.imag_last,v)==std::errc())
+                    sum += v;
+            }
+        }
+        count = size_t(sum);
+    });
+    print_result("classify and convert",t,nruns,nbytes,n);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Micro-benchmark for nexus::Path. For the common path operations the
+// time and the number of heap allocations per operation are reported.
+// Allocations are counted by replacing the global operator new.
+//
+// usage: nexus_path_benchmark [number of operations] [nruns]
+//
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <pni/io/nexus/path.hpp>
+
+#include "benchmark_utils.hpp"
+
+using namespace pni::io::nexus;
+
+static std::atomic<size_t> allocation_count(0);
+
+void *operator new(std::size_t size)
+{
+  ++allocation_count;
+  if(void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void *p,std::size_t) noexcept
+{
+  std::free(p);
+}
+
+//----------------------------------------------------------------------------
+template<typename FUNC>
+void run(const std::string &name,size_t n,size_t nruns,FUNC &&f)
+{
+  size_t count = allocation_count;
+  f();
+  count = allocation_count-count;
+
+  double t = run_benchmark(nruns,[&]()
+  {
+    for(size_t i=0;i<n;++i) f();
+  });
+  print_result(name,t,nruns,0,n);
+  std::printf("%-32s %12.1f\n","  allocations/operation",double(count));
+}
+
+int main(int argc,char **argv)
+{
+  size_t n     = argc>1 ? std::atoi(argv[1]) : 100000;
+  size_t nruns = argc>2 ? std::atoi(argv[2]) : 3;
+
+  const std::string input =
+      "/entry:NXentry/instrument:NXinstrument/detector:NXdetector/data";
+  Path path = Path::from_string(input);
+  Path pattern = Path::from_string("/:NXentry/:NXinstrument/:NXdetector/data");
+  Path base = Path::from_string("/entry:NXentry/instrument:NXinstrument");
+  Path relative = Path::from_string("detector:NXdetector/data");
+  volatile size_t sink = 0;
+
+  print_header("nexus::Path operations ("+std::to_string(n)+" each)");
+
+  run("parse",n,nruns,[&]()
+  {
+    sink = Path::from_string(input).size();
+  });
+
+  run("copy",n,nruns,[&]()
+  {
+    Path p(path);
+    sink = p.size();
+  });
+
+  run("match",n,nruns,[&]()
+  {
+    sink = match(path,pattern);
+  });
+
+  run("join",n,nruns,[&]()
+  {
+    sink = join(base,relative).size();
+  });
+
+  run("make_relative",n,nruns,[&]()
+  {
+    sink = make_relative(base,path).size();
+  });
+
+  run("split_path",n,nruns,[&]()
+  {
+    Path p1,p2;
+    split_path(path,2,p1,p2);
+    sink = p1.size()+p2.size();
+  });
+
+  run("push_back",n,nruns,[&]()
+  {
+    Path p;
+    p.push_back({"/","NXroot"});
+    p.push_back({"entry","NXentry"});
+    p.push_back({"instrument","NXinstrument"});
+    p.push_back({"detector","NXdetector"});
+    p.push_back({"data",""});
+    sink = p.size();
+  });
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Micro-benchmark for the primitive parsers. For every numeric type a set
+// of strings is converted with boost::lexical_cast (the former
+// implementation of parser<T>), with parser<T>::operator() and with the
+// non-throwing parser<T>::parse(). The last case measures the cost of
+// rejecting invalid input by an exception and by an error code.
+//
+// usage: primitive_parser_benchmark [number of strings] [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <pni/core/types.hpp>
+#include <pni/io/parsers/parser.hpp>
+
+#include "benchmark_utils.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+//----------------------------------------------------------------------------
+// generate n strings with random values of type T
+template<typename T>
+std::vector<std::string> make_input(size_t n,std::false_type)
+{
+    std::mt19937_64 generator(1);
+    typedef typename conversion_trait<T>::read_type read_type;
+    std::uniform_int_distribution<int64> distribution(
+            int64(std::numeric_limits<T>::min()),
+            int64(std::numeric_limits<T>::max()/2));
+
+    std::vector<std::string> input;
+    for(size_t i=0;i<n;++i)
+        input.push_back(std::to_string(read_type(distribution(generator))));
+    return input;
+}
+
+template<typename T>
+std::vector<std::string> make_input(size_t n,std::true_type)
+{
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<float64> distribution(-1e6,1e6);
+
+    std::vector<std::string> input;
+    for(size_t i=0;i<n;++i)
+    {
+        char buffer[32];
+        std::snprintf(buffer,sizeof(buffer),"%.6e",distribution(generator));
+        input.push_back(buffer);
+    }
+    return input;
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+void run(const std::string &name,size_t n,size_t nruns)
+{
+    typedef conversion_trait<T> conversion_type;
+    typedef typename conversion_type::read_type read_type;
+
+    auto input = make_input<T>(n,std::is_floating_point<T>());
+    size_t nbytes = 0;
+    for(const auto &s: input) nbytes += s.size();
+
+    parser<T> p;
+    volatile T sink = T();
+
+    double t = run_benchmark(nruns,[&]()
+    {
+        for(const auto &s: input)
+            sink = conversion_type::convert(boost::lexical_cast<read_type>(s));
+    });
+    print_result(name+" lexical_cast",t,nruns,nbytes,n);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        for(const auto &s: input) sink = p(s);
+    });
+    print_result(name+" parser",t,nruns,nbytes,n);
+
+    t = run_benchmark(nruns,[&]()
+    {
+        T value;
+        for(const auto &s: input)
+            if(p.parse(s,value)==std::errc()) sink = value;
+    });
+    print_result(name+" parser::parse",t,nruns,nbytes,n);
+}
+
+int main(int argc,char **argv)
+{
+    size_t n     = argc>1 ? std::atoi(argv[1]) : 1000000;
+    size_t nruns = argc>2 ? std::atoi(argv[2]) : 3;
+
+    print_header("parsing "+std::to_string(n)+" values");
+    run<uint8>("uint8",n,nruns);
+    run<int8>("int8",n,nruns);
+    run<uint16>("uint16",n,nruns);
+    run<int16>("int16",n,nruns);
+    run<uint32>("uint32",n,nruns);
+    run<int32>("int32",n,nruns);
+    run<uint64>("uint64",n,nruns);
+    run<int64>("int64",n,nruns);
+    run<float32>("float32",n,nruns);
+    run<float64>("float64",n,nruns);
+    run<float128>("float128",n,nruns);
+
+    //rejecting invalid input
+    std::vector<std::string> input(n/10,"12.5x");
+    parser<float64> p;
+    double t = run_benchmark(nruns,[&]()
+    {
+        for(const auto &s: input)
+        {
+            try { p(s); }
+            catch(const pni::io::parser_error &) {}
+        }
+    });
+    print_result("invalid float64 parser",t,nruns,5*input.size(),input.size());
+
+    t = run_benchmark(nruns,[&]()
+    {
+        float64 value;
+        for(const auto &s: input) p.parse(s,value);
+    });
+    print_result("invalid float64 parser::parse",t,nruns,5*input.size(),
+                 input.size());
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for big endian TIFF files. The byte swapping kernels are
+// measured on their own for every SIMD extension supported by the CPU and
+// reading a 2048x2048 image stored as big endian is compared to reading
+// the same image stored as little endian.
+//
+// usage: tiff_byte_order_benchmark [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/tiff/byte_swap.hpp>
+#include <pni/io/tiff/tiff_reader.hpp>
+
+#include "benchmark_utils.hpp"
+#include "cbf_test_data.hpp"
+#include "tiff_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nx = 2048;
+static const size_t ny = 2048;
+static const size_t rows_per_strip = 16;
+
+void benchmark_kernels(size_t nruns)
+{
+    std::vector<char> buffer(nx*ny*4);
+    for(size_t i=0;i<buffer.size();++i) buffer[i] = char(i);
+
+    const char *names[] = {"scalar","SSSE3","AVX2"};
+    for(size_t size: {2,4,8})
+    {
+        for(auto ext: {tiff::simd_extension::NONE,tiff::simd_extension::SSSE3,
+                       tiff::simd_extension::AVX2})
+        {
+            if(!tiff::byte_swap_simd_supported(ext)) continue;
+            double t = run_benchmark(nruns,[&]()
+            {
+                tiff::swap_bytes(ext,buffer.data(),buffer.size()/size,size);
+            });
+            char name[64];
+            std::snprintf(name,sizeof(name),"swap %d bit %s",int(8*size),
+                          names[int(ext)]);
+            print_result(name,t,nruns,buffer.size());
+        }
+    }
+}
+
+template<typename T>
+void benchmark_reader(const std::string &name,const std::vector<T> &image,
+                      size_t nruns)
+{
+    std::string fname = "tiff_byte_order_benchmark.tiff";
+    std::vector<T> data(nx*ny);
+
+    for(bool big_endian: {false,true})
+    {
+        size_t nbytes = write_tiff_file(fname,nx,ny,image,rows_per_strip,1,1,
+                                        big_endian);
+        for(bool mmap: {false,true})
+        {
+            tiff_reader reader(fname);
+            reader.use_mmap(mmap);
+            double t = run_benchmark(nruns,[&]() { reader.image(data,0); });
+            print_result(name+(big_endian ? " MM" : " II")+
+                         (mmap ? " mmap" : " stream"),t,nruns,nbytes);
+            if(data != image)
+                std::printf("%-32s decoded image differs!\n",name.c_str());
+        }
+    }
+
+    std::remove(fname.c_str());
+}
+
+int main(int argc,char **argv)
+{
+    size_t nruns = argc>1 ? std::atoi(argv[1]) : 10;
+    std::vector<int32> frame = synthetic_frame(nx,ny);
+
+    print_header("byte swapping of a 16 MB buffer");
+    benchmark_kernels(nruns);
+
+    print_header("2048x2048 uncompressed TIFF");
+    benchmark_reader("uint16",std::vector<uint16>(frame.begin(),frame.end()),
+                     nruns);
+    benchmark_reader("uint32",std::vector<uint32>(frame.begin(),frame.end()),
+                     nruns);
+    benchmark_reader("float64",std::vector<float64>(frame.begin(),frame.end()),
+                     nruns);
+    return 0;
+}
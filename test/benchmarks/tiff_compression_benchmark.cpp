@@ -0,0 +1,114 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for compressed TIFF images with 2048x2048 pixels. For every
+// codec the strip decoder is measured on its own (strips held in memory)
+// and as part of reading the entire image with tiff_reader. Throughput is
+// given in decoded bytes per second.
+//
+// usage: tiff_compression_benchmark [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/tiff/compression.hpp>
+#include <pni/io/tiff/tiff_reader.hpp>
+
+#include "benchmark_utils.hpp"
+#include "cbf_test_data.hpp"
+#include "tiff_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nx = 2048;
+static const size_t ny = 2048;
+static const size_t rows_per_strip = 16;
+
+template<typename T>
+void benchmark_codec(const std::string &name,const std::vector<T> &image,
+                     size_t compression,size_t predictor,size_t nruns)
+{
+    std::string fname = "tiff_compression_benchmark.tiff";
+    size_t nbytes = write_tiff_file(fname,nx,ny,image,rows_per_strip,
+                                    compression,predictor);
+
+    //decoder only - the encoded strips are held in memory
+    size_t row_size = ny*sizeof(T);
+    std::vector<std::string> strips;
+    size_t ncompressed = 0;
+    for(size_t row=0;row<nx;row+=rows_per_strip)
+    {
+        strips.push_back(encode_strip<T>(std::string(
+                reinterpret_cast<const char*>(image.data()+row*ny),
+                rows_per_strip*row_size),ny,compression,predictor));
+        ncompressed += strips.back().size();
+    }
+
+    tiff::strip_decoder decoder(tiff::to_compression(compression),
+                                tiff::to_predictor(predictor),1,sizeof(T),
+                                row_size,rows_per_strip*row_size);
+    double t = run_benchmark(nruns,[&]()
+    {
+        for(const auto &strip: strips)
+            decoder.decode(strip.data(),strip.size());
+    });
+    std::printf("%-32s ratio %.2f\n",name.c_str(),
+                double(nbytes)/double(ncompressed));
+    print_result(name+" decoder",t,nruns,nbytes);
+
+    std::vector<T> data(nx*ny);
+    for(bool mmap: {false,true})
+    {
+        tiff_reader reader(fname);
+        reader.use_mmap(mmap);
+        t = run_benchmark(nruns,[&]() { reader.image(data,0); });
+        print_result(name+(mmap ? " mmap" : " stream"),t,nruns,nbytes);
+        if(data != image)
+            std::printf("%-32s decoded image differs!\n",name.c_str());
+    }
+
+    std::remove(fname.c_str());
+}
+
+int main(int argc,char **argv)
+{
+    size_t nruns = argc>1 ? std::atoi(argv[1]) : 10;
+    std::vector<int32> frame = synthetic_frame(nx,ny);
+    std::vector<uint16> image16(frame.begin(),frame.end());
+    std::vector<float32> image32(frame.begin(),frame.end());
+
+    print_header("2048x2048 uint16 TIFF");
+    benchmark_codec("none",image16,1,1,nruns);
+    benchmark_codec("LZW",image16,5,1,nruns);
+    benchmark_codec("LZW + predictor",image16,5,2,nruns);
+    benchmark_codec("Deflate",image16,8,1,nruns);
+    benchmark_codec("Deflate + predictor",image16,8,2,nruns);
+    benchmark_codec("PackBits",image16,32773,1,nruns);
+
+    print_header("2048x2048 float32 TIFF");
+    benchmark_codec("Deflate",image32,8,1,nruns);
+    benchmark_codec("Deflate + FP predictor",image32,8,3,nruns);
+    benchmark_codec("LZW + FP predictor",image32,5,3,nruns);
+    return 0;
+}
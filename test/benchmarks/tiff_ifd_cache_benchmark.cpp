@@ -0,0 +1,94 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for opening TIFF stacks with many pages. For stacks of small
+// 16x16 images the time to open the file, to read the first and the last
+// image and to parse the IFDs of all pages is measured as a function of
+// the number of pages.
+//
+// usage: tiff_ifd_cache_benchmark [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/tiff/tiff_reader.hpp>
+
+#include "benchmark_utils.hpp"
+#include "tiff_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nx = 16;
+static const size_t ny = 16;
+
+void benchmark_stack(size_t npages,size_t nruns)
+{
+    std::string fname = "tiff_ifd_cache_benchmark.tiff";
+    std::vector<std::vector<uint16> > pages(npages);
+    for(size_t p=0;p<npages;++p)
+        pages[p] = std::vector<uint16>(nx*ny,uint16(p));
+    write_tiff_stack(fname,nx,ny,pages,nx);
+
+    std::vector<uint16> data(nx*ny);
+    char name[64];
+
+    double t = run_benchmark(nruns,[&]() { tiff_reader reader(fname); });
+    std::snprintf(name,sizeof(name),"open %d pages",int(npages));
+    print_result(name,t,nruns,0);
+
+    for(size_t page: {size_t(0),npages-1})
+    {
+        t = run_benchmark(nruns,[&]()
+        {
+            tiff_reader reader(fname);
+            reader.image(data,page);
+        });
+        std::snprintf(name,sizeof(name),"%s image %d pages",
+                      page ? "last" : "first",int(npages));
+        print_result(name,t,nruns,data.size()*sizeof(uint16));
+        if(data != pages[page])
+            std::printf("%-32s decoded image differs!\n",name);
+    }
+
+    t = run_benchmark(nruns,[&]()
+    {
+        tiff_reader reader(fname);
+        reader.ifd_cache_size(0);
+        for(size_t i=0;i<reader.nimages();++i) reader.info(i);
+    });
+    std::snprintf(name,sizeof(name),"info of %d pages",int(npages));
+    print_result(name,t,nruns,0,npages);
+
+    std::remove(fname.c_str());
+}
+
+int main(int argc,char **argv)
+{
+    size_t nruns = argc>1 ? std::atoi(argv[1]) : 5;
+
+    print_header("TIFF stacks of 16x16 uint16 images");
+    for(size_t npages: {10,100,1000,10000,50000})
+        benchmark_stack(npages,nruns);
+    return 0;
+}
@@ -0,0 +1,119 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Benchmark for reading single channel TIFF images with 4096x4096 pixels, 
+// similar to the ii32.tiff and ui32.tiff test files. The strip reader is 
+// compared to a reference implementation reading every sample with a 
+// separate read and seek (the former implementation of the strip reader).
+// In addition the strips are decoded with an increasing number of threads.
+//
+// usage: tiff_strip_reader_benchmark [nruns]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/io/tiff/tiff_reader.hpp>
+
+#include "benchmark_utils.hpp"
+#include "cbf_test_data.hpp"
+#include "tiff_test_data.hpp"
+
+using namespace pni::core;
+using namespace pni::io;
+
+static const size_t nx = 4096;
+static const size_t ny = 4096;
+static const size_t rows_per_strip = 16;
+
+//reference implementation reading one sample at a time
+template<typename IT,typename CTYPE>
+void read_per_sample(const std::string &fname,CTYPE &data)
+{
+    std::ifstream stream(fname.c_str(),std::ios::binary);
+    size_t strip_size = rows_per_strip*ny;
+    auto piter = data.begin();
+    IT sample;
+    for(size_t offset=8;piter!=data.end();offset+=strip_size*sizeof(IT))
+    {
+        stream.seekg(offset,std::ios::beg);
+        for(size_t i=0;i<strip_size;++i)
+        {
+            stream.read(reinterpret_cast<char*>(&sample),sizeof(IT));
+            stream.seekg(0,std::ios::cur);
+            *piter++ = sample;
+        }
+    }
+}
+
+template<typename IT,typename VT>
+void benchmark_type(const std::string &name,const std::vector<int32> &frame,
+                    size_t nruns)
+{
+    std::string fname = "tiff_strip_reader_benchmark.tiff";
+    std::vector<IT> image(frame.begin(),frame.end());
+    size_t nbytes = write_tiff_file(fname,nx,ny,image,rows_per_strip);
+
+    std::vector<VT> data(nx*ny);
+    //the reference is slow - run it only once
+    double t = run_benchmark(1,[&]() { read_per_sample<IT>(fname,data); });
+    print_result(name+" per sample",t,1,nbytes);
+
+    for(bool mmap: {false,true})
+    {
+        tiff_reader reader(fname);
+        reader.use_mmap(mmap);
+        t = run_benchmark(nruns,[&]() { reader.image(data,0); });
+        print_result(name+(mmap ? " mmap" : " stream"),t,nruns,nbytes);
+    }
+
+    size_t ncores = worker_threads(0);
+    for(size_t nthreads=2;nthreads<=ncores;nthreads*=2)
+    {
+        for(bool mmap: {false,true})
+        {
+            tiff_reader reader(fname);
+            reader.use_mmap(mmap);
+            reader.nthreads(nthreads);
+            t = run_benchmark(nruns,[&]() { reader.image(data,0); });
+            print_result(name+(mmap ? " mmap " : " stream ")+
+                         std::to_string(nthreads)+" threads",t,nruns,nbytes);
+        }
+    }
+
+    std::remove(fname.c_str());
+}
+
+int main(int argc,char **argv)
+{
+    size_t nruns = argc>1 ? std::atoi(argv[1]) : 10;
+    std::vector<int32> frame = synthetic_frame(nx,ny);
+
+    print_header("4096x4096 single channel TIFF");
+    benchmark_type<uint16,uint16>("uint16 -> uint16",frame,nruns);
+    benchmark_type<uint16,float64>("uint16 -> float64",frame,nruns);
+    benchmark_type<int32,int32>("int32 -> int32",frame,nruns);
+    benchmark_type<uint32,uint32>("uint32 -> uint32",frame,nruns);
+    benchmark_type<int32,float32>("int32 -> float32",frame,nruns);
+    return 0;
+}
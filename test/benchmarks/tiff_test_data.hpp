@@ -0,0 +1,438 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+// Generator for TIFF files used by the benchmarks.
+//
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <zlib.h>
+#include <pni/core/types.hpp>
+
+//!
+//! \brief minimal TIFF writer
+//!
+//! Collects IFD entries and writes single channel images organized in
+//! strips. Every call to next_page() closes the IFD of the current page.
+//! The header and the IFDs are written as little or big endian.
+//!
+class tiff_test_writer
+{
+    private:
+        std::string _buffer;
+        bool _big_endian;
+        size_t _next_offset; //position of the offset of the next IFD
+
+        template<typename T> void _put(T value,size_t pos)
+        {
+            for(size_t i=0;i<sizeof(T);++i)
+            {
+                size_t byte = _big_endian ? sizeof(T)-1-i : i;
+                _buffer[pos+byte] = static_cast<char>((value>>(8*i))&0xFF);
+            }
+        }
+
+        template<typename T> void _append(T value)
+        {
+            _buffer.resize(_buffer.size()+sizeof(T));
+            _put(value,_buffer.size()-sizeof(T));
+        }
+
+        struct entry
+        {
+            pni::core::uint16 tag;
+            pni::core::uint16 type;
+            std::vector<pni::core::uint32> values;
+        };
+        std::vector<entry> _entries;
+
+    public:
+        explicit tiff_test_writer(bool big_endian=false):
+            _buffer(big_endian ? std::string("MM\0*\0\0\0\0",8) :
+                                 std::string("II*\0\0\0\0\0",8)),
+            _big_endian(big_endian),
+            _next_offset(4)
+        {}
+
+        //! append raw image data and return its offset
+        size_t append_data(const char *data,size_t size)
+        {
+            size_t offset = _buffer.size();
+            _buffer.append(data,size);
+            return offset;
+        }
+
+        //! add an IFD entry of type SHORT (3) or LONG (4)
+        void add_entry(pni::core::uint16 tag,pni::core::uint16 type,
+                       const std::vector<pni::core::uint32> &values)
+        {
+            _entries.push_back(entry{tag,type,values});
+        }
+
+        //! write the IFD of the current page and start a new page
+        void next_page()
+        {
+            using namespace pni::core;
+            //arrays which do not fit into the IFD entry
+            std::vector<uint32> offsets;
+            for(const auto &e: _entries)
+            {
+                size_t size = e.values.size()*(e.type==3 ? 2 : 4);
+                if(size<=4) { offsets.push_back(0); continue; }
+                if(_buffer.size()%2) _buffer.push_back('\0');
+                offsets.push_back(static_cast<uint32>(_buffer.size()));
+                for(auto v: e.values)
+                    if(e.type==3) _append(static_cast<uint16>(v));
+                    else          _append(static_cast<uint32>(v));
+            }
+
+            if(_buffer.size()%2) _buffer.push_back('\0');
+            _put(static_cast<uint32>(_buffer.size()),_next_offset);
+            _append(static_cast<uint16>(_entries.size()));
+            for(size_t i=0;i<_entries.size();++i)
+            {
+                const entry &e = _entries[i];
+                _append(e.tag);
+                _append(e.type);
+                _append(static_cast<uint32>(e.values.size()));
+                if(offsets[i])
+                    _append(offsets[i]);
+                else
+                {
+                    size_t pos = _buffer.size();
+                    _append(static_cast<uint32>(0));
+                    for(size_t j=0;j<e.values.size();++j)
+                        if(e.type==3) _put(static_cast<uint16>(e.values[j]),pos+2*j);
+                        else          _put(e.values[j],pos);
+                }
+            }
+            _next_offset = _buffer.size();
+            _append(static_cast<uint32>(0));
+            _entries.clear();
+        }
+
+        //! write the IFD of the last page and the file
+        void write(const std::string &fname)
+        {
+            if(!_entries.empty()) next_page();
+
+            std::ofstream stream(fname.c_str(),std::ios::binary);
+            stream.write(_buffer.data(),_buffer.size());
+        }
+};
+
+//----------------------------------------------------------------------------
+//!
+//! \brief TIFF style LZW encoder
+//!
+//! Writes MSB first codes of 9 to 12 bits with early change.
+//!
+inline std::string lzw_encode(const std::string &data)
+{
+    std::string out;
+    pni::core::uint32 bits = 0;
+    size_t nbits = 0,size = 9,next_code = 258;
+    auto put = [&](size_t code)
+    {
+        bits = (bits<<size)|code;
+        nbits += size;
+        while(nbits>=8)
+        {
+            nbits -= 8;
+            out.push_back(static_cast<char>((bits>>nbits)&0xFF));
+        }
+        bits &= (1u<<nbits)-1;
+    };
+
+    //key is the code of the prefix and the next character
+    std::unordered_map<size_t,size_t> table;
+    put(256);
+    size_t string = data.empty() ? 0 : static_cast<unsigned char>(data[0]);
+    for(size_t i=1;i<data.size();++i)
+    {
+        size_t c = static_cast<unsigned char>(data[i]);
+        auto entry = table.find((string<<8)|c);
+        if(entry != table.end()) { string = entry->second; continue; }
+
+        put(string);
+        table[(string<<8)|c] = next_code++;
+        if(next_code == 4094)
+        {
+            put(256);
+            table.clear();
+            next_code = 258;
+            size = 9;
+        }
+        else if(next_code>(size_t(1)<<size)-1)
+            ++size;
+        string = c;
+    }
+
+    if(!data.empty())
+    {
+        put(string);
+        if(++next_code>(size_t(1)<<size)-1 && size<12) ++size;
+    }
+    put(257);
+    if(nbits) out.push_back(static_cast<char>((bits<<(8-nbits))&0xFF));
+    return out;
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief PackBits encoder
+//!
+inline std::string packbits_encode(const std::string &data)
+{
+    std::string out;
+    size_t i = 0;
+    while(i<data.size())
+    {
+        size_t run = 1;
+        while(i+run<data.size() && run<128 && data[i+run]==data[i]) ++run;
+        if(run>=3)
+        {
+            out.push_back(static_cast<char>(1-static_cast<int>(run)));
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+
+        size_t j = i;
+        while(j<data.size() && j-i<128)
+        {
+            if(j+2<data.size() && data[j]==data[j+1] && data[j]==data[j+2])
+                break;
+            ++j;
+        }
+        out.push_back(static_cast<char>(j-i-1));
+        out.append(data,i,j-i);
+        i = j;
+    }
+    return out;
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief Deflate encoder
+//!
+inline std::string deflate_encode(const std::string &data)
+{
+    uLongf size = compressBound(data.size());
+    std::string out(size,'\0');
+    compress2(reinterpret_cast<Bytef*>(&out[0]),&size,
+              reinterpret_cast<const Bytef*>(data.data()),data.size(),6);
+    out.resize(size);
+    return out;
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief apply a predictor to a strip
+//!
+//! \tparam T pixel type
+//! \param strip strip data, modified in place
+//! \param ny number of pixels per row
+//! \param predictor 2 for horizontal differencing, 3 for floating point
+//!
+template<typename T>
+void apply_predictor(std::string &strip,size_t ny,size_t predictor)
+{
+    typedef typename std::conditional<sizeof(T)==1,pni::core::uint8,
+            typename std::conditional<sizeof(T)==2,pni::core::uint16,
+            typename std::conditional<sizeof(T)==4,pni::core::uint32,
+                                      pni::core::uint64>::type>::type>::type
+            int_type;
+    size_t row_size = ny*sizeof(T);
+    std::string planes(row_size,'\0');
+    for(size_t row=0;row<strip.size();row+=row_size)
+    {
+        char *p = &strip[row];
+        if(predictor == 2)
+        {
+            int_type previous = 0,current;
+            for(size_t i=0;i<ny;++i)
+            {
+                std::memcpy(&current,p+i*sizeof(T),sizeof(T));
+                int_type diff = int_type(current-previous);
+                std::memcpy(p+i*sizeof(T),&diff,sizeof(T));
+                previous = current;
+            }
+        }
+        else if(predictor == 3)
+        {
+            //byte planes starting with the most significant byte
+            for(size_t i=0;i<ny;++i)
+                for(size_t k=0;k<sizeof(T);++k)
+                    planes[k*ny+i] = p[i*sizeof(T)+sizeof(T)-1-k];
+            for(size_t i=row_size-1;i>0;--i)
+                planes[i] = static_cast<char>(planes[i]-planes[i-1]);
+            std::memcpy(p,planes.data(),row_size);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief encode a strip
+//!
+//! \tparam T pixel type
+//! \param strip raw strip data
+//! \param ny number of pixels per row
+//! \param compression value of the Compression tag (1, 5, 8 or 32773)
+//! \param predictor value of the Predictor tag (1, 2 or 3)
+//! \return encoded strip
+//!
+template<typename T>
+std::string encode_strip(std::string strip,size_t ny,size_t compression,
+                         size_t predictor)
+{
+    apply_predictor<T>(strip,ny,predictor);
+    if(compression == 5)          return lzw_encode(strip);
+    else if(compression == 8)     return deflate_encode(strip);
+    else if(compression == 32773) return packbits_encode(strip);
+    return strip;
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief add a single channel image to a TIFF file
+//!
+//! Appends the strips and the IFD entries of the image. The IFD is 
+//! written with the next call to next_page() or write().
+//!
+//! \tparam T pixel type
+//! \param writer the writer for the file
+//! \param nx number of rows
+//! \param ny number of columns
+//! \param data image data
+//! \param rows_per_strip number of rows per strip
+//! \param compression value of the Compression tag (1, 5, 8 or 32773)
+//! \param predictor value of the Predictor tag (1, 2 or 3)
+//! \param big_endian the file is big endian (only without predictor)
+//!
+template<typename T>
+void add_tiff_image(tiff_test_writer &writer,size_t nx,size_t ny,
+                    const std::vector<T> &data,size_t rows_per_strip=1,
+                    size_t compression=1,size_t predictor=1,
+                    bool big_endian=false)
+{
+    using namespace pni::core;
+    std::vector<uint32> offsets,counts;
+    size_t row_size = ny*sizeof(T);
+    for(size_t row=0;row<nx;row+=rows_per_strip)
+    {
+        size_t nrows = std::min(rows_per_strip,nx-row);
+        std::string raw(reinterpret_cast<const char*>(data.data()+row*ny),
+                        nrows*row_size);
+        if(big_endian)
+            for(size_t i=0;i<raw.size();i+=sizeof(T))
+                std::reverse(raw.begin()+i,raw.begin()+i+sizeof(T));
+
+        std::string strip = encode_strip<T>(raw,ny,compression,predictor);
+
+        offsets.push_back(static_cast<uint32>(writer.append_data(
+                strip.data(),strip.size())));
+        counts.push_back(static_cast<uint32>(strip.size()));
+    }
+
+    uint32 format = std::is_floating_point<T>::value ? 3 :
+                    (std::numeric_limits<T>::is_signed ? 2 : 1);
+
+    writer.add_entry(256,4,{static_cast<uint32>(ny)});         //ImageWidth
+    writer.add_entry(257,4,{static_cast<uint32>(nx)});         //ImageLength
+    writer.add_entry(258,3,{static_cast<uint32>(8*sizeof(T))});//BitsPerSample
+    writer.add_entry(259,3,{static_cast<uint32>(compression)});//Compression
+    writer.add_entry(262,3,{1});                               //Photometric
+    writer.add_entry(273,4,offsets);                           //StripOffsets
+    writer.add_entry(277,3,{1});                               //SamplesPerPixel
+    writer.add_entry(278,4,{static_cast<uint32>(rows_per_strip)});//RowsPerStrip
+    writer.add_entry(279,4,counts);                            //StripByteCounts
+    if(predictor != 1)
+        writer.add_entry(317,3,{static_cast<uint32>(predictor)});//Predictor
+    writer.add_entry(339,3,{format});                          //SampleFormat
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief write a single channel TIFF file
+//!
+//! \tparam T pixel type
+//! \param fname name of the output file
+//! \param nx number of rows
+//! \param ny number of columns
+//! \param data image data
+//! \param rows_per_strip number of rows per strip
+//! \param compression value of the Compression tag (1, 5, 8 or 32773)
+//! \param predictor value of the Predictor tag (1, 2 or 3)
+//! \param big_endian write a big endian file (only without predictor)
+//! \return size of the image data in bytes
+//!
+template<typename T>
+size_t write_tiff_file(const std::string &fname,size_t nx,size_t ny,
+                       const std::vector<T> &data,size_t rows_per_strip=1,
+                       size_t compression=1,size_t predictor=1,
+                       bool big_endian=false)
+{
+    tiff_test_writer writer(big_endian);
+    add_tiff_image(writer,nx,ny,data,rows_per_strip,compression,predictor,
+                   big_endian);
+    writer.write(fname);
+
+    return data.size()*sizeof(T);
+}
+
+//----------------------------------------------------------------------------
+//!
+//! \brief write a stack of uncompressed single channel images
+//!
+//! \tparam T pixel type
+//! \param fname name of the output file
+//! \param nx number of rows
+//! \param ny number of columns
+//! \param pages image data of every page
+//! \param rows_per_strip number of rows per strip
+//! \return size of the image data in bytes
+//!
+template<typename T>
+size_t write_tiff_stack(const std::string &fname,size_t nx,size_t ny,
+                        const std::vector<std::vector<T> > &pages,
+                        size_t rows_per_strip=1)
+{
+    tiff_test_writer writer;
+    size_t nbytes = 0;
+    for(const auto &page: pages)
+    {
+        add_tiff_image(writer,nx,ny,page,rows_per_strip);
+        writer.next_page();
+        nbytes += page.size()*sizeof(T);
+    }
+    writer.write(fname);
+
+    return nbytes;
+}
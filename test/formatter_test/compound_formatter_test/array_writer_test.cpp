@@ -0,0 +1,97 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+//  Created on: Oct 17, 2026
+//
+
+#include <sstream>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures.hpp>
+#include <boost/test/unit_test.hpp>
+#include <pni/io/formatters.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+struct array_writer_test_fixture
+{
+    typedef dynamic_array<int16> array_type;
+    array_type input;
+    std::ostringstream stream;
+
+    array_writer_test_fixture():
+        input(array_type::create(shape_t{2,3},
+                                 array_type::storage_type{1,-2,3,4,5,-6}))
+    {}
+};
+
+BOOST_FIXTURE_TEST_SUITE(array_writer_test,array_writer_test_fixture)
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_mdarray)
+    {
+        array_writer writer(stream,container_io_config('[',']',','));
+        writer.write(input);
+        writer.flush();
+        BOOST_CHECK(stream.str() == "[+1,-2,+3]\n[+4,+5,-6]\n");
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_array)
+    {
+        array_writer writer(stream,container_io_config(),
+                            format_config(format_config::full_precision,3,
+                                          false));
+        writer.write(array(input));
+        writer.flush();
+        BOOST_CHECK(stream.str() == "  1  -2   3\n  4   5  -6\n");
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_rank1)
+    {
+        typedef dynamic_array<float64> float_array;
+        auto data = float_array::create(shape_t{3},
+                                        float_array::storage_type{1,2.5,-3});
+        array_writer writer(stream,container_io_config(),format_config(2));
+        writer.write(data);
+        writer.flush();
+        BOOST_CHECK(stream.str() == "+1.00e+00 +2.50e+00 -3.00e+00\n");
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_small_buffer)
+    {
+        //the buffer is written to the stream after every value
+        {
+            array_writer writer(stream,container_io_config(),format_config(),1);
+            writer.write(input);
+            BOOST_CHECK(stream.str() == "+1 -2 +3\n+4 +5 -6\n");
+        }
+
+        std::ostringstream stream2;
+        {
+            array_writer writer(stream2);
+            writer.write_rows(input.begin(),input.end(),4);
+        }
+        BOOST_CHECK(stream2.str() == "+1 -2 +3 +4\n+5 -6\n");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
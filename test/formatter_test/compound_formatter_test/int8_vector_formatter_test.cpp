@@ -72,4 +72,27 @@ BOOST_FIXTURE_TEST_SUITE(int8_vector_formatter_test,int8_vector_formatter_fixtur
         BOOST_CHECK(format(input,config) == "[+1;+2;+3;+4]");
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_empty)
+    {
+        BOOST_CHECK(format(input_type()) == "");
+        BOOST_CHECK(format(input_type(),container_io_config('[',']')) == "[]");
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_append)
+    {
+        string output = "data=";
+        format_to(output,input,container_io_config('[',']',';'));
+        BOOST_CHECK(output == "data=[+1;+2;+3;+4]");
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_value_config)
+    {
+        format_config config(format_config::full_precision,3,false);
+        BOOST_CHECK(format(input,container_io_config(),config) ==
+                    "  1   2   3   4");
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -53,4 +53,11 @@ BOOST_AUTO_TEST_SUITE(complex32_formatter_test)
         BOOST_CHECK(result == "+0.000000000e+00-I3.450000048e+00");
     }
 
+    BOOST_AUTO_TEST_CASE(test_config)
+    {
+        format_config config(2,20,false);
+        BOOST_CHECK(format(complex32(1.5f,-2),config) == "  1.50e+00-I2.00e+00");
+        BOOST_CHECK(format(complex32(-1.5f,2),config) == " -1.50e+00+I2.00e+00");
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
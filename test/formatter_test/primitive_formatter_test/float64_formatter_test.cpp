@@ -40,4 +40,32 @@ BOOST_AUTO_TEST_SUITE(float64_formatter_test)
         BOOST_CHECK(result == "-1.29387702983000004e-11");
     }
 
+    BOOST_AUTO_TEST_CASE(test_config)
+    {
+        BOOST_CHECK(format(float64(1.2),format_config(3)) == "+1.200e+00");
+        BOOST_CHECK(format(float64(1.2),format_config(3,12,false)) ==
+                    "   1.200e+00");
+        BOOST_CHECK(format(float64(-1.2),format_config(0)) == "-1e+00");
+
+        //output exceeding the internal buffer
+        string result = format(float64(1.0),format_config(60));
+        BOOST_CHECK(result.size() == 67);
+        BOOST_CHECK(result.size() <=
+                    max_format_size_of<float64>(format_config(60)));
+        BOOST_CHECK(result.substr(0,4) == "+1.0");
+    }
+
+    BOOST_AUTO_TEST_CASE(test_append)
+    {
+        string result = "x=";
+        format_to(result,float64(1.2));
+        BOOST_CHECK(result == "x=+1.19999999999999996e+00");
+        BOOST_CHECK(result.size() <= 2+max_format_size<float64>::value);
+
+        char buffer[max_scalar_format_size];
+        format_to_result r = format_to(buffer,buffer+sizeof(buffer),
+                                       float64(-1.29387702983e-11));
+        BOOST_CHECK(string(buffer,r.ptr) == "-1.29387702983000004e-11");
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -40,4 +40,17 @@ BOOST_AUTO_TEST_SUITE(int32_formatter_test)
         BOOST_CHECK(format(input_type(-2147483648)) == "-2147483648");
     }
 
+    BOOST_AUTO_TEST_CASE(test_config)
+    {
+        format_config config(format_config::full_precision,4,false);
+        BOOST_CHECK(format(int32(5),config) == "   5");
+        BOOST_CHECK(format(int32(-5),config) == "  -5");
+        BOOST_CHECK(format(int32(123456),config) == "123456");
+
+        char buffer[4];
+        BOOST_CHECK(format_to(buffer,buffer+3,int32(5),config).ec ==
+                    std::errc::value_too_large);
+        BOOST_CHECK(max_format_size_of<int32>(format_config(0,20)) == 20);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
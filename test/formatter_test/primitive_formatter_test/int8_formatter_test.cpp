@@ -40,4 +40,16 @@ BOOST_AUTO_TEST_SUITE(int8_formatter_test)
         BOOST_CHECK(format(input_type(-128)) == "-128");
     }
 
+    BOOST_AUTO_TEST_CASE(test_buffer)
+    {
+        char buffer[4];
+        format_to_result result = format_to(buffer,buffer+4,int8(-128));
+        BOOST_CHECK(result.ec == std::errc());
+        BOOST_CHECK(string(buffer,result.ptr) == "-128");
+
+        result = format_to(buffer,buffer+3,int8(-128));
+        BOOST_CHECK(result.ec == std::errc::value_too_large);
+        BOOST_CHECK(result.ptr == buffer+3);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -71,5 +71,13 @@ BOOST_AUTO_TEST_CASE(test_rule_only_names_or_classes)
   BOOST_CHECK(!match(Element("","NXentry"),Element("","NXinstrument")));
 }
 
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_rule_empty_elements)
+{
+  BOOST_CHECK(!match(Element("",""),Element("entry","NXentry")));
+  BOOST_CHECK(!match(Element("entry",""),Element("","")));
+  BOOST_CHECK(!match(Element("",""),Element("","")));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
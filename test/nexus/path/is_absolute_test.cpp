@@ -48,6 +48,7 @@ BOOST_AUTO_TEST_CASE(test_no)
   BOOST_CHECK(!is_absolute(Path::from_string(":NXinstrument")));
   BOOST_CHECK(!is_absolute(Path::from_string("instrument")));
   BOOST_CHECK(!is_absolute(Path::from_string("instrument:NXinstrument")));
+  BOOST_CHECK(!is_absolute(Path()));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -74,6 +74,18 @@ BOOST_AUTO_TEST_CASE(test_attribute)
 
 }
 
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_digits)
+{
+  string input = "/entry1:NXentry/data2:NXdata2";
+  Path output;
+
+  BOOST_CHECK_NO_THROW(output = parsers::parse_path(input));
+  BOOST_CHECK(output.size() == 3);
+  BOOST_CHECK(output.back().first == "data2");
+  BOOST_CHECK(output.back().second == "NXdata2");
+}
+
 //-------------------------------------------------------------------------
 BOOST_AUTO_TEST_CASE(test_errors)
 {
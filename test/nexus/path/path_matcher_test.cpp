@@ -0,0 +1,94 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+//  Created on: Oct 17, 2026
+//
+
+#include <boost/test/unit_test.hpp>
+#include <pni/core/types.hpp>
+#include <pni/io/nexus/path.hpp>
+
+using namespace pni::core;
+using namespace pni::io::nexus;
+
+BOOST_AUTO_TEST_SUITE(PathTest)
+BOOST_AUTO_TEST_SUITE(PathMatcherTest)
+
+using Element = Path::Element;
+
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_construction)
+{
+  PathMatcher m1(Path::from_string("/:NXentry/:NXinstrument/:NXdetector/data"));
+  BOOST_CHECK(m1.size() == 5);
+  BOOST_CHECK(m1.is_absolute());
+  BOOST_CHECK(!m1.is_unique());
+  BOOST_CHECK(m1.name(4) == "data");
+  BOOST_CHECK(m1.requires_class(1));
+  BOOST_CHECK(!m1.requires_class(4));
+
+  PathMatcher m2(Path::from_string("entry/instrument"));
+  BOOST_CHECK(m2.size() == 2);
+  BOOST_CHECK(!m2.is_absolute());
+  BOOST_CHECK(m2.is_unique());
+}
+
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_match_name)
+{
+  PathMatcher m(Path::from_string("entry:NXentry/:NXinstrument"));
+  BOOST_CHECK(m.match_name(0,"entry"));
+  BOOST_CHECK(!m.match_name(0,"scan_1"));
+  BOOST_CHECK(m.match_name(1,"instrument"));
+  BOOST_CHECK(m.match_name(1,"beamline"));
+}
+
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_match_element)
+{
+  PathMatcher m(Path::from_string("entry:NXentry/:NXinstrument/data"));
+  BOOST_CHECK(m.match(0,Element("entry","NXentry")));
+  BOOST_CHECK(m.match(0,Element("entry","")));
+  BOOST_CHECK(!m.match(0,Element("entry","NXinstrument")));
+  BOOST_CHECK(m.match(0,Element("","NXentry")));
+  BOOST_CHECK(m.match(1,Element("beamline","NXinstrument")));
+  BOOST_CHECK(!m.match(1,Element("instrument","")));
+  BOOST_CHECK(m.match(2,Element("data","")));
+
+  //empty elements never match
+  BOOST_CHECK(!m.match(2,Element("","")));
+}
+
+//-------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_match_path)
+{
+  PathMatcher m(Path::from_string(":NXentry/:NXinstrument/:NXdetector"));
+  BOOST_CHECK(m.match(Path::from_string("entry:NXentry/instrument:NXinstrument/detector:NXdetector")));
+  BOOST_CHECK(!m.match(Path::from_string("scan_1:NXentry/instrument/detector:NXdetector")));
+  BOOST_CHECK(!m.match(Path::from_string("entry:NXentry/instrument:NXinstrument")));
+  BOOST_CHECK(!m.match(Path::from_string("entry:NXentry/instrument:NXinstrument/detector:NXdetector@units")));
+
+  Path p("",Path::ElementList{{"entry","NXentry"},
+                              {"instrument","NXinstrument"},
+                              {"",""}},"");
+  BOOST_CHECK(!m.match(p));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+// Created on: Oct 17, 2026
+//
+//
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <vector>
+#include <pni/io/parsers/parser.hpp>
+#include <pni/io/parsers/utils.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+//reference implementations of the classifier using regular expressions
+static const boost::regex boolean_regexp("^T(rue|RUE)|true|1|F(alse|ALSE)|false|0$");
+static const boost::regex slice_regexp("^\\d+:(\\d*(:\\d+)?)?$");
+
+struct classifier_fixture
+{
+    std::mt19937 generator;
+
+    classifier_fixture():generator(42) {}
+
+    //-------------------------------------------------------------------------
+    //! create a random string from an alphabet
+    string random_input(const string &alphabet,size_t max_size)
+    {
+        std::uniform_int_distribution<size_t> size(0,max_size);
+        std::uniform_int_distribution<size_t> index(0,alphabet.size()-1);
+
+        string input;
+        for(size_t n = size(generator);n;--n)
+            input += alphabet[index(generator)];
+        return input;
+    }
+
+    //-------------------------------------------------------------------------
+    //! check the classification against the regular expressions
+    void check(const string &input)
+    {
+        BOOST_TEST_CONTEXT("input ["<<input<<"]")
+        {
+            lexical_info info = classify(input.data(),
+                                         input.data()+input.size());
+
+            BOOST_CHECK_EQUAL(info.is(lexical_class::INTEGER),
+                              boost::regex_match(input,default_int_regexp));
+            BOOST_CHECK_EQUAL(info.is(lexical_class::FLOAT),
+                              boost::regex_match(input,default_float_regexp));
+            BOOST_CHECK_EQUAL(info.is(lexical_class::BOOLEAN),
+                              boost::regex_match(input,boolean_regexp));
+            BOOST_CHECK_EQUAL(info.is(lexical_class::SLICE),
+                              boost::regex_match(input,slice_regexp));
+
+            boost::smatch match;
+            bool is_complex = boost::regex_match(input,match,
+                                                 default_complex_regexp);
+            BOOST_CHECK_EQUAL(info.is(lexical_class::COMPLEX),is_complex);
+            if(is_complex && info.is(lexical_class::COMPLEX))
+            {
+                BOOST_CHECK_EQUAL(string(info.real_first,info.real_last),
+                                  match.str("REALPART"));
+                BOOST_CHECK_EQUAL(string(info.imag_first,info.imag_last),
+                                  match.str("IMAGPART"));
+                string sign = match.str("IMAGSIGN");
+                BOOST_CHECK_EQUAL(info.imag_negative,
+                                  !sign.empty() && sign[0]=='-');
+            }
+        }
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(lexical_classifier_test,classifier_fixture)
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_classes)
+    {
+        auto c = [](const string &input)
+        {
+            return classify(input.data(),input.data()+input.size()).classes;
+        };
+
+        BOOST_CHECK_EQUAL(c("-123"),unsigned(lexical_class::INTEGER));
+        BOOST_CHECK_EQUAL(c("1"),unsigned(lexical_class::INTEGER)|
+                                 unsigned(lexical_class::BOOLEAN));
+        BOOST_CHECK_EQUAL(c("1.5e-3"),unsigned(lexical_class::FLOAT)|
+                                      unsigned(lexical_class::COMPLEX));
+        BOOST_CHECK_EQUAL(c("1.3+I3.4"),unsigned(lexical_class::COMPLEX));
+        BOOST_CHECK_EQUAL(c("True"),unsigned(lexical_class::BOOLEAN));
+        BOOST_CHECK_EQUAL(c("1:10:2"),unsigned(lexical_class::SLICE));
+        BOOST_CHECK_EQUAL(c("1e5"),unsigned(lexical_class::NONE));
+        BOOST_CHECK_EQUAL(c("hello"),unsigned(lexical_class::NONE));
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_regular_input)
+    {
+        for(auto input: {"","0","+1","-12","+-1","1.","-1.5",".5","1.e5",
+                         "1.5E+3","1.5e","1.5e+","1e5","1.5e+i","i","-j",
+                         "+I","j3.9","-i-3.9","1.3+I3.4","1.+i4.","1.0i",
+                         "1+i2.0","1.0+i2","1.0-","1.0++i2.0","true","TRUE",
+                         "True","tRue","false","0","1:","1:5","1::2",
+                         "1:5:2",":5","1:5:","1:5:2:3","12a"})
+            check(input);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_random_input)
+    {
+        for(size_t i=0;i<100000;++i)
+            check(random_input("0123456789+-.eEijI:",12));
+
+        //letters of the boolean words
+        for(size_t i=0;i<20000;++i)
+            check(random_input("01TtFfrRuUeEaAlLsS",6));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -58,4 +58,33 @@ BOOST_FIXTURE_TEST_SUITE(vector_parser_test,vector_parser_test_fixture)
         BOOST_CHECK_THROW(p("[10,-20,10]"),parser_error);
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_append)
+    {
+        p = parser_type(container_io_config('[',']',','));
+        result_type result = {7};
+        BOOST_CHECK(p.append("[1, 2,,3 ]",result) == 3);
+        result_type ref = {7,1,2,3};
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),result.end(),
+                                      ref.begin(),ref.end());
+
+        //the container is left unchanged in case of errors
+        BOOST_CHECK_THROW(p.append("[4,5,300]",result),parser_error);
+        BOOST_CHECK_THROW(p.append("[4,5",result),parser_error);
+        BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),result.end(),
+                                      ref.begin(),ref.end());
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_buffer)
+    {
+        uint8 buffer[4] = {0,0,0,0};
+        BOOST_CHECK(p.parse(" 1  2 3 ",buffer,4) == 3);
+        BOOST_CHECK(buffer[0] == 1 && buffer[1] == 2 && buffer[2] == 3);
+        BOOST_CHECK(buffer[3] == 0);
+
+        BOOST_CHECK(p.parse("",buffer,4) == 0);
+        BOOST_CHECK_THROW(p.parse("1 2 3 4 5",buffer,4),size_mismatch_error);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -53,4 +53,15 @@ BOOST_FIXTURE_TEST_SUITE(float64_parser_test,float64_parser_test_fixture)
         BOOST_CHECK_THROW(p("1.e-1x"),parser_error);
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_error_codes)
+    {
+        float64 value = 0;
+        std::string input = "2.5e3 ";
+        BOOST_CHECK(p.parse(input,value) == std::errc::invalid_argument);
+        BOOST_CHECK(p.parse(input.data(),input.data()+5,value) == std::errc());
+        BOOST_CHECK_CLOSE_FRACTION(value,2.5e3,1.e-12);
+        BOOST_CHECK(p.parse("1e400",value) == std::errc::result_out_of_range);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+// ===========================================================================
+//
+//  Created on: Oct 17, 2026
+//
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <pni/io/parsers/from_chars.hpp>
+#include <pni/core/types.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+template<typename T>
+from_chars_result parse(const char *s,T &value)
+{
+    return from_chars(s,s+std::strlen(s),value);
+}
+
+BOOST_AUTO_TEST_SUITE(from_chars_test)
+
+    BOOST_AUTO_TEST_CASE(test_float64)
+    {
+        float64 value;
+        for(const char *s: {"0","1","-1","+2.5","1.","-.5","1e3","1.2345E-12",
+                            "0.1","123456789012345","3.14159265358979",
+                            "1.7976931348623157e308","4.9e-324",
+                            "123456789012345678901234567890","1e-400"})
+        {
+            from_chars_result r = parse(s,value);
+            BOOST_CHECK(r.ec == std::errc());
+            BOOST_CHECK(r.ptr == s+std::strlen(s));
+            BOOST_CHECK_EQUAL(value,std::strtod(s,nullptr));
+        }
+
+        BOOST_CHECK(parse("inf",value).ec == std::errc());
+        BOOST_CHECK(std::isinf(value));
+        BOOST_CHECK(parse("-Infinity",value).ec == std::errc());
+        BOOST_CHECK(std::isinf(value) && value<0);
+        BOOST_CHECK(parse("NaN",value).ec == std::errc());
+        BOOST_CHECK(std::isnan(value));
+    }
+
+    BOOST_AUTO_TEST_CASE(test_float32)
+    {
+        float32 value;
+        for(const char *s: {"0","-1","0.1","2.5e-3","16777217","1e-30",
+                            "3.4028234e38","1.23456789012",
+                            "1.00000005960464477550"})
+        {
+            BOOST_CHECK(parse(s,value).ec == std::errc());
+            BOOST_CHECK_EQUAL(value,std::strtof(s,nullptr));
+        }
+
+        BOOST_CHECK(parse("1e39",value).ec == std::errc::result_out_of_range);
+        BOOST_CHECK(parse("-inf",value).ec == std::errc());
+        BOOST_CHECK(std::isinf(value) && value<0);
+        BOOST_CHECK(parse("nan",value).ec == std::errc());
+        BOOST_CHECK(std::isnan(value));
+    }
+
+    BOOST_AUTO_TEST_CASE(test_partial_input)
+    {
+        float64 value;
+        const char *s = "1.5e+ 2";
+        from_chars_result r = parse(s,value);
+        BOOST_CHECK(r.ec == std::errc());
+        BOOST_CHECK(r.ptr == s+3);
+        BOOST_CHECK_EQUAL(value,1.5);
+
+        s = "12abc";
+        r = parse(s,value);
+        BOOST_CHECK(r.ptr == s+2);
+
+        for(const char *s: {""," 1","abc","-",".","e5","+-1"})
+        {
+            r = parse(s,value);
+            BOOST_CHECK(r.ec == std::errc::invalid_argument);
+            BOOST_CHECK(r.ptr == s);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(test_integers)
+    {
+        int64 ivalue;
+        uint64 uvalue;
+        BOOST_CHECK(parse("-9223372036854775808",ivalue).ec == std::errc());
+        BOOST_CHECK(ivalue == std::numeric_limits<int64>::min());
+        BOOST_CHECK(parse("9223372036854775808",ivalue).ec == 
+                    std::errc::result_out_of_range);
+        BOOST_CHECK(parse("-+1",ivalue).ec == std::errc::invalid_argument);
+
+        BOOST_CHECK(parse("18446744073709551615",uvalue).ec == std::errc());
+        BOOST_CHECK(uvalue == std::numeric_limits<uint64>::max());
+        BOOST_CHECK(parse("18446744073709551616",uvalue).ec == 
+                    std::errc::result_out_of_range);
+        BOOST_CHECK(parse("-1",uvalue).ec == std::errc::invalid_argument);
+
+        const char *s = "12.5";
+        BOOST_CHECK(parse(s,uvalue).ptr == s+2);
+        BOOST_CHECK_EQUAL(uvalue,12);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
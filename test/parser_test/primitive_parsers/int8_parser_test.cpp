@@ -50,5 +50,27 @@ BOOST_FIXTURE_TEST_SUITE(int8_parser_test,int8_parser_test_fixture)
         BOOST_CHECK_THROW(p("-10a0"),parser_error);
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_range_error)
+    {
+        BOOST_CHECK(p("127") == 127);
+        BOOST_CHECK(p("-128") == -128);
+        BOOST_CHECK_THROW(p("128"),parser_error);
+        BOOST_CHECK_THROW(p("-129"),parser_error);
+        BOOST_CHECK_THROW(p("40000"),parser_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_error_codes)
+    {
+        int8 value = 3;
+        BOOST_CHECK(p.parse("-100",value) == std::errc());
+        BOOST_CHECK(value == -100);
+        BOOST_CHECK(p.parse("128",value) == std::errc::result_out_of_range);
+        BOOST_CHECK(p.parse("a10",value) == std::errc::invalid_argument);
+        BOOST_CHECK(p.parse("",value) == std::errc::invalid_argument);
+        BOOST_CHECK(value == -100);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -51,5 +51,24 @@ BOOST_FIXTURE_TEST_SUITE(uint8_parser_test,uint8_parser_test_fixture)
         BOOST_CHECK_THROW(p("-3"),parser_error);
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_range_error)
+    {
+        BOOST_CHECK(p("255") == 255);
+        BOOST_CHECK_THROW(p("256"),parser_error);
+        BOOST_CHECK_THROW(p("70000"),parser_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_error_codes)
+    {
+        uint8 value = 3;
+        BOOST_CHECK(p.parse("+12",value) == std::errc());
+        BOOST_CHECK(value == 12);
+        BOOST_CHECK(p.parse("256",value) == std::errc::result_out_of_range);
+        BOOST_CHECK(p.parse("-3",value) == std::errc::invalid_argument);
+        BOOST_CHECK(value == 12);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,144 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+//************************************************************************
+//
+//  Created on: Oct 17, 2026
+//
+
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include <limits>
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/cbf_batch_reader.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+BOOST_AUTO_TEST_SUITE(cbf_batch_reader_test)
+
+    typedef std::vector<int32> frame_type;
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_file_sequence)
+    {
+        auto files = cbf::file_sequence("scan_%05d.cbf",8,12,2);
+        std::vector<string> ref{"scan_00008.cbf","scan_00010.cbf",
+                                "scan_00012.cbf"};
+        BOOST_CHECK_EQUAL_COLLECTIONS(files.begin(),files.end(),
+                                      ref.begin(),ref.end());
+
+        files = cbf::file_sequence("/data/img%d.cbf",9,10);
+        BOOST_CHECK(files.size() == 2);
+        BOOST_CHECK(files[0] == "/data/img9.cbf");
+        BOOST_CHECK(files[1] == "/data/img10.cbf");
+
+        //the sequence must not overflow at the end of the range
+        size_t max = std::numeric_limits<size_t>::max();
+        files = cbf::file_sequence("img%d.cbf",max-4,max,3);
+        BOOST_CHECK(files.size() == 2);
+        BOOST_CHECK(cbf::file_sequence("img%d.cbf",2,1).empty());
+
+        BOOST_CHECK_THROW(cbf::file_sequence("scan.cbf",0,1),value_error);
+        BOOST_CHECK_THROW(cbf::file_sequence("scan_%05s.cbf",0,1),value_error);
+        BOOST_CHECK_THROW(cbf::file_sequence("scan_%d_%d.cbf",0,1),value_error);
+        BOOST_CHECK_THROW(cbf::file_sequence("scan_%d.cbf",0,1,0),value_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_glob)
+    {
+        auto files = cbf::glob("LAOS*.cbf");
+        BOOST_CHECK(files.size() == 1);
+        BOOST_CHECK(files[0] == "LAOS3_05461.cbf");
+
+        files = cbf::glob("./?i*.tiff");
+        std::vector<string> ref{"./ii32.tiff","./ii8.tiff","./ui32.tiff"};
+        BOOST_CHECK_EQUAL_COLLECTIONS(files.begin(),files.end(),
+                                      ref.begin(),ref.end());
+
+        BOOST_CHECK(cbf::glob("*.nothing").empty());
+        BOOST_CHECK_THROW(cbf::glob("no_such_dir/*.cbf"),file_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_in_order)
+    {
+        cbf_reader reader("LAOS3_05461.cbf");
+        auto ref = reader.image<frame_type>(0);
+
+        std::vector<string> files(20,"LAOS3_05461.cbf");
+        for(size_t nthreads: {1,2,4})
+        {
+            for(size_t prefetch: {1,3,8})
+            {
+                cbf_batch_reader<frame_type> batch(files,nthreads,prefetch);
+                BOOST_CHECK(batch.size() == files.size());
+                BOOST_CHECK(batch.prefetch() == prefetch);
+                BOOST_CHECK(batch.nthreads() <= nthreads);
+
+                frame_type frame;
+                size_t nframes = 0;
+                while(batch.next(frame))
+                {
+                    BOOST_CHECK(frame == ref);
+                    ++nframes;
+                }
+                BOOST_CHECK(nframes == files.size());
+                BOOST_CHECK(!batch.next(frame));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        std::vector<string> files{"LAOS3_05461.cbf","ii8.tiff",
+                                  "no_such_file.cbf","LAOS3_05461.cbf"};
+        cbf_batch_reader<frame_type> batch(files,2,2);
+
+        frame_type frame;
+        BOOST_CHECK(batch.next(frame));
+        BOOST_CHECK_THROW(batch.next(frame),file_error);
+        BOOST_CHECK_THROW(batch.next(frame),file_error);
+        BOOST_CHECK(batch.next(frame));
+        BOOST_CHECK(frame.size() == 94965);
+        BOOST_CHECK(!batch.next(frame));
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_early_destruction)
+    {
+        //the destructor must stop the workers even if frames are pending
+        std::vector<string> files(50,"LAOS3_05461.cbf");
+        cbf_batch_reader<frame_type> batch(files,4,4);
+
+        frame_type frame;
+        BOOST_CHECK(batch.next(frame));
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_empty)
+    {
+        cbf_batch_reader<frame_type> batch(std::vector<string>{});
+        frame_type frame;
+        BOOST_CHECK(batch.size() == 0);
+        BOOST_CHECK(!batch.next(frame));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
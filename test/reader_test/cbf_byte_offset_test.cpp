@@ -0,0 +1,252 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+//************************************************************************
+//
+//  Created on: Oct 17, 2026
+//
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/byte_offset.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+namespace {
+
+    typedef std::vector<unsigned char> stream_type;
+
+    const std::vector<cbf::simd_extension> extensions{
+        cbf::simd_extension::SSE2,cbf::simd_extension::AVX2};
+
+    //------------------------------------------------------------------------
+    // append a difference to a stream using the smallest possible encoding
+    void append(stream_type &s,int64 delta)
+    {
+        auto put = [&s](int64 v,size_t n)
+        {
+            for(size_t i=0;i<n;++i)
+                s.push_back(static_cast<unsigned char>(
+                            (static_cast<uint64>(v)>>(8*i))&0xFF));
+        };
+
+        if(delta>-128 && delta<128) { put(delta,1); return; }
+        s.push_back(0x80);
+        if(delta>-32768 && delta<32768) { put(delta,2); return; }
+        put(-32768,2);
+        if(delta>-2147483647-1 && delta<=2147483647) { put(delta,4); return; }
+        put(-2147483647-1,4);
+        put(delta,8);
+    }
+
+    //------------------------------------------------------------------------
+    // decode a stream with the scalar and all available SIMD implementations
+    // and check that the results are identical
+    void check_bit_exact(const char *buffer,size_t size,size_t n)
+    {
+        std::vector<int32> ref(n);
+        size_t nref = cbf::decode_byte_offset(cbf::simd_extension::NONE,
+                                              buffer,size,ref.data(),n);
+
+        for(auto ext: extensions)
+        {
+            if(!cbf::byte_offset_simd_supported(ext)) continue;
+
+            std::vector<int32> data(n);
+            size_t ndata = cbf::decode_byte_offset(ext,buffer,size,
+                                                   data.data(),n);
+            BOOST_CHECK(ndata == nref);
+            BOOST_CHECK(data == ref);
+        }
+    }
+
+    void check_bit_exact(const stream_type &s,size_t n)
+    {
+        check_bit_exact(reinterpret_cast<const char*>(s.data()),s.size(),n);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(cbf_byte_offset_test)
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_laos)
+    {
+        std::ifstream stream("LAOS3_05461.cbf",std::ios::binary);
+        std::string file((std::istreambuf_iterator<char>(stream)),
+                         std::istreambuf_iterator<char>());
+        size_t offset = file.find("\x0c\x1a\x04\xd5")+4;
+
+        check_bit_exact(file.data()+offset,95733,94965);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_laos_reference)
+    {
+        //reference values obtained with the stream based decoder of
+        //dectris_reader which was used before the buffer based decoder
+        std::ifstream stream("LAOS3_05461.cbf",std::ios::binary);
+        std::string file((std::istreambuf_iterator<char>(stream)),
+                         std::istreambuf_iterator<char>());
+        size_t offset = file.find("\x0c\x1a\x04\xd5")+4;
+
+        auto all = extensions;
+        all.push_back(cbf::simd_extension::NONE);
+        for(auto ext: all)
+        {
+            if(!cbf::byte_offset_simd_supported(ext)) continue;
+
+            std::vector<int32> data(94965);
+            BOOST_CHECK(cbf::decode_byte_offset(ext,file.data()+offset,95733,
+                                                data.data(),
+                                                data.size()) == 95733);
+
+            int64 sum = 0;
+            uint64 hash = 14695981039346656037ULL; //FNV-1a
+            for(auto v: data)
+            {
+                sum += v;
+                hash = (hash^uint32(v))*1099511628211ULL;
+            }
+            BOOST_CHECK_EQUAL(sum,5194632);
+            BOOST_CHECK_EQUAL(hash,2396783215073407603ULL);
+            BOOST_CHECK_EQUAL(*std::min_element(data.begin(),data.end()),-2);
+            BOOST_CHECK_EQUAL(*std::max_element(data.begin(),data.end()),1447);
+            BOOST_CHECK_EQUAL(data[0],33);
+            BOOST_CHECK_EQUAL(data[1],34);
+            BOOST_CHECK_EQUAL(data[486],19);
+            BOOST_CHECK_EQUAL(data[487],25);
+            BOOST_CHECK_EQUAL(data[10000],70);
+            BOOST_CHECK_EQUAL(data[47482],149);
+            BOOST_CHECK_EQUAL(data[94964],14);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_single_byte_extremes)
+    {
+        stream_type s;
+        for(size_t i=0;i<1000;++i) append(s,i%2 ? 127 : -127);
+        check_bit_exact(s,1000);
+
+        s.clear();
+        for(size_t i=0;i<1000;++i) append(s,127);
+        check_bit_exact(s,1000);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_all_escapes)
+    {
+        stream_type s;
+        for(size_t i=0;i<500;++i) append(s,i%2 ? 30000 : -30000);
+        check_bit_exact(s,500);
+
+        s.clear();
+        for(size_t i=0;i<500;++i) append(s,i%2 ? 2000000 : -2000000);
+        check_bit_exact(s,500);
+
+        s.clear();
+        for(size_t i=0;i<500;++i) append(s,i%2 ? 5000000000 : -5000000000);
+        check_bit_exact(s,500);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_block_boundaries)
+    {
+        //an escape at every position within and around a SIMD block
+        for(size_t pos=0;pos<70;++pos)
+        {
+            stream_type s;
+            for(size_t i=0;i<100;++i) append(s,i==pos ? 1000 : -3);
+            check_bit_exact(s,100);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_wrap_around)
+    {
+        //the running value leaves the 32Bit range
+        stream_type s;
+        for(size_t i=0;i<100;++i) append(s,2147483647);
+        for(size_t i=0;i<100;++i) append(s,100);
+        check_bit_exact(s,200);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_random_lengths)
+    {
+        std::mt19937 engine(42);
+        std::uniform_int_distribution<int> level(0,99);
+        std::uniform_int_distribution<int64> small(-127,127);
+        std::uniform_int_distribution<int64> large(-40000000,40000000);
+
+        for(size_t n=0;n<200;++n)
+        {
+            stream_type s;
+            for(size_t i=0;i<n;++i)
+                append(s,level(engine)<90 ? small(engine) : large(engine));
+            check_bit_exact(s,n);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_truncated)
+    {
+        stream_type s;
+        for(size_t i=0;i<64;++i) append(s,1);
+        append(s,100000);
+
+        auto all = extensions;
+        all.push_back(cbf::simd_extension::NONE);
+        for(auto ext: all)
+        {
+            if(!cbf::byte_offset_simd_supported(ext)) continue;
+
+            std::vector<int32> data(65);
+            BOOST_CHECK_THROW(cbf::decode_byte_offset(ext,
+                        reinterpret_cast<const char*>(s.data()),s.size()-1,
+                        data.data(),data.size()),file_error);
+            BOOST_CHECK_THROW(cbf::decode_byte_offset(ext,
+                        reinterpret_cast<const char*>(s.data()),40,
+                        data.data(),data.size()),file_error);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_container_conversion)
+    {
+        stream_type s;
+        for(size_t i=0;i<10000;++i) append(s,i%7==0 ? 300 : -1);
+
+        std::vector<int32> ref(10000);
+        cbf::decode_byte_offset(reinterpret_cast<const char*>(s.data()),
+                                s.size(),ref);
+
+        std::vector<float64> data(10000);
+        cbf::decode_byte_offset(reinterpret_cast<const char*>(s.data()),
+                                s.size(),data);
+        BOOST_CHECK(std::equal(ref.begin(),ref.end(),data.begin()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
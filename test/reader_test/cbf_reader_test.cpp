@@ -22,7 +22,14 @@
 ///
 
 #include <boost/test/unit_test.hpp>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <vector>
+#include <pni/core/error.hpp>
 #include <pni/io/cbf/cbf_reader.hpp>
+#include <pni/io/cbf/byte_offset.hpp>
+#include <pni/io/cbf/header_parser.hpp>
 #include <pni/io/image_info.hpp>
 
 using namespace pni::core;
@@ -56,5 +63,128 @@ BOOST_AUTO_TEST_SUITE(cbf_reader_test)
 
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_laos_data)
+    {
+        cbf_reader reader("LAOS3_05461.cbf");
+        std::vector<int32> ref{33,34,32,34,25,24,43,30,29,27};
+
+        auto data = reader.image<std::vector<int32>>(0);
+        BOOST_CHECK(data.size() == 94965);
+        BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(),data.begin()+10,
+                                      ref.begin(),ref.end());
+        BOOST_CHECK(data.back() == 14);
+        BOOST_CHECK(std::accumulate(data.begin(),data.end(),int64(0)) == 5194632);
+
+        //reading the image a second time must yield the same result
+        auto data2 = reader.image<std::vector<float64>>(0);
+        BOOST_CHECK(std::equal(data.begin(),data.end(),data2.begin()));
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_decode_byte_offset)
+    {
+        //one difference for every escape level
+        std::vector<unsigned char> stream{0x05,0xFE,
+                                          0x80,0xE8,0x03,
+                                          0x80,0x00,0x80,0xA0,0x86,0x01,0x00,
+                                          0x80,0x00,0x80,0x00,0x00,0x00,0x80,
+                                          0x78,0x75,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+                                          0x7F};
+        std::vector<int64> ref{5,3,1003,101003,3,130};
+        std::vector<int64> data(ref.size());
+
+        size_t n = cbf::decode_byte_offset(
+                reinterpret_cast<const char*>(stream.data()),
+                stream.size(),data);
+        BOOST_CHECK(n == stream.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(),data.end(),
+                                      ref.begin(),ref.end());
+
+        //a truncated stream must throw
+        BOOST_CHECK_THROW(cbf::decode_byte_offset(
+                reinterpret_cast<const char*>(stream.data()),
+                stream.size()-3,data),file_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_parse_binary_header)
+    {
+        std::ifstream stream("LAOS3_05461.cbf",std::ios::binary);
+        string buffer;
+        size_t offset = cbf::read_header_block(stream,buffer);
+        BOOST_REQUIRE(offset != string::npos);
+
+        const char *begin = buffer.data();
+        const char *end   = begin+offset;
+        BOOST_CHECK(cbf::header_convention(begin,end) == "\"SLS/DECTRIS_1.1\"");
+
+        auto header = cbf::parse_binary_header(begin,end);
+        BOOST_CHECK(header.compression == cbf::compression_id::CBF_BYTE_OFFSET);
+        BOOST_CHECK(header.element_type == type_id_t::INT32);
+        BOOST_CHECK(header.element_bits == 32);
+        BOOST_CHECK(header.nx == 195);
+        BOOST_CHECK(header.ny == 487);
+        BOOST_CHECK(header.binary_size == 95733);
+        BOOST_CHECK(header.nelements == 94965);
+        BOOST_CHECK(header.md5 == "P+cm5LOg209YyMjMqdJ/7w==");
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_parse_binary_header_errors)
+    {
+        string h = "conversions=\"x-CBF_BYTE_OFFSET\"\r\n"
+                   "X-Binary-Element-Type: \"signed 16-bit integer\"\r\n"
+                   "X-Binary-Size-Fastest-Dimension: 10\r\n"
+                   "X-Binary-Size-Second-Dimension: 20\r\n";
+        auto header = cbf::parse_binary_header(h.data(),h.data()+h.size());
+        BOOST_CHECK(header.element_type == type_id_t::INT16);
+        BOOST_CHECK(header.nx == 20);
+        BOOST_CHECK(header.ny == 10);
+        BOOST_CHECK(header.binary_size == 0);
+        BOOST_CHECK(header.md5.empty());
+
+        //missing dimension
+        string e = h.substr(0,h.find("X-Binary-Size-Second"));
+        BOOST_CHECK_THROW(cbf::parse_binary_header(e.data(),e.data()+e.size()),
+                          file_error);
+
+        //unsupported compression and element type
+        e = "conversions=\"x-CBF_PACKED\"\r\n";
+        BOOST_CHECK_THROW(cbf::parse_binary_header(e.data(),e.data()+e.size()),
+                          file_error);
+        e = "X-Binary-Element-Type: \"unsigned 8-bit integer\"\r\n";
+        BOOST_CHECK_THROW(cbf::parse_binary_header(e.data(),e.data()+e.size()),
+                          file_error);
+
+        //no binary marker
+        std::stringstream ss("###CBF: VERSION 1.5\n");
+        string buffer;
+        BOOST_CHECK(cbf::read_header_block(ss,buffer) == string::npos);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_stream_backend)
+    {
+        cbf_reader mapped("LAOS3_05461.cbf");
+        cbf_reader streamed("LAOS3_05461.cbf");
+        streamed.use_mmap(false);
+
+        auto ref  = mapped.image<std::vector<int32>>(0);
+        auto data = streamed.image<std::vector<int32>>(0);
+        BOOST_CHECK(data == ref);
+
+        //switching the backend of an open reader
+        mapped.use_mmap(false);
+        BOOST_CHECK(mapped.image<std::vector<int32>>(0) == ref);
+        streamed.use_mmap(true);
+        BOOST_CHECK(streamed.image<std::vector<int32>>(0) == ref);
+
+        //re-opening the file
+        streamed.open();
+        BOOST_CHECK(streamed.nimages() == 1);
+        BOOST_CHECK(streamed.image<std::vector<int32>>(0) == ref);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
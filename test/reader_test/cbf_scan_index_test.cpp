@@ -0,0 +1,295 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+//************************************************************************
+//
+//  Created on: Oct 17, 2026
+//
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/cbf/cbf_reader.hpp>
+#include <pni/io/cbf/cbf_batch_reader.hpp>
+#include <pni/io/cbf/scan_index.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+//create a scan from copies of the LAOS file in the current directory
+struct scan_fixture
+{
+    std::vector<string> files;
+    string index_file;
+
+    scan_fixture():
+        files(cbf::file_sequence("scan_index_test_%05d.cbf",1,3)),
+        index_file("./"+cbf::scan_index::index_name)
+    {
+        for(const auto &file: files)
+        {
+            std::ifstream in("LAOS3_05461.cbf",std::ios::binary);
+            std::ofstream out(file.c_str(),std::ios::binary);
+            out<<in.rdbuf();
+        }
+        std::remove(index_file.c_str());
+    }
+
+    ~scan_fixture()
+    {
+        for(const auto &file: files) std::remove(file.c_str());
+        std::remove(index_file.c_str());
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(cbf_scan_index_test,scan_fixture)
+
+    typedef std::vector<int32> frame_type;
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_frame_record)
+    {
+        auto record = cbf::read_frame_record("LAOS3_05461.cbf");
+        BOOST_CHECK(record.file == "LAOS3_05461.cbf");
+        BOOST_CHECK(record.nx == 195);
+        BOOST_CHECK(record.ny == 487);
+        BOOST_CHECK(record.element_type == type_id_t::INT32);
+        BOOST_CHECK(record.element_bits == 32);
+        BOOST_CHECK(record.data_size == 95733);
+        BOOST_CHECK(record.info().npixels() == 94965);
+
+        //the binary section follows the marker
+        std::ifstream stream("LAOS3_05461.cbf",std::ios::binary);
+        stream.seekg(record.data_offset-4);
+        char marker[4];
+        stream.read(marker,4);
+        BOOST_CHECK(marker[0] == '\x0c' && marker[1] == '\x1a' &&
+                    marker[2] == '\x04' && marker[3] == '\xd5');
+
+        BOOST_CHECK(record.header.detector == "PILATUS 100K, S/N 1-0009, Desy");
+        BOOST_CHECK(record.header.timestamp == "2010-Dec-14T21:43:23.655");
+        BOOST_CHECK_CLOSE(record.header.exposure_time,0.097,1.e-8);
+        BOOST_CHECK_CLOSE(record.header.exposure_period,0.1,1.e-8);
+        BOOST_CHECK(std::isnan(record.header.start_angle));
+        BOOST_CHECK(std::isnan(record.header.angle_increment));
+
+        BOOST_CHECK_THROW(cbf::read_frame_record("no_such_file.cbf"),
+                          file_error);
+        BOOST_CHECK_THROW(cbf::read_frame_record("ii8.tiff"),file_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_build)
+    {
+        auto index = cbf::scan_index::build(".","scan_index_test_*.cbf");
+        BOOST_CHECK(index.size() == 3);
+        BOOST_CHECK(index.pattern() == "scan_index_test_*.cbf");
+        BOOST_CHECK(index[0].file == "./scan_index_test_00001.cbf");
+        BOOST_CHECK(index.at(2).file == "./scan_index_test_00003.cbf");
+        BOOST_CHECK_THROW(index.at(3),index_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_save_load)
+    {
+        auto index = cbf::scan_index::build(".","scan_index_test_*.cbf");
+        index.save(index_file);
+
+        auto loaded = cbf::scan_index::load(index_file);
+        BOOST_REQUIRE(loaded.size() == index.size());
+        BOOST_CHECK(loaded.pattern() == index.pattern());
+        for(size_t i=0;i<index.size();++i)
+        {
+            BOOST_CHECK(loaded[i].file == index[i].file);
+            BOOST_CHECK(loaded[i].nx == index[i].nx);
+            BOOST_CHECK(loaded[i].ny == index[i].ny);
+            BOOST_CHECK(loaded[i].element_type == index[i].element_type);
+            BOOST_CHECK(loaded[i].data_offset == index[i].data_offset);
+            BOOST_CHECK(loaded[i].data_size == index[i].data_size);
+            BOOST_CHECK(loaded[i].header.timestamp == index[i].header.timestamp);
+            BOOST_CHECK(loaded[i].header.exposure_time ==
+                        index[i].header.exposure_time);
+        }
+
+        //a truncated index is rejected
+        {
+            std::ofstream out(index_file.c_str(),std::ios::binary);
+            out<<"PNICBFIX";
+        }
+        BOOST_CHECK_THROW(cbf::scan_index::load(index_file),file_error);
+        BOOST_CHECK_THROW(cbf::scan_index::load("LAOS3_05461.cbf"),file_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_save_load_subdirectory)
+    {
+        namespace fs = boost::filesystem;
+        fs::path directory("scan_index_test_dir");
+        fs::create_directories(directory/"sub");
+        fs::copy_file(files[0],directory/"sub"/"frame_00001.cbf",
+                      fs::copy_option::overwrite_if_exists);
+        string fname = (directory/cbf::scan_index::index_name).string();
+
+        //files below the index directory
+        auto index = cbf::scan_index::build(directory.string(),"sub/*.cbf");
+        BOOST_REQUIRE(index.size() == 1);
+        index.save(fname);
+        auto loaded = cbf::scan_index::load(fname);
+        BOOST_REQUIRE(loaded.size() == 1);
+        BOOST_CHECK(loaded[0].file == index[0].file);
+        BOOST_CHECK(fs::exists(loaded[0].file));
+
+        index = cbf::scan_index::open(directory.string(),"sub/*.cbf");
+        BOOST_REQUIRE(index.size() == 1);
+        BOOST_CHECK(fs::exists(index[0].file));
+
+        //files outside of the index directory
+        index = cbf::scan_index::build(".","scan_index_test_*.cbf");
+        index.save(fname);
+        loaded = cbf::scan_index::load(fname);
+        BOOST_REQUIRE(loaded.size() == index.size());
+        for(size_t i=0;i<index.size();++i)
+            BOOST_CHECK(fs::equivalent(loaded[i].file,index[i].file));
+
+        fs::remove_all(directory);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_open)
+    {
+        auto index = cbf::scan_index::open(".","scan_index_test_*.cbf");
+        BOOST_CHECK(index.size() == 3);
+        BOOST_CHECK(std::ifstream(index_file.c_str()).good());
+
+        //removed files are dropped from the index
+        std::remove(files[2].c_str());
+        index = cbf::scan_index::open(".","scan_index_test_*.cbf");
+        BOOST_CHECK(index.size() == 2);
+        BOOST_CHECK(cbf::scan_index::load(index_file).size() == 2);
+
+        //rebuilding or a different pattern replaces the index file
+        index = cbf::scan_index::open(".","scan_index_test_*.cbf",true);
+        BOOST_CHECK(index.size() == 2);
+        index = cbf::scan_index::open(".","scan_index_test_00001.cbf");
+        BOOST_CHECK(index.size() == 1);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_open_modified)
+    {
+        auto index = cbf::scan_index::open(".","scan_index_test_*.cbf");
+        BOOST_REQUIRE(index.size() == 3);
+        BOOST_CHECK(!index[1].is_stale());
+
+        //a file added after the index was written
+        string added = "scan_index_test_00004.cbf";
+        {
+            std::ifstream in("LAOS3_05461.cbf",std::ios::binary);
+            std::ofstream out(added.c_str(),std::ios::binary);
+            out<<in.rdbuf();
+        }
+        index = cbf::scan_index::open(".","scan_index_test_*.cbf");
+        BOOST_CHECK(index.size() == 4);
+
+        //a file rewritten in place with a longer header
+        {
+            std::ifstream in("LAOS3_05461.cbf",std::ios::binary);
+            std::ofstream out(files[1].c_str(),std::ios::binary);
+            out<<"###CBF: padded\r\n"<<in.rdbuf();
+        }
+        BOOST_CHECK(index[1].is_stale());
+        size_t offset = index[1].data_offset;
+
+        index = cbf::scan_index::open(".","scan_index_test_*.cbf");
+        BOOST_REQUIRE(index.size() == 4);
+        BOOST_CHECK(index[1].data_offset != offset);
+        BOOST_CHECK(!index[1].is_stale());
+
+        cbf_reader ref_reader("LAOS3_05461.cbf");
+        cbf_reader reader(index[1]);
+        BOOST_CHECK(reader.image<frame_type>(0) ==
+                    ref_reader.image<frame_type>(0));
+
+        std::remove(added.c_str());
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_load_invalid_enum)
+    {
+        auto index = cbf::scan_index::build(".","scan_index_test_*.cbf");
+        index.save(index_file);
+
+        //overwrite the element type of the first record
+        string buffer;
+        {
+            std::ifstream in(index_file.c_str(),std::ios::binary);
+            buffer.assign(std::istreambuf_iterator<char>(in),
+                          std::istreambuf_iterator<char>());
+        }
+        //magic, bom, version, pattern, nrecords, file name, nx, ny
+        size_t pos = 8+4+4+4+index.pattern().size()+8+
+                     4+string("scan_index_test_00001.cbf").size()+8+8;
+        BOOST_REQUIRE(pos+1<buffer.size());
+        BOOST_REQUIRE(uint8(buffer[pos]) ==
+                      static_cast<uint8>(index[0].element_type));
+
+        buffer[pos] = char(0xff);
+        {
+            std::ofstream out(index_file.c_str(),std::ios::binary);
+            out<<buffer;
+        }
+        BOOST_CHECK_THROW(cbf::scan_index::load(index_file),file_error);
+
+        //restore the type and break the compression
+        buffer[pos] = char(static_cast<uint8>(index[0].element_type));
+        buffer[pos+1] = char(0xff);
+        {
+            std::ofstream out(index_file.c_str(),std::ios::binary);
+            out<<buffer;
+        }
+        BOOST_CHECK_THROW(cbf::scan_index::load(index_file),file_error);
+
+        //open replaces the broken index
+        BOOST_CHECK(cbf::scan_index::open(".","scan_index_test_*.cbf").size() == 3);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_image)
+    {
+        cbf_reader ref_reader("LAOS3_05461.cbf");
+        auto ref = ref_reader.image<frame_type>(0);
+
+        auto index = cbf::scan_index::open(".","scan_index_test_*.cbf");
+        for(const auto &record: index)
+        {
+            cbf_reader reader(record);
+            BOOST_CHECK(reader.nimages() == 1);
+            BOOST_CHECK(reader.info(0).nx() == 195);
+            BOOST_CHECK(reader.image<frame_type>(0) == ref);
+
+            //reading the same frame twice yields the same data
+            BOOST_CHECK(reader.image<frame_type>(0) == ref);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,80 @@
+//
+// (c) Copyright 2026 DESY
+//
+// This file is part of libpniio.
+//
+// libpniio is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpniio is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpniio.  If not, see <http://www.gnu.org/licenses/>.
+//************************************************************************
+//
+//  Created on: Oct 17, 2026
+//
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
+#include <pni/io/file_map.hpp>
+
+using namespace pni::core;
+using namespace pni::io;
+
+BOOST_AUTO_TEST_SUITE(file_map_test)
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_map)
+    {
+        std::ifstream stream("LAOS3_05461.cbf",std::ios::binary);
+        std::vector<char> ref((std::istreambuf_iterator<char>(stream)),
+                              std::istreambuf_iterator<char>());
+
+        file_map map("LAOS3_05461.cbf");
+        BOOST_CHECK(map.is_mapped());
+        BOOST_REQUIRE(map.size() == ref.size());
+        BOOST_CHECK(std::equal(ref.begin(),ref.end(),map.data()));
+
+        file_map moved(std::move(map));
+        BOOST_CHECK(!map.is_mapped());
+        BOOST_CHECK(map.size() == 0);
+        BOOST_CHECK(moved.size() == ref.size());
+
+        map = std::move(moved);
+        BOOST_CHECK(map.size() == ref.size());
+        BOOST_CHECK(!moved.is_mapped());
+
+        //the access pattern is only a hint and does not change the data
+        map.advise(file_map::access::SEQUENTIAL);
+        map.advise(file_map::access::RANDOM);
+        BOOST_CHECK(std::equal(ref.begin(),ref.end(),map.data()));
+        moved.advise(file_map::access::NORMAL);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        BOOST_CHECK(!file_map().is_mapped());
+        BOOST_CHECK_THROW(file_map("no_such_file.cbf"),file_error);
+        BOOST_CHECK_THROW(file_map("."),file_error);
+
+        //empty files cannot be mapped
+        std::ofstream("file_map_test_empty.dat");
+        BOOST_CHECK_THROW(file_map("file_map_test_empty.dat"),file_error);
+        std::remove("file_map_test_empty.dat");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,6 +22,8 @@
 //
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/floating_point_comparison.hpp>
+#include <cstdio>
+#include <fstream>
 #include <pni/io/fio/fio_reader.hpp>
 #include "tstfile_00012_pos.hpp"
 #include "tstfile_00012_eh1b_c01.hpp"
@@ -301,6 +303,270 @@ BOOST_AUTO_TEST_CASE(test_multi_column_file)
 }
 
 
+BOOST_AUTO_TEST_CASE(test_column_types)
+{
+	std::string fname = "fio_reader_test_types.fio";
+	{
+		std::ofstream stream(fname);
+		stream<<"!\n! comment\n!\n%p\n motor = 1.5\n!\n%d\n"
+		      <<" Col 1 position DOUBLE\r\n"
+		      <<" Col 2 counts FLOAT\n"
+		      <<" Col 3 monitor INTEGER\n"
+		      <<" 0.12345678901234 1e3 -7\r\n"
+		      <<"\n! comment inside the data section\n"
+		      <<"\t+2.5 -.5 8\n"
+		      <<" 3 1.5E-2 9";
+	}
+
+	pni::io::fio_reader reader(fname);
+	BOOST_CHECK(reader.ncolumns() == 3);
+	BOOST_CHECK(reader.nrecords() == 3);
+	BOOST_CHECK(reader.column_index("position") == 0);
+	BOOST_CHECK(reader.column_index("counts") == 1);
+	BOOST_CHECK(reader.column_index("monitor") == 2);
+
+	auto position = reader.column<std::vector<double>>("position");
+	BOOST_CHECK(position == (std::vector<double>{0.12345678901234,2.5,3.0}));
+	auto counts = reader.column<std::vector<float>>("counts");
+	BOOST_CHECK(counts == (std::vector<float>{1000.f,-0.5f,1.5e-2f}));
+	auto monitor = reader.column<std::vector<int>>("monitor");
+	BOOST_CHECK(monitor == (std::vector<int>{-7,8,9}));
+
+	std::remove(fname.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_records)
+{
+	std::string fname = "fio_reader_test_invalid.fio";
+	for(std::string record: {" 1 2 3\n"," 1 x\n"," 1\n"})
+	{
+		{
+			std::ofstream stream(fname);
+			stream<<"%d\n Col 1 a FLOAT\n Col 2 b FLOAT\n 1 2\n"<<record;
+		}
+		BOOST_CHECK_THROW(pni::io::fio_reader reader(fname),
+		                  pni::core::file_error);
+	}
+
+	std::remove(fname.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_lazy_columns)
+{
+	using container_type = std::vector<double>;
+	pni::io::fio_reader eager("tstfile_00012.fio");
+	pni::io::fio_reader reader("tstfile_00012.fio",true);
+	BOOST_CHECK(reader.nparameters() == 4);
+	BOOST_CHECK(reader.ncolumns() == 14);
+	BOOST_CHECK(reader.nrecords() == 2001);
+	BOOST_CHECK(eager.column_loaded("tstfile_00012_pos"));
+	BOOST_CHECK(!reader.column_loaded("tstfile_00012_pos"));
+
+	auto data = reader.column<container_type>("tstfile_00012_eh1b_c05");
+	BOOST_CHECK(reader.column_loaded("tstfile_00012_eh1b_c05"));
+	BOOST_CHECK(!reader.column_loaded("tstfile_00012_pos"));
+	BOOST_CHECK(data == eager.column<container_type>("tstfile_00012_eh1b_c05"));
+
+	auto columns = reader.columns<container_type>({"tstfile_00012_pos",
+	                                               "tstfile_00012_deltaPos"});
+	BOOST_CHECK(columns.size() == 2);
+	BOOST_CHECK(columns[0] == eager.column<container_type>("tstfile_00012_pos"));
+	BOOST_CHECK(columns[1] == eager.column<container_type>("tstfile_00012_deltaPos"));
+	BOOST_CHECK(reader.column_loaded("tstfile_00012_pos"));
+	BOOST_CHECK(reader.column_loaded("tstfile_00012_deltaPos"));
+	BOOST_CHECK(!reader.column_loaded("tstfile_00012_corr"));
+
+	BOOST_CHECK_THROW(reader.columns<container_type>({"tstfile_00012_pos","x"}),
+	                  pni::core::key_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_lazy_invalid_cell)
+{
+	std::string fname = "fio_reader_test_lazy.fio";
+	{
+		std::ofstream stream(fname);
+		stream<<"%d\n Col 1 a FLOAT\n Col 2 b FLOAT\n 1 2\n 3 x\n";
+	}
+
+	pni::io::fio_reader reader(fname,true);
+	BOOST_CHECK(reader.nrecords() == 2);
+	BOOST_CHECK(reader.column<std::vector<int>>("a") == (std::vector<int>{1,3}));
+	BOOST_CHECK_THROW(reader.column<std::vector<int>>("b"),pni::core::file_error);
+	BOOST_CHECK(!reader.column_loaded("b"));
+	BOOST_CHECK(reader.column_loaded("a"));
+
+	std::remove(fname.c_str());
+}
+
+//write a FIO file with 3 columns which is large enough to be parsed in 
+//several chunks - the record with index bad_record is invalid if given
+static void write_large_fio_file(const std::string &fname,size_t nrecords,
+                                 size_t bad_record=size_t(-1))
+{
+	std::ofstream stream(fname);
+	stream<<"%p\n n = "<<nrecords<<"\n!\n%d\n Col 1 index DOUBLE\n"
+	      <<" Col 2 counts FLOAT\n Col 3 position DOUBLE\n";
+	stream.precision(15);
+	for(size_t i=0;i<nrecords;++i)
+	{
+		if(i%1000==0) stream<<"! comment\n";
+		stream<<" "<<i<<" "<<float(i%977)*0.25f<<" "<<0.001*i+1.0/3.0;
+		if(i==bad_record) stream<<" 1";
+		stream<<"\n";
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_parsing)
+{
+	using container_type = std::vector<double>;
+	std::string fname = "fio_reader_test_parallel.fio";
+	size_t nrecords = 100000;
+	write_large_fio_file(fname,nrecords);
+
+	pni::io::fio_reader serial(fname);
+	BOOST_CHECK(serial.nrecords() == nrecords);
+	auto index = serial.column<container_type>("index");
+	for(size_t i=0;i<nrecords;++i) BOOST_CHECK_EQUAL(index[i],double(i));
+
+	for(size_t nthreads: {2,4,7})
+	{
+		pni::io::fio_reader reader(fname,false,nthreads);
+		BOOST_CHECK(reader.nthreads() == nthreads);
+		BOOST_CHECK(reader.nrecords() == nrecords);
+		for(auto name: {"index","counts","position"})
+			BOOST_CHECK(reader.column<container_type>(name) == 
+			            serial.column<container_type>(name));
+
+		pni::io::fio_reader lazy(fname,true,nthreads);
+		BOOST_CHECK(lazy.nrecords() == nrecords);
+		BOOST_CHECK(lazy.column<container_type>("position") == 
+		            serial.column<container_type>("position"));
+		BOOST_CHECK(!lazy.column_loaded("counts"));
+	}
+
+	std::remove(fname.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_invalid_record)
+{
+	std::string fname = "fio_reader_test_parallel_invalid.fio";
+	write_large_fio_file(fname,100000,76543);
+
+	for(size_t nthreads: {1,4})
+	{
+		try
+		{
+			pni::io::fio_reader reader(fname,false,nthreads);
+			BOOST_ERROR("invalid record not detected");
+		}
+		catch(pni::core::file_error &error)
+		{
+			BOOST_CHECK(error.description().find("Record 76544 ")!=
+			            std::string::npos);
+		}
+	}
+
+	std::remove(fname.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_refresh)
+{
+	using container_type = std::vector<double>;
+	std::string fname = "fio_reader_test_refresh.fio";
+	auto append = [&fname](const std::string &data)
+	{
+		std::ofstream stream(fname,std::ios::app);
+		stream<<data;
+	};
+	{
+		std::ofstream stream(fname);
+		stream<<"%d\n Col 1 a FLOAT\n Col 2 b DOUBLE\n 1 10\n 2 20\n 3 3";
+	}
+
+	pni::io::fio_reader reader(fname);
+	pni::io::fio_reader lazy(fname,true);
+	pni::io::fio_reader unmapped(fname);
+	unmapped.use_mmap(false);
+	BOOST_CHECK(reader.nrecords() == 3);
+	BOOST_CHECK(reader.column<container_type>("b") == (container_type{10,20,3}));
+	BOOST_CHECK(lazy.nrecords() == 3);
+	BOOST_CHECK(lazy.column<container_type>("a") == (container_type{1,2,3}));
+
+	//the last record is completed and a partial record is added
+	append("0\n 4 40\n 5");
+	BOOST_CHECK(reader.refresh() == 1);
+	BOOST_CHECK(reader.nrecords() == 4);
+	BOOST_CHECK(reader.column<container_type>("a") == (container_type{1,2,3,4}));
+	BOOST_CHECK(reader.column<container_type>("b") == (container_type{10,20,30,40}));
+	BOOST_CHECK(lazy.refresh() == 1);
+	BOOST_CHECK(lazy.column<container_type>("a") == (container_type{1,2,3,4}));
+	BOOST_CHECK(unmapped.refresh() == 1);
+	BOOST_CHECK(unmapped.column<container_type>("b") == (container_type{10,20,30,40}));
+	BOOST_CHECK(!lazy.column_loaded("b"));
+
+	append(" 50\n");
+	BOOST_CHECK(reader.refresh() == 1);
+	BOOST_CHECK(reader.refresh() == 0);
+	BOOST_CHECK(reader.column<container_type>("b") == (container_type{10,20,30,40,50}));
+	BOOST_CHECK(lazy.refresh() == 1);
+	BOOST_CHECK(lazy.column<container_type>("b") == (container_type{10,20,30,40,50}));
+	BOOST_CHECK(unmapped.refresh() == 1);
+	BOOST_CHECK(unmapped.column<container_type>("a") == (container_type{1,2,3,4,5}));
+
+	//an invalid record leaves the reader unchanged
+	append(" 6 x\n");
+	BOOST_CHECK_THROW(reader.refresh(),pni::core::file_error);
+	BOOST_CHECK(reader.nrecords() == 5);
+	BOOST_CHECK(reader.column<container_type>("a") == (container_type{1,2,3,4,5}));
+
+	std::remove(fname.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_column_views)
+{
+	using container_type = std::vector<double>;
+	pni::io::fio_reader reader("tstfile_00012.fio");
+	auto pos = reader.column<container_type>("tstfile_00012_pos");
+	auto corr = reader.column<container_type>("tstfile_00012_corr");
+
+	//FLOAT columns are stored in single precision
+	auto view = reader.view<float>("tstfile_00012_pos");
+	BOOST_CHECK(view.is_contiguous());
+	BOOST_CHECK(view.data() != nullptr);
+	BOOST_CHECK(view.size() == reader.nrecords());
+	BOOST_CHECK(reader.view<float>("tstfile_00012_pos").data() == view.data());
+
+	auto converted = reader.view<double>("tstfile_00012_pos");
+	BOOST_CHECK(!converted.is_contiguous());
+	BOOST_CHECK(converted.data() == nullptr);
+	BOOST_CHECK(container_type(converted.begin(),converted.end()) == pos);
+	BOOST_CHECK_EQUAL(converted.at(10),pos[10]);
+	BOOST_CHECK_THROW(converted.at(reader.nrecords()),pni::core::index_error);
+	BOOST_CHECK(std::distance(view.begin(),view.end()) == 2001);
+
+	size_t index = 0;
+	for(auto record: reader.records<double>({"tstfile_00012_corr",
+	                                         "tstfile_00012_pos"}))
+	{
+		BOOST_CHECK(record.size() == 2);
+		BOOST_CHECK(record.index() == index);
+		BOOST_CHECK_EQUAL(record[0],corr[index]);
+		BOOST_CHECK_EQUAL(record[1],pos[index]);
+		++index;
+	}
+	BOOST_CHECK(index == reader.nrecords());
+
+	//views decode the columns of a lazy reader
+	pni::io::fio_reader lazy("tstfile_00012.fio",true);
+	auto records = lazy.records<float>({"tstfile_00012_pos"});
+	BOOST_CHECK(lazy.column_loaded("tstfile_00012_pos"));
+	BOOST_CHECK(records.size() == 2001);
+	BOOST_CHECK(records.column(0).is_contiguous());
+	BOOST_CHECK_EQUAL(records[5][0],float(pos[5]));
+
+	BOOST_CHECK_THROW(reader.view<float>("unknown"),pni::core::key_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,260 @@
+#!/bin/env python
+#
+# Generates TIFF files with several strips, pages and channels. The files
+# are written with the struct module only to have full control over the
+# strip layout and the compression.
+#
+#   stack_ui16.tiff     - 3 pages, 5x7 uint16 pixels, 2 rows per strip,
+#                         pixel value = 1000*page + 10*row + column
+#   rgb_ui16.tiff       - 1 page, 5x7 pixels with 3 interleaved uint16
+#                         channels, 2 rows per strip,
+#                         sample value = 1000*channel + 10*row + column
+#   lzw_rgb_ui16.tiff   - same as rgb_ui16.tiff but LZW compressed with
+#                         horizontal predictor
+#   lzw_ui16.tiff       - 128x128 uint16 pixels, 48 rows per strip, LZW
+#                         compressed with horizontal predictor,
+#                         pixel value = lower 16 bit of hash(128*row+column)
+#   deflate_f32.tiff    - 30x50 float32 pixels, 8 rows per strip, Deflate
+#                         compressed with floating point predictor,
+#                         pixel value = row + column/8 - 3
+#   packbits_ui8.tiff   - 20x30 uint8 pixels, 7 rows per strip, PackBits
+#                         compressed, pixel value = 10*(row/4) + column/8
+#   stack_tiled_ui16.tiff - 2 pages of 40x50 uint16 pixels in 16x16 tiles,
+#                         pixel value = 1000*page + 100*row + column
+#   lzw_tiled_rgb_ui16.tiff - 40x50 RGB uint16 pixels in 16x32 tiles, LZW
+#                         compressed with predictor,
+#                         pixel value = hash(3*(50*row+column)+channel)
+#   mm_stack_ui16.tiff  - big endian version of stack_ui16.tiff
+#   mm_rgb_f64.tiff     - big endian 5x7 pixels with 3 float64 channels,
+#                         sample value = 1000*channel + 10*row + column + 0.25
+#   mm_lzw_ui32.tiff    - big endian 30x40 uint32 pixels, 7 rows per strip,
+#                         LZW compressed with horizontal predictor, 
+#                         pixel value = hash(40*row+column)
+#   mm_deflate_f32.tiff - big endian version of deflate_f32.tiff
+#   stack_i16.btf       - BigTIFF, 3 pages of 5x7 int16 pixels,
+#                         pixel value = -(1000*page + 10*row + column)
+#   mm_stack_tiled_ui16.btf - big endian BigTIFF version of 
+#                         stack_tiled_ui16.tiff
+#
+
+import struct
+import zlib
+
+def hash(i):
+    "integer hash producing data which is hard to compress"
+    x = (i*2654435761)&0xFFFFFFFF
+    x ^= x>>15
+    x = (x*2246822519)&0xFFFFFFFF
+    return x^(x>>13)
+
+def lzw_encode(data):
+    "TIFF style LZW: MSB first codes of 9 to 12 bits with early change"
+    out = bytearray()
+    state = {"bits":0,"nbits":0}
+
+    def put(code,size):
+        state["bits"] = (state["bits"]<<size)|code
+        state["nbits"] += size
+        while state["nbits"]>=8:
+            state["nbits"] -= 8
+            out.append((state["bits"]>>state["nbits"])&0xFF)
+        state["bits"] &= (1<<state["nbits"])-1
+
+    def reset():
+        return dict((bytes((i,)),i) for i in range(256)),258,9
+
+    table,next_code,size = reset()
+    put(256,size)
+    string = b""
+    for c in data:
+        extended = string+bytes((c,))
+        if extended in table:
+            string = extended
+            continue
+        put(table[string],size)
+        table[extended] = next_code
+        next_code += 1
+        if next_code==4094:
+            put(256,size)
+            table,next_code,size = reset()
+        elif next_code>(1<<size)-1:
+            size += 1
+        string = bytes((c,))
+
+    if string:
+        put(table[string],size)
+        next_code += 1
+        if next_code>(1<<size)-1 and size<12: size += 1
+    put(257,size)
+    if state["nbits"]:
+        out.append((state["bits"]<<(8-state["nbits"]))&0xFF)
+    return bytes(out)
+
+def packbits_encode(data):
+    out = bytearray()
+    i = 0
+    while i<len(data):
+        #length of the run starting at i
+        run = 1
+        while i+run<len(data) and run<128 and data[i+run]==data[i]: run += 1
+        if run>=3:
+            out += struct.pack("b",1-run)+data[i:i+1]
+            i += run
+            continue
+        #literal up to the next run of three equal bytes
+        j = i
+        while j<len(data) and j-i<128:
+            if j+2<len(data) and data[j]==data[j+1]==data[j+2]: break
+            j += 1
+        out += struct.pack("b",j-i-1)+data[i:j]
+        i = j
+    return bytes(out)
+
+def predict_horizontal(row,fmt,nchannels,order):
+    samples = struct.unpack(order+"%d%s" % (len(row)//struct.calcsize(fmt),fmt),
+                            row)
+    mask = (1<<(8*struct.calcsize(fmt)))-1
+    diff = list(samples[:nchannels])+[(samples[i]-samples[i-nchannels])&mask
+                                      for i in range(nchannels,len(samples))]
+    return struct.pack(order+"%d%s" % (len(diff),fmt),*diff)
+
+def predict_floating_point(row,fmt,nchannels,order):
+    size = struct.calcsize(fmt)
+    n = len(row)//size
+    #byte planes starting with the most significant byte
+    planes = bytearray(len(row))
+    for s in range(n):
+        for k in range(size):
+            planes[k*n+s] = row[s*size+(size-1-k if order=="<" else k)]
+    return bytes([planes[i] if i<nchannels else
+                  (planes[i]-planes[i-nchannels])&0xFF
+                  for i in range(len(planes))])
+
+def encode_strip(strip,row_size,fmt,nchannels,compression,predictor,
+                 order="<"):
+    rows = [strip[i:i+row_size] for i in range(0,len(strip),row_size)]
+    if predictor==2:
+        rows = [predict_horizontal(r,fmt,nchannels,order) for r in rows]
+    elif predictor==3:
+        rows = [predict_floating_point(r,fmt,nchannels,order) for r in rows]
+
+    if compression==5:
+        return lzw_encode(b"".join(rows))
+    elif compression==8:
+        return zlib.compress(b"".join(rows))
+    elif compression==32773:
+        return b"".join(packbits_encode(r) for r in rows)
+    return b"".join(rows)
+
+def write_tiff(fname,npages,nrows,ncols,nchannels,rows_per_strip,
+               fmt="H",pixel=lambda page,ch,r,c: 1000*(page+ch)+10*r+c,
+               compression=1,predictor=1,tile=None,order="<",big=False):
+    size = struct.calcsize(fmt)
+    sample_format = 3 if fmt in "fd" else (2 if fmt.islower() else 1)
+    row_size = ncols*nchannels*size
+    #offsets and entry counts have 64Bit in BigTIFF files
+    offset,count = ("Q","Q") if big else ("I","H")
+    data = bytearray(b"II" if order=="<" else b"MM")
+    data += struct.pack(order+"H",43 if big else 42)
+    if big: data += struct.pack(order+"HH",8,0)
+    #position of the offset pointing to the next IFD
+    next_ifd = len(data)
+    data += b"\0"*struct.calcsize(offset)
+
+    #tiles have a fixed size - edge tiles are padded with zeros
+    if tile:
+        tile_rows,tile_cols = tile
+        row_size = tile_cols*nchannels*size
+        blocks = [(row,col,tile_rows,tile_cols) 
+                  for row in range(0,nrows,tile_rows)
+                  for col in range(0,ncols,tile_cols)]
+    else:
+        blocks = [(row,0,min(rows_per_strip,nrows-row),ncols)
+                  for row in range(0,nrows,rows_per_strip)]
+
+    for page in range(npages):
+        #write the strips or tiles
+        offsets,counts = [],[]
+        for row,col,block_rows,block_cols in blocks:
+            strip = bytearray()
+            for r in range(row,row+block_rows):
+                for c in range(col,col+block_cols):
+                    for ch in range(nchannels):
+                        v = pixel(page,ch,r,c) if r<nrows and c<ncols else 0
+                        strip += struct.pack(order+fmt,v)
+            offsets.append(len(data))
+            data += encode_strip(bytes(strip),row_size,fmt,nchannels,
+                                 compression,predictor,order)
+            counts.append(len(data)-offsets[-1])
+
+        entries = [(256,4,[ncols]),(257,4,[nrows]),
+                   (258,3,[8*size]*nchannels),(259,3,[compression]),
+                   (262,3,[2 if nchannels==3 else 1]),
+                   (277,3,[nchannels]),(284,3,[1])]
+        if tile:
+            entries += [(322,4,[tile_cols]),(323,4,[tile_rows]),
+                        (324,4,offsets),(325,4,counts)]
+        else:
+            entries += [(273,4,offsets),(278,4,[rows_per_strip]),
+                        (279,4,counts)]
+        if predictor!=1: entries.append((317,3,[predictor]))
+        entries.append((339,3,[sample_format]*nchannels))
+        entries.sort()
+
+        #BigTIFF files store strip offsets and byte counts as LONG8
+        if big:
+            entries = [(tag,16 if tag in (273,279,324,325) else type,values)
+                       for tag,type,values in entries]
+
+        #arrays which do not fit into the value field of an entry
+        fields = []
+        field_size = struct.calcsize(offset)
+        for tag,type,values in entries:
+            value = struct.pack(order+{3:"H",4:"I",16:"Q"}[type]*len(values),
+                                *values)
+            if len(value)>field_size:
+                fields.append((tag,type,len(values),
+                               struct.pack(order+offset,len(data))))
+                data += value
+            else:
+                fields.append((tag,type,len(values),
+                               value+b"\0"*(field_size-len(value))))
+
+        #write the IFD and link it to the previous one
+        data[next_ifd:next_ifd+field_size] = struct.pack(order+offset,
+                                                         len(data))
+        data += struct.pack(order+count,len(fields))
+        for tag,type,n,value in fields:
+            data += struct.pack(order+"HH"+offset,tag,type,n)+value
+        next_ifd = len(data)
+        data += b"\0"*field_size
+
+    with open(fname,"wb") as f:
+        f.write(data)
+
+write_tiff("stack_ui16.tiff",3,5,7,1,2)
+write_tiff("rgb_ui16.tiff",1,5,7,3,2)
+write_tiff("lzw_rgb_ui16.tiff",1,5,7,3,2,compression=5,predictor=2)
+write_tiff("lzw_ui16.tiff",1,128,128,1,48,
+           pixel=lambda p,ch,r,c: hash(128*r+c)&0xFFFF,
+           compression=5,predictor=2)
+write_tiff("deflate_f32.tiff",1,30,50,1,8,fmt="f",
+           pixel=lambda p,ch,r,c: r+c/8.0-3,compression=8,predictor=3)
+write_tiff("packbits_ui8.tiff",1,20,30,1,7,fmt="B",
+           pixel=lambda p,ch,r,c: 10*(r//4)+c//8,compression=32773)
+write_tiff("stack_tiled_ui16.tiff",2,40,50,1,0,tile=(16,16),
+           pixel=lambda p,ch,r,c: 1000*p+100*r+c)
+write_tiff("lzw_tiled_rgb_ui16.tiff",1,40,50,3,0,tile=(16,32),
+           pixel=lambda p,ch,r,c: hash(3*(50*r+c)+ch)&0xFFFF,
+           compression=5,predictor=2)
+write_tiff("mm_stack_ui16.tiff",3,5,7,1,2,order=">")
+write_tiff("mm_rgb_f64.tiff",1,5,7,3,2,fmt="d",order=">",
+           pixel=lambda p,ch,r,c: 1000*ch+10*r+c+0.25)
+write_tiff("mm_lzw_ui32.tiff",1,30,40,1,7,fmt="I",order=">",
+           pixel=lambda p,ch,r,c: hash(40*r+c),compression=5,predictor=2)
+write_tiff("mm_deflate_f32.tiff",1,30,50,1,8,fmt="f",order=">",
+           pixel=lambda p,ch,r,c: r+c/8.0-3,compression=8,predictor=3)
+write_tiff("stack_i16.btf",3,5,7,1,2,fmt="h",big=True,
+           pixel=lambda p,ch,r,c: -1000*p-10*r-c)
+write_tiff("mm_stack_tiled_ui16.btf",2,40,50,1,0,tile=(16,16),order=">",
+           big=True,pixel=lambda p,ch,r,c: 1000*p+100*r+c)
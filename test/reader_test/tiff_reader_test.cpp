@@ -22,10 +22,17 @@
 //
 
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <vector>
 #include <pni/core/types.hpp>
+#include <pni/core/error.hpp>
 #include <pni/io/tiff/tiff_reader.hpp>
+#include <pni/io/tiff/byte_swap.hpp>
+#include <pni/io/tiff/compression.hpp>
+#include <pni/io/tiff/file_format.hpp>
+#include <pni/io/tiff/ifd_cache.hpp>
 #include <pni/io/image_info.hpp>
+#include <pni/io/image_roi.hpp>
 
 using namespace pni::core;
 using namespace pni::io;
@@ -171,4 +178,627 @@ BOOST_AUTO_TEST_SUITE(tiff_reader_test)
     
     }
 
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_stream_backend)
+    {
+        for(auto fname: {"iui8.tiff","ii32.tiff","ui32.tiff","idl_file.tif"})
+        {
+            tiff_reader mapped(fname);
+            tiff_reader streamed(fname);
+            streamed.use_mmap(false);
+            BOOST_CHECK(mapped.use_mmap());
+            BOOST_CHECK(!streamed.use_mmap());
+
+            auto ref  = mapped.image<std::vector<float64>>(0);
+            auto data = streamed.image<std::vector<float64>>(0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(),data.end(),
+                                          ref.begin(),ref.end());
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_data_conversion)
+    {
+        std::vector<int64> ref{1,2,3,4,2,4,6,8};
+        for(bool mmap: {false,true})
+        {
+            tiff_reader reader("iui8.tiff");
+            reader.use_mmap(mmap);
+
+            auto i64 = reader.image<std::vector<int64>>(0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(i64.begin(),i64.end(),
+                                          ref.begin(),ref.end());
+
+            std::vector<float32> f32(8);
+            reader.image(f32,0);
+            BOOST_CHECK_EQUAL_COLLECTIONS(f32.begin(),f32.end(),
+                                          ref.begin(),ref.end());
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //reference data of the files created by gen_stack.py
+    std::vector<uint16> stack_data(size_t first,size_t last,size_t channel=0)
+    {
+        std::vector<uint16> data;
+        for(size_t page=first;page<last;++page)
+            for(size_t row=0;row<5;++row)
+                for(size_t column=0;column<7;++column)
+                    data.push_back(1000*(page+channel)+10*row+column);
+        return data;
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_stack)
+    {
+        //the same stack stored as little and big endian
+        for(string fname: {"stack_ui16.tiff","mm_stack_ui16.tiff"})
+        {
+            for(bool mmap: {false,true})
+            {
+                for(size_t nthreads: {1,2,4,0})
+                {
+                    tiff_reader reader(fname);
+                    reader.use_mmap(mmap);
+                    reader.nthreads(nthreads);
+                    BOOST_CHECK(reader.nthreads() == nthreads);
+                    BOOST_CHECK(reader.nimages() == 3);
+
+                    for(size_t i=0;i<3;++i)
+                    {
+                        auto ref = stack_data(i,i+1);
+                        auto image = reader.image<std::vector<uint16>>(i);
+                        BOOST_CHECK_EQUAL_COLLECTIONS(image.begin(),image.end(),
+                                                      ref.begin(),ref.end());
+                    }
+
+                    auto ref = stack_data(0,3);
+                    auto stack = reader.images<std::vector<uint16>>(0,3);
+                    BOOST_CHECK_EQUAL_COLLECTIONS(stack.begin(),stack.end(),
+                                                  ref.begin(),ref.end());
+
+                    ref = stack_data(1,3);
+                    std::vector<float64> part(2*35);
+                    reader.images(part,1,3);
+                    BOOST_CHECK_EQUAL_COLLECTIONS(part.begin(),part.end(),
+                                                  ref.begin(),ref.end());
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_stack_errors)
+    {
+        tiff_reader reader("stack_ui16.tiff");
+        std::vector<uint16> data(35);
+        BOOST_CHECK_THROW(reader.images(data,2,4),index_error);
+        BOOST_CHECK_THROW(reader.images(data,2,1),index_error);
+        BOOST_CHECK_THROW(reader.images(data,0,2),size_mismatch_error);
+        BOOST_CHECK_NO_THROW(reader.images(data,1,1));
+        BOOST_CHECK(reader.images<std::vector<uint16>>(1,1).empty());
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_ifd_cache)
+    {
+        tiff::ifd_cache cache(2);
+        BOOST_CHECK(cache.capacity() == 2);
+        BOOST_CHECK(cache.find(0) == nullptr);
+
+        cache.insert(0,tiff::ifd(1));
+        cache.insert(1,tiff::ifd(2));
+        BOOST_CHECK(cache.size() == 2);
+
+        //0 becomes the most recently used IFD - 1 is dropped
+        BOOST_REQUIRE(cache.find(0) != nullptr);
+        BOOST_CHECK(cache.insert(2,tiff::ifd(3)).size() == 3);
+        BOOST_CHECK(cache.size() == 2);
+        BOOST_CHECK(cache.find(1) == nullptr);
+        BOOST_REQUIRE(cache.find(0) != nullptr);
+        BOOST_CHECK(cache.find(0)->size() == 1);
+        BOOST_CHECK(cache.find(2)->size() == 3);
+
+        cache.capacity(1);
+        BOOST_CHECK(cache.size() == 1);
+        BOOST_CHECK(cache.find(2) != nullptr);
+
+        cache.clear();
+        BOOST_CHECK(cache.size() == 0);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_ifd_values)
+    {
+        for(string fname: {"stack_ui16.tiff","mm_stack_ui16.tiff",
+                           "stack_i16.btf"})
+        {
+            std::ifstream stream(fname.c_str(),std::ios::binary);
+            tiff::file_format format = tiff::file_format::read(stream);
+            stream.seekg(format.read_offset(stream),std::ios::beg);
+            tiff::ifd image_dir = tiff::ifd::read(stream,format);
+            BOOST_REQUIRE(stream);
+
+            //all data is loaded - the stream is not required anymore
+            stream.close();
+            for(const auto &entry: image_dir) 
+                BOOST_CHECK(entry.is_loaded());
+
+            BOOST_CHECK(image_dir.values(stream,"ImageWidth").at(0) == 7);
+            BOOST_CHECK(image_dir.values(stream,"ImageLength").at(0) == 5);
+            BOOST_CHECK(image_dir.value(stream,"RowsPerStrip",0) == 2);
+            BOOST_CHECK(image_dir.value(stream,"Predictor",1) == 1);
+
+            //the strip offsets do not fit into the value field 
+            const auto &offsets = image_dir.values(stream,"StripOffsets");
+            BOOST_REQUIRE(offsets.size() == 3);
+            BOOST_CHECK(&offsets == &image_dir.values(stream,"StripOffsets"));
+            auto byte_counts = image_dir["StripByteCounts"].value<size_t>(stream);
+            BOOST_REQUIRE(byte_counts.size() == 3);
+            BOOST_CHECK(offsets[1] == offsets[0]+byte_counts[0]);
+            BOOST_CHECK(byte_counts[2] == 7*2);
+
+            BOOST_CHECK_THROW(image_dir.values(stream,"TileOffsets"),key_error);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_lazy_ifds)
+    {
+        for(string fname: {"stack_ui16.tiff","stack_i16.btf"})
+        {
+            for(bool mmap: {false,true})
+            {
+                tiff_reader reader(fname);
+                reader.use_mmap(mmap);
+                BOOST_CHECK(reader.ifd_cache_size() == 1024);
+                BOOST_REQUIRE(reader.nimages() == 3);
+
+                //only one IFD is kept - every access parses the IFD again
+                reader.ifd_cache_size(1);
+                auto ref = reader.images<std::vector<int32>>(0,3);
+                for(size_t i: {2,0,1,1,2})
+                {
+                    auto image = reader.image<std::vector<int32>>(i);
+                    BOOST_CHECK(reader.info(i).nx() == 5);
+                    BOOST_CHECK(std::equal(image.begin(),image.end(),
+                                           ref.begin()+35*i));
+                }
+                BOOST_CHECK_THROW(reader.info(3),index_error);
+
+                reader.ifd_cache_size(0);
+                BOOST_CHECK(reader.images<std::vector<int32>>(0,3) == ref);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_channels)
+    {
+        for(bool mmap: {false,true})
+        {
+            for(size_t nthreads: {1,3})
+            {
+                tiff_reader reader("rgb_ui16.tiff");
+                reader.use_mmap(mmap);
+                reader.nthreads(nthreads);
+                BOOST_CHECK(reader.info(0).nchannels() == 3);
+
+                for(size_t c=0;c<3;++c)
+                {
+                    auto ref = stack_data(0,1,c);
+                    auto image = reader.image<std::vector<uint32>>(0,c);
+                    BOOST_CHECK_EQUAL_COLLECTIONS(image.begin(),image.end(),
+                                                  ref.begin(),ref.end());
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //read an image with all combinations of backend and number of threads
+    //and compare it to a reference
+    template<typename T,typename FUNC>
+    void check_image(const string &fname,size_t c,FUNC reference)
+    {
+        for(bool mmap: {false,true})
+        {
+            for(size_t nthreads: {1,3})
+            {
+                tiff_reader reader(fname);
+                reader.use_mmap(mmap);
+                reader.nthreads(nthreads);
+
+                image_info info = reader.info(0);
+                auto image = reader.image<std::vector<T>>(0,c);
+                BOOST_REQUIRE(image.size() == info.npixels());
+                for(size_t i=0;i<info.nx();++i)
+                    for(size_t j=0;j<info.ny();++j)
+                        BOOST_CHECK_EQUAL(image[i*info.ny()+j],
+                                          reference(i,j));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_lzw)
+    {
+        //several clear codes per strip and a short last strip
+        check_image<uint16>("lzw_ui16.tiff",0,[](size_t i,size_t j)
+        {
+            uint32 x = uint32(128*i+j)*2654435761u;
+            x ^= x>>15;
+            x *= 2246822519u;
+            return uint16((x^(x>>13))&0xFFFF);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_lzw_channels)
+    {
+        for(size_t c=0;c<3;++c)
+            check_image<uint32>("lzw_rgb_ui16.tiff",c,[c](size_t i,size_t j)
+            {
+                return uint32(1000*c+10*i+j);
+            });
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_deflate)
+    {
+        check_image<float64>("deflate_f32.tiff",0,[](size_t i,size_t j)
+        {
+            return float64(i)+float64(j)/8.-3.;
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_packbits)
+    {
+        check_image<uint8>("packbits_ui8.tiff",0,[](size_t i,size_t j)
+        {
+            return uint8(10*(i/4)+j/8);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    uint16 hash16(size_t i)
+    {
+        uint32 x = uint32(i)*2654435761u;
+        x ^= x>>15;
+        x *= 2246822519u;
+        return uint16((x^(x>>13))&0xFFFF);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_tiled)
+    {
+        //edge tiles are padded
+        check_image<uint16>("stack_tiled_ui16.tiff",0,
+                            [](size_t i,size_t j)
+        {
+            return uint16(100*i+j);
+        });
+
+        for(size_t nthreads: {1,3})
+        {
+            tiff_reader reader("stack_tiled_ui16.tiff");
+            reader.nthreads(nthreads);
+            auto stack = reader.images<std::vector<uint32>>(0,2);
+            BOOST_REQUIRE(stack.size() == 2*40*50);
+            for(size_t p=0;p<2;++p)
+                for(size_t i=0;i<40;++i)
+                    for(size_t j=0;j<50;++j)
+                        BOOST_CHECK_EQUAL(stack[(p*40+i)*50+j],
+                                          1000*p+100*i+j);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_tiled_lzw_channels)
+    {
+        for(size_t c=0;c<3;++c)
+            check_image<uint16>("lzw_tiled_rgb_ui16.tiff",c,
+                                [c](size_t i,size_t j)
+            {
+                return hash16(3*(50*i+j)+c);
+            });
+    }
+
+    //-------------------------------------------------------------------------
+    //read a region of interest with all combinations of backend and 
+    //number of threads and compare it to a reference
+    template<typename T,typename FUNC>
+    void check_roi(const string &fname,size_t i,size_t c,
+                   const image_roi &roi,FUNC reference)
+    {
+        for(bool mmap: {false,true})
+        {
+            for(size_t nthreads: {1,3})
+            {
+                tiff_reader reader(fname);
+                reader.use_mmap(mmap);
+                reader.nthreads(nthreads);
+
+                auto data = reader.image<std::vector<T>>(i,c,roi);
+                BOOST_REQUIRE(data.size() == roi.npixels());
+                for(size_t x=0;x<roi.nx();++x)
+                    for(size_t y=0;y<roi.ny();++y)
+                        BOOST_CHECK_EQUAL(data[x*roi.ny()+y],
+                                          reference(roi.x()+x,roi.y()+y));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_roi_strips)
+    {
+        check_roi<uint16>("stack_ui16.tiff",1,0,image_roi(1,2,3,4),
+                          [](size_t i,size_t j) { return 1000+10*i+j; });
+        check_roi<uint32>("rgb_ui16.tiff",0,2,image_roi(4,0,1,7),
+                          [](size_t i,size_t j) { return 2000+10*i+j; });
+        check_roi<uint16>("lzw_ui16.tiff",0,0,image_roi(40,3,60,100),
+                          [](size_t i,size_t j) { return hash16(128*i+j); });
+        check_roi<float64>("deflate_f32.tiff",0,0,image_roi(7,0,2,50),
+                           [](size_t i,size_t j) 
+                           { return float64(i)+float64(j)/8.-3.; });
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_roi_tiles)
+    {
+        //within a single tile, across tiles and at the padded edges
+        for(auto roi: {image_roi(2,3,5,6),image_roi(10,10,20,30),
+                       image_roi(33,45,7,5),image_roi(0,0,40,50)})
+        {
+            check_roi<uint16>("stack_tiled_ui16.tiff",1,0,roi,
+                              [](size_t i,size_t j) 
+                              { return 1000+100*i+j; });
+            check_roi<uint16>("lzw_tiled_rgb_ui16.tiff",0,1,roi,
+                              [](size_t i,size_t j) 
+                              { return hash16(3*(50*i+j)+1); });
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_roi_errors)
+    {
+        tiff_reader reader("stack_tiled_ui16.tiff");
+        std::vector<uint16> data(20);
+        BOOST_CHECK_THROW(reader.image(data,0,0,image_roi(36,0,5,4)),
+                          index_error);
+        BOOST_CHECK_THROW(reader.image(data,0,0,image_roi(0,47,5,4)),
+                          index_error);
+        BOOST_CHECK_THROW(reader.image(data,0,0,image_roi(0,0,4,4)),
+                          size_mismatch_error);
+        BOOST_CHECK_THROW(reader.image(data,2,0,image_roi(0,0,5,4)),
+                          index_error);
+        BOOST_CHECK_NO_THROW(reader.image(data,0,0,image_roi(35,46,5,4)));
+
+        //an empty region
+        BOOST_CHECK(reader.image<std::vector<uint16>>(0,0,
+                    image_roi(3,3,0,0)).empty());
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_file_format)
+    {
+        tiff_reader le("stack_ui16.tiff");
+        BOOST_CHECK(le.format().little_endian());
+        BOOST_CHECK(!le.format().big_tiff());
+
+        tiff_reader be("mm_stack_ui16.tiff");
+        BOOST_CHECK(!be.format().little_endian());
+        BOOST_CHECK(!be.format().big_tiff());
+
+        tiff_reader big("mm_stack_tiled_ui16.btf");
+        BOOST_CHECK(!big.format().little_endian());
+        BOOST_CHECK(big.format().big_tiff());
+        BOOST_CHECK(big.format().offset_size() == 8);
+
+        BOOST_CHECK_THROW(tiff_reader("LAOS3_05461.cbf"),file_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_big_endian)
+    {
+        for(size_t c=0;c<3;++c)
+            check_image<float64>("mm_rgb_f64.tiff",c,[c](size_t i,size_t j)
+            {
+                return float64(1000*c+10*i+j)+0.25;
+            });
+
+        //the predictor is applied after swapping
+        check_image<uint32>("mm_lzw_ui32.tiff",0,[](size_t i,size_t j)
+        {
+            uint32 x = uint32(40*i+j)*2654435761u;
+            x ^= x>>15;
+            x *= 2246822519u;
+            return x^(x>>13);
+        });
+
+        //the floating point predictor does not depend on the byte order
+        check_image<float64>("mm_deflate_f32.tiff",0,[](size_t i,size_t j)
+        {
+            return float64(i)+float64(j)/8.-3.;
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_read_big_tiff)
+    {
+        for(bool mmap: {false,true})
+        {
+            tiff_reader reader("stack_i16.btf");
+            reader.use_mmap(mmap);
+            BOOST_REQUIRE(reader.nimages() == 3);
+            BOOST_CHECK(reader.info(0).types_per_channel()[0] == 
+                        type_id_t::INT16);
+
+            auto stack = reader.images<std::vector<int32>>(0,3);
+            for(size_t p=0;p<3;++p)
+                for(size_t i=0;i<5;++i)
+                    for(size_t j=0;j<7;++j)
+                        BOOST_CHECK_EQUAL(stack[(p*5+i)*7+j],
+                                          -int32(1000*p+10*i+j));
+        }
+
+        string fname = "mm_stack_tiled_ui16.btf";
+        check_image<uint16>(fname,0,[](size_t i,size_t j)
+        {
+            return uint16(100*i+j);
+        });
+        check_roi<uint16>(fname,1,0,image_roi(10,10,20,30),
+                          [](size_t i,size_t j) { return 1000+100*i+j; });
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_byte_swap)
+    {
+        using namespace pni::io::tiff;
+        BOOST_CHECK(swap_value<uint16>(0x1234) == 0x3412);
+        BOOST_CHECK(swap_value<uint32>(0x12345678) == 0x78563412);
+        BOOST_CHECK(swap_value<uint64>(0x0102030405060708ull) == 
+                    0x0807060504030201ull);
+
+        //all implementations must agree on long and odd sized buffers
+        std::vector<char> data(1000);
+        for(size_t i=0;i<data.size();++i) data[i] = char(i*7+3);
+
+        for(size_t size: {2,4,8})
+        {
+            for(size_t n: {size_t(1),size_t(7),size_t(101),1000/size})
+            {
+                std::vector<char> ref(data);
+                for(size_t i=0;i<n;++i)
+                    std::reverse(ref.begin()+i*size,ref.begin()+(i+1)*size);
+
+                for(auto ext: {simd_extension::NONE,simd_extension::SSSE3,
+                               simd_extension::AVX2})
+                {
+                    if(!byte_swap_simd_supported(ext)) continue;
+                    std::vector<char> result(data);
+                    swap_bytes(ext,result.data(),n,size);
+                    BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(),result.end(),
+                                                  ref.begin(),ref.end());
+                }
+            }
+        }
+
+        std::vector<char> result(data);
+        swap_bytes(result.data(),10,1);
+        BOOST_CHECK(result == data);
+        BOOST_CHECK_THROW(swap_bytes(result.data(),10,3),value_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_strip_decoder)
+    {
+        using namespace pni::io::tiff;
+        BOOST_CHECK(to_compression(5) == compression::LZW);
+        BOOST_CHECK(to_compression(32946) == compression::DEFLATE_OLD);
+        BOOST_CHECK_THROW(to_compression(7),not_implemented_error);
+        BOOST_CHECK_THROW(to_predictor(4),not_implemented_error);
+
+        //the horizontal predictor requires samples of equal size
+        BOOST_CHECK_THROW(strip_decoder(compression::LZW,
+                                        predictor::HORIZONTAL,3,0,12,24),
+                          value_error);
+        BOOST_CHECK_THROW(strip_decoder(compression::LZW,
+                                        predictor::FLOATING_POINT,1,1,8,8),
+                          value_error);
+
+        //PackBits: literal run of 3, run of 4 times 0x2A, no-op
+        const char packbits[] = {2,1,2,3,-3,42,-128};
+        strip_decoder decoder(compression::PACKBITS,predictor::NONE,1,1,
+                              8,8);
+        for(size_t n=0;n<2;++n)
+        {
+            BOOST_CHECK(decoder.decode(packbits,sizeof(packbits)) == 7);
+            std::vector<char> ref{1,2,3,42,42,42,42};
+            BOOST_CHECK_EQUAL_COLLECTIONS(decoder.data(),decoder.data()+7,
+                                          ref.begin(),ref.end());
+        }
+
+        //output is clipped to the size of a strip
+        strip_decoder small(compression::PACKBITS,predictor::NONE,1,1,4,4);
+        BOOST_CHECK(small.decode(packbits,sizeof(packbits)) == 4);
+
+        //a decoder with the same parameters takes over the buffers
+        strip_decoder next(compression::PACKBITS,predictor::NONE,1,1,8,8);
+        BOOST_CHECK(next.same_parameters(decoder));
+        BOOST_CHECK(!small.same_parameters(decoder));
+        BOOST_CHECK(!strip_decoder(compression::LZW,predictor::NONE,1,1,8,8)
+                     .same_parameters(decoder));
+        const char *buffer = decoder.data();
+        next = std::move(decoder);
+        BOOST_CHECK(next.decode(packbits,sizeof(packbits)) == 7);
+        BOOST_CHECK(next.data() == buffer);
+
+        //9 bit codes: Clear, 'A', 300 (undefined), EOI
+        const unsigned char lzw[] = {0x80,0x10,0x65,0x90,0x10};
+        strip_decoder corrupt(compression::LZW,predictor::NONE,1,1,8,8);
+        BOOST_CHECK_THROW(corrupt.decode(reinterpret_cast<const char*>(lzw),
+                                         sizeof(lzw)),file_error);
+
+        const char deflate[] = {1,2,3,4};
+        strip_decoder inflate(compression::DEFLATE,predictor::NONE,1,1,8,8);
+        BOOST_CHECK_THROW(inflate.decode(deflate,sizeof(deflate)),file_error);
+    }
+
+    //-------------------------------------------------------------------------
+    BOOST_AUTO_TEST_CASE(test_truncated_strips)
+    {
+        using namespace pni::io::tiff;
+
+        //zlib stream of the bytes 1 to 8
+        const unsigned char deflate[] = {120,156,99,100,98,102,97,101,99,231,
+                                         0,0,0,128,0,37};
+        const char *zdata = reinterpret_cast<const char*>(deflate);
+        strip_decoder inflate(compression::DEFLATE,predictor::NONE,1,1,8,8);
+        BOOST_CHECK(inflate.decode(zdata,sizeof(deflate)) == 8);
+        BOOST_CHECK_THROW(inflate.decode(zdata,10),file_error);
+        //a full output buffer completes the strip
+        strip_decoder half(compression::DEFLATE,predictor::NONE,1,1,4,4);
+        BOOST_CHECK(half.decode(zdata,10) == 4);
+
+        //9 bit codes: Clear, 'A', 'B', EOI
+        const unsigned char lzw[] = {0x80,0x10,0x48,0x50,0x10};
+        const char *ldata = reinterpret_cast<const char*>(lzw);
+        strip_decoder unlzw(compression::LZW,predictor::NONE,1,1,8,8);
+        BOOST_CHECK(unlzw.decode(ldata,sizeof(lzw)) == 2);
+        BOOST_CHECK_THROW(unlzw.decode(ldata,3),file_error);
+
+        //literal run and replicate run without their data
+        strip_decoder packbits(compression::PACKBITS,predictor::NONE,1,1,8,8);
+        const char literal[] = {5,1,2};
+        const char replicate[] = {-3};
+        BOOST_CHECK_THROW(packbits.decode(literal,sizeof(literal)),file_error);
+        BOOST_CHECK_THROW(packbits.decode(replicate,sizeof(replicate)),
+                          file_error);
+
+        //two PackBits strips of one row with four 8Bit pixels each
+        const char file[] = {-3,7,-3,9,1,7,7,1,9,9};
+        std::vector<size_t> bits{8};
+        std::vector<type_id_t> types{type_id_t::UINT8};
+        strip_decoder decoder(compression::PACKBITS,predictor::NONE,1,1,4,4);
+
+        std::vector<uint8> data(8);
+        strip_reader full({0,2},{2,2},bits,types,decoder);
+        full.read(0,file,sizeof(file),data);
+        std::vector<uint8> ref{7,7,7,7,9,9,9,9};
+        BOOST_CHECK(data == ref);
+
+        //only the last strip may be shorter than a full strip
+        strip_reader short_last({0,7},{2,3},bits,types,decoder);
+        data.resize(6);
+        short_last.read(0,file,sizeof(file),data);
+        BOOST_CHECK(data == std::vector<uint8>({7,7,7,7,9,9}));
+
+        strip_reader short_first({4,2},{3,2},bits,types,decoder);
+        data.resize(8);
+        BOOST_CHECK_THROW(short_first.read(0,file,sizeof(file),data),
+                          file_error);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()